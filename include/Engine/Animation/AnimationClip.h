@@ -0,0 +1,58 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/AnimationSource.h"
+
+#include <glm.hpp>
+#include <gtc/quaternion.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace gp1::animation
+{
+	// The keyframes of one joint, each channel has its own key times so constant channels only need one key.
+	// Key times have to be increasing, a channel without keys leaves the joint's transform untouched.
+	struct JointTrack
+	{
+	public:
+		std::vector<float>      m_TranslationTimes; // The time of every translation key in seconds.
+		std::vector<glm::fvec3> m_Translations;     // The translation keys.
+		std::vector<float>      m_RotationTimes;    // The time of every rotation key in seconds.
+		std::vector<glm::fquat> m_Rotations;        // The rotation keys.
+		std::vector<float>      m_ScaleTimes;       // The time of every scale key in seconds.
+		std::vector<glm::fvec3> m_Scales;           // The scale keys.
+	};
+
+	// A keyframed animation of the joints of a skeleton.
+	class AnimationClip : public AnimationSource
+	{
+	public:
+		AnimationClip(const std::string& name, float duration, bool looping = true);
+
+		// Get the track of the joint, adding empty tracks up to it if needed.
+		JointTrack& GetTrack(uint32_t joint);
+		// Get the track of every joint.
+		const std::vector<JointTrack>& GetTracks() const;
+
+		// Get the name of the clip.
+		const std::string& GetName() const;
+
+		virtual float GetDuration() const override;
+		virtual bool IsLooping() const override;
+
+		// The rotations of every joint are gathered and interpolated together so they go through the SIMD nlerp.
+		virtual void Sample(float time, std::vector<JointTransform>& transforms) const override;
+
+	private:
+		std::string             m_Name;     // The name of the clip.
+		float                   m_Duration; // The length of the clip in seconds.
+		bool                    m_Looping;  // Does the clip repeat after its duration.
+		std::vector<JointTrack> m_Tracks;   // The track of every joint.
+	};
+
+} // namespace gp1::animation
@@ -0,0 +1,35 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/CompressedAnimationClip.h"
+
+#include <stdint.h>
+
+namespace gp1::animation
+{
+	struct CompressionSettings
+	{
+	public:
+		float m_SampleRate     = 30.0f;   // The frames per second the clip is resampled at.
+		float m_MaxError       = 0.0001f; // The furthest a point near a joint may move in object space.
+		float m_VertexDistance = 0.1f;    // The distance of the points measured around every joint, roughly how far skinned vertices are from their joints.
+	};
+
+	// Compress the clip for the skeleton.
+	// The clip is resampled at the sample rate and every channel of every joint gets the cheapest encoding of constant, linear,
+	// quantized from 3 to 16 bits per component, or raw floats that keeps the error within the bound.
+	// The error is measured in object space at points around the joint and every joint below it, with the joints above it
+	// already compressed, so the error that builds up along a chain is accounted for. Each joint gets a share of the bound
+	// that grows with its depth, which keeps the deepest joints within the full bound.
+	// The bound holds at the sampled frames, between them the compressed clip interpolates the frames rather than the source keys.
+	CompressedAnimationClip CompressAnimationClip(const AnimationClip& clip, const Skeleton& skeleton, const CompressionSettings& settings = {});
+
+	// Get the largest distance in object space between the points around every joint posed by the two animations,
+	// sampled evenly over the reference's duration.
+	float MeasureAnimationError(const AnimationSource& reference, const AnimationSource& animation, const Skeleton& skeleton, float vertexDistance, uint32_t sampleCount = 256);
+
+} // namespace gp1::animation
@@ -0,0 +1,25 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+#include <gtc/quaternion.hpp>
+
+#include <stdint.h>
+
+namespace gp1::animation
+{
+	// Normalized linear interpolation of count quaternion pairs, taking the shorter path.
+	// The factors are read from factors[i], or weight is used for every pair if factors is nullptr.
+	// Four pairs at a time go through SSE where it is available, out may alias a or b.
+	void NLerpQuaternions(const glm::fquat* a, const glm::fquat* b, const float* factors, float weight, glm::fquat* out, uint32_t count);
+
+	// Multiply count quaternion pairs, a[i] * b[i], out may alias either of them.
+	void MultiplyQuaternions(const glm::fquat* a, const glm::fquat* b, glm::fquat* out, uint32_t count);
+
+	// Multiply two matrices, out may alias either of them.
+	void MultiplyMatrices(const glm::fmat4& a, const glm::fmat4& b, glm::fmat4& out);
+
+} // namespace gp1::animation
@@ -0,0 +1,31 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/Skeleton.h"
+
+#include <vector>
+
+namespace gp1::animation
+{
+	// Anything an animation layer can play, like keyframed or compressed clips.
+	class AnimationSource
+	{
+	public:
+		virtual ~AnimationSource() = default;
+
+		// Get the length of the animation in seconds.
+		virtual float GetDuration() const = 0;
+		// Does the animation repeat after its duration.
+		virtual bool IsLooping() const = 0;
+		// Overwrite the transforms of the animated joints with the animation at the given time.
+		// The time is clamped to the duration, looping animations are wrapped with WrapTime beforehand.
+		virtual void Sample(float time, std::vector<JointTransform>& transforms) const = 0;
+
+		// Get the time inside the animation, wrapping looping animations and clamping the others.
+		float WrapTime(float time) const;
+	};
+
+} // namespace gp1::animation
@@ -0,0 +1,59 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/AnimationSource.h"
+#include "Engine/Animation/Pose.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::animation
+{
+	struct AnimationLayer
+	{
+	public:
+		const AnimationSource*    m_Clip      = nullptr; // The clip played by the layer.
+		float                     m_Time      = 0.0f;    // The time in the clip in seconds.
+		float                     m_Speed     = 1.0f;    // How fast the time advances.
+		float                     m_Weight    = 1.0f;    // How much the layer affects the pose.
+		const std::vector<float>* m_JointMask = nullptr; // The weight of every joint, nullptr affects every joint fully.
+		bool                      m_Additive  = false;   // Is the clip's difference to the bind pose added on top of the layers below.
+	};
+
+	// Plays layers of clips on a skeleton.
+	// The first layer blends from the bind pose and every following layer blends over or adds onto the layers below it.
+	class Animator
+	{
+	public:
+		Animator(const Skeleton* skeleton);
+
+		// Add a layer on top of the others, returns the index of the layer.
+		uint32_t AddLayer(const AnimationLayer& layer);
+		// Get the layer at the given index.
+		AnimationLayer& GetLayer(uint32_t index);
+		// Get the number of layers.
+		uint32_t GetLayerCount() const;
+
+		// Advance the time of every layer.
+		void Update(float deltaTime);
+		// Sample and blend the layers into the pose and calculate its model matrices.
+		void Evaluate();
+
+		// Get the evaluated pose.
+		const Pose& GetPose() const;
+
+	private:
+		Pose                        m_Pose;           // The evaluated pose.
+		std::vector<AnimationLayer> m_Layers;         // The layers, bottom first.
+		std::vector<JointTransform> m_BindTransforms; // The bind transforms of the skeleton.
+		std::vector<JointTransform> m_Sampled;        // The transforms sampled from the current layer.
+	};
+
+	// Update and evaluate the animators in parallel on the job system.
+	void EvaluateAnimators(const std::vector<Animator*>& animators, float deltaTime);
+
+
+} // namespace gp1::animation
@@ -0,0 +1,25 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/Skeleton.h"
+
+#include <vector>
+
+namespace gp1::animation
+{
+	// Blend from the transforms in a towards the ones in b.
+	// The weight of every joint is weight * mask[joint], or just weight if mask is nullptr, so a mask limits a layer to part of the skeleton.
+	// out may alias a or b.
+	void BlendTransforms(const std::vector<JointTransform>& a, const std::vector<JointTransform>& b, float weight, const float* mask, std::vector<JointTransform>& out);
+
+	// Write the difference between the transforms and the reference transforms, so it can be added on top of another pose.
+	// out may alias transforms.
+	void MakeAdditiveTransforms(const std::vector<JointTransform>& transforms, const std::vector<JointTransform>& reference, std::vector<JointTransform>& out);
+	// Add the weighted additive transforms made by MakeAdditiveTransforms on top of the base transforms, with the weight masked like BlendTransforms.
+	// out may alias base.
+	void ApplyAdditiveTransforms(const std::vector<JointTransform>& base, const std::vector<JointTransform>& additive, float weight, const float* mask, std::vector<JointTransform>& out);
+
+} // namespace gp1::animation
@@ -0,0 +1,138 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/AnimationSource.h"
+
+#include <filesystem>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace gp1::animation
+{
+	enum class ChannelEncoding : uint8_t
+	{
+		EMPTY,     // The source clip doesn't animate the channel, so it is left untouched.
+		CONSTANT,  // One value for the whole clip.
+		LINEAR,    // Interpolated from a start to an end value over the whole clip.
+		QUANTIZED, // Every frame stores the components in m_Bits bits each, mapped to the channel's range.
+		RAW        // Every frame stores the components as 32 bit floats.
+	};
+
+	// The order of the channels of every joint.
+	namespace ChannelType
+	{
+		constexpr const uint32_t TRANSLATION = 0;
+		constexpr const uint32_t ROTATION    = 1;
+		constexpr const uint32_t SCALE       = 2;
+		constexpr const uint32_t COUNT       = 3;
+	}; // namespace ChannelType
+
+	// The header at the start of a compressed clip, every offset is in bytes from the start of the data.
+	struct CompressedClipHeader
+	{
+	public:
+		uint32_t m_Magic;          // Always CompressedAnimationClip::s_Magic.
+		uint32_t m_Version;        // Always CompressedAnimationClip::s_Version.
+		uint32_t m_Size;           // The size of the whole clip in bytes.
+		uint32_t m_Flags;          // 1 if the clip is looping.
+		float    m_Duration;       // The length of the clip in seconds.
+		float    m_SampleRate;     // The frames per second.
+		uint32_t m_FrameCount;     // The number of frames, the last one is at the duration.
+		uint32_t m_FrameStride;    // The size of one frame in bytes.
+		uint32_t m_JointCount;     // The number of joints, every joint has ChannelType::COUNT channels.
+		uint32_t m_ValueCount;     // The number of floats in the value table.
+		uint32_t m_NameOffset;     // The offset of the name.
+		uint32_t m_NameLength;     // The length of the name, which isn't null terminated.
+		uint32_t m_ChannelsOffset; // The offset of the channels.
+		uint32_t m_ValuesOffset;   // The offset of the value table.
+		uint32_t m_FramesOffset;   // The offset of the frames.
+	};
+
+	// How one channel of one joint is stored.
+	struct CompressedChannel
+	{
+	public:
+		ChannelEncoding m_Encoding;  // How the channel is stored.
+		uint8_t         m_Bits;      // The bits per component in every frame, 0 if the channel isn't stored per frame.
+		uint16_t        m_Padding;   // Keeps the struct 4 byte aligned.
+		uint32_t        m_Value;     // The index of the channel's floats in the value table.
+		uint32_t        m_BitOffset; // The offset of the channel's components in every frame in bits.
+	};
+
+	// An animation clip resampled at a fixed rate and compressed by AnimationCompressor.
+	// The whole clip is one contiguous, position independent block, so a file can be read or mapped and used as is.
+	// Rotations are stored as x, y and z with w rebuilt as positive.
+	// Quantized channels store the components relative to their range, the value table holds the minimum and extent of each
+	// component, constant channels hold their value and linear channels their start and end values.
+	// Sampling reads two frames next to each other, which keeps every joint's data in the same few cache lines.
+	// The data is little endian.
+	class CompressedAnimationClip : public AnimationSource
+	{
+	public:
+		static constexpr const uint32_t s_Magic   = 0x43415047; // "GPAC"
+		static constexpr const uint32_t s_Version = 1;
+
+	public:
+		CompressedAnimationClip() = default;
+		CompressedAnimationClip(const CompressedAnimationClip&) = delete;
+		CompressedAnimationClip(CompressedAnimationClip&&)      = default;
+		CompressedAnimationClip& operator=(const CompressedAnimationClip&) = delete;
+		CompressedAnimationClip& operator=(CompressedAnimationClip&&) = default;
+
+		// Take the data, returns false and clears the clip if it isn't a valid compressed clip.
+		bool SetData(std::vector<uint8_t> data);
+		// Use data owned by someone else, like a mapped file, which has to outlive the clip and be 4 byte aligned.
+		// Returns false and clears the clip if it isn't a valid compressed clip.
+		bool SetView(const uint8_t* data, size_t size);
+		// Read the clip from a file, returns false if there is none or it is invalid.
+		bool LoadFromFile(const std::filesystem::path& path);
+		// Write the clip to a file.
+		bool SaveToFile(const std::filesystem::path& path) const;
+
+		// Does the clip hold valid data.
+		bool IsValid() const;
+		// Get the name of the clip.
+		std::string GetName() const;
+		// Get the number of joints.
+		uint32_t GetJointCount() const;
+		// Get the number of frames.
+		uint32_t GetFrameCount() const;
+		// Get the frames per second.
+		float GetSampleRate() const;
+		// Get the data of the clip.
+		const uint8_t* GetData() const;
+		// Get the size of the data in bytes.
+		size_t GetSize() const;
+
+		virtual float GetDuration() const override;
+		virtual bool IsLooping() const override;
+
+		// The rotations of every joint are gathered and interpolated together so they go through the SIMD nlerp.
+		virtual void Sample(float time, std::vector<JointTransform>& transforms) const override;
+
+	private:
+		// Check the data and point the header, channels, values and frames into it.
+		bool Validate(const uint8_t* data, size_t size);
+		// Read the components of a per frame channel.
+		glm::fvec3 ReadChannel(const CompressedChannel& channel, uint32_t frame) const;
+
+	private:
+		std::vector<uint8_t>        m_OwnedData;          // The data if the clip owns it.
+		const uint8_t*              m_Data     = nullptr; // The data of the clip.
+		size_t                      m_Size     = 0;       // The size of the data in bytes.
+		const CompressedClipHeader* m_Header   = nullptr; // The header at the start of the data.
+		const CompressedChannel*    m_Channels = nullptr; // The channels of every joint.
+		const float*                m_Values   = nullptr; // The value table.
+		const uint8_t*              m_Frames   = nullptr; // The frames.
+	};
+
+	// Get the rotation from its x, y and z, rebuilding w as positive.
+	glm::fquat RotationFromVector(const glm::fvec3& vector);
+	// Map a quantized component back to its range.
+	float DequantizeComponent(uint32_t value, uint32_t bits, float minimum, float extent);
+
+} // namespace gp1::animation
@@ -0,0 +1,44 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Animation/Skeleton.h"
+
+#include <glm.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::animation
+{
+	// The transforms of every joint of a skeleton at one point in time.
+	class Pose
+	{
+	public:
+		Pose(const Skeleton* skeleton = nullptr);
+
+		// Set the skeleton this pose is for and reset it to the bind pose.
+		void SetSkeleton(const Skeleton* skeleton);
+		// Get the skeleton this pose is for.
+		const Skeleton* GetSkeleton() const;
+		// Get the number of joints.
+		uint32_t GetJointCount() const;
+
+		// Reset every joint to its bind transform.
+		void SetBindPose();
+		// Calculate the model space matrices from the local transforms, has to be called after the local transforms change.
+		void CalculateModelMatrices();
+		// Write the skinning matrix of every joint, which takes a mesh space vertex in the bind pose to its posed position.
+		void CalculateSkinningMatrices(glm::fmat4* matrices) const;
+
+	public:
+		std::vector<JointTransform> m_LocalTransforms; // The transform of every joint relative to its parent.
+		std::vector<glm::fmat4>     m_ModelMatrices;   // The model space matrix of every joint, calculated by CalculateModelMatrices.
+
+	private:
+		const Skeleton* m_Skeleton = nullptr; // The skeleton this pose is for.
+	};
+
+} // namespace gp1::animation
@@ -0,0 +1,62 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+#include <gtc/quaternion.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace gp1::animation
+{
+	struct JointTransform
+	{
+	public:
+		// Get the matrix scaling, then rotating, then translating.
+		glm::fmat4 ToMatrix() const;
+
+	public:
+		glm::fvec3 m_Translation { 0.0f, 0.0f, 0.0f };    // The translation relative to the parent joint.
+		glm::fquat m_Rotation { 1.0f, 0.0f, 0.0f, 0.0f }; // The rotation relative to the parent joint.
+		glm::fvec3 m_Scale { 1.0f, 1.0f, 1.0f };          // The scale relative to the parent joint.
+	};
+
+	struct Joint
+	{
+	public:
+		std::string    m_Name;                                 // The name of the joint.
+		int32_t        m_Parent            = -1;               // The index of the parent joint, -1 for root joints.
+		JointTransform m_BindTransform;                        // The transform relative to the parent joint in the bind pose.
+		glm::fmat4     m_InverseBindMatrix = glm::fmat4(1.0f); // Transforms mesh space to the joint's space in the bind pose.
+	};
+
+	// The joint hierarchy a skeletal mesh is skinned to.
+	// Joints are stored parents first, so a single pass in order is enough to go from local to model space.
+	class Skeleton
+	{
+	public:
+		// Add a joint, the parent has to be added before its children.
+		// Returns the index of the joint.
+		uint32_t AddJoint(const std::string& name, int32_t parent, const JointTransform& bindTransform, const glm::fmat4& inverseBindMatrix = glm::fmat4(1.0f));
+		// Find the index of the joint with the given name, -1 if there is none.
+		int32_t FindJoint(const std::string& name) const;
+
+		// Calculate every joint's inverse bind matrix from the bind transforms.
+		void CalculateInverseBindMatrices();
+
+		// Get the number of joints.
+		uint32_t GetJointCount() const;
+		// Get the joint at the given index.
+		const Joint& GetJoint(uint32_t index) const;
+		// Get all joints.
+		const std::vector<Joint>& GetJoints() const;
+
+	private:
+		std::vector<Joint> m_Joints; // The joints, parents before children.
+	};
+
+} // namespace gp1::animation
@@ -0,0 +1,82 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Utility/Logger.h"
+
+#include <glad/glad.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::apis::opengl::buffer
+{
+	struct RingBufferAllocation
+	{
+	public:
+		void*    m_Data   = nullptr; // Where the cpu writes the data, nullptr if the allocation didn't fit.
+		uint64_t m_Offset = 0;       // The offset of the allocation in the gl buffer.
+		uint64_t m_Size   = 0;       // The size of the allocation.
+	};
+
+	struct RingBufferStats
+	{
+	public:
+		uint64_t m_Frames        = 0;    // The number of frames streamed.
+		uint64_t m_Stalls        = 0;    // The number of frames the cpu had to wait for the gpu.
+		double   m_StallTime     = 0.0;  // The total time spent waiting for the gpu in milliseconds.
+		uint64_t m_Overflows     = 0;    // The number of allocations that didn't fit in a frame's section.
+		uint64_t m_BytesStreamed = 0;    // The total number of bytes allocated.
+		bool     m_Persistent    = false; // Is the buffer persistently mapped.
+	};
+
+	// A buffer split into one section per frame in flight, the cpu writes the current frame's data straight into mapped memory.
+	// Each section is guarded by a fence, so a section is only reused once the gpu has finished the frame that used it.
+	// Without buffer storage the buffer is orphaned every frame and the data is uploaded with glBufferSubData instead.
+	class OpenGLRingBuffer
+	{
+	public:
+		OpenGLRingBuffer(GLenum target, uint64_t frameSize, uint32_t framesInFlight = 3);
+		~OpenGLRingBuffer();
+
+		// Create the gl buffer.
+		void Init();
+		// Delete the gl buffer.
+		void CleanUp();
+
+		// Start writing to the next section, waits if the gpu is still using it.
+		void BeginFrame();
+		// Fence the current section.
+		void EndFrame();
+
+		// Allocate size bytes in the current section.
+		RingBufferAllocation Allocate(uint64_t size, uint64_t alignment = 16);
+		// Make the written allocation visible to the gpu.
+		void Flush(const RingBufferAllocation& allocation);
+
+		// Get the gl buffer.
+		uint32_t GetBuffer() const;
+		// Get the streaming stats.
+		const RingBufferStats& GetStats() const;
+
+	private:
+		GLenum   m_Target;         // The target the buffer is bound to when updating it.
+		uint64_t m_FrameSize;      // The size of one section.
+		uint32_t m_FramesInFlight; // The number of sections.
+
+		uint32_t             m_Buffer         = 0;       // The gl buffer.
+		uint8_t*             m_MappedData     = nullptr; // The persistently mapped buffer.
+		std::vector<uint8_t> m_Staging;                  // The cpu copy of the current frame when the buffer can't be mapped persistently.
+		std::vector<GLsync>  m_Fences;                   // The fence of every section.
+		uint32_t             m_CurrentSection = 0;       // The section being written to.
+		uint64_t             m_Head           = 0;       // The next free byte in the current section.
+
+		RingBufferStats m_Stats; // The streaming stats.
+
+	private:
+		static Logger s_Logger; // The logger ring buffers use.
+	};
+
+} // namespace gp1::renderer::apis::opengl::buffer
@@ -0,0 +1,72 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Apis/OpenGL/Buffer/OpenGLRingBuffer.h"
+#include "Engine/Renderer/Apis/OpenGL/OpenGLRendererData.h"
+#include "Engine/Renderer/Culling/StaticInstanceGroup.h"
+
+#include <stdint.h>
+
+namespace gp1::renderer::apis::opengl::culling
+{
+	// The shader storage buffer bindings used by the gpu culling pass and the instanced shaders.
+	namespace CullingBufferBinding
+	{
+		constexpr const uint32_t INSTANCES         = 0;
+		constexpr const uint32_t DRAW_COMMAND      = 1;
+		constexpr const uint32_t VISIBLE_INSTANCES = 2;
+	}; // namespace CullingBufferBinding
+
+	// The layout of the indirect draw command the culling pass writes to, glDrawArraysIndirect only reads the first four values.
+	struct DrawElementsIndirectCommand
+	{
+	public:
+		uint32_t m_Count         = 0; // The number of indices or vertices to draw.
+		uint32_t m_InstanceCount = 0; // The number of visible instances, incremented by the culling pass.
+		uint32_t m_FirstIndex    = 0; // The first index.
+		int32_t  m_BaseVertex    = 0; // The base vertex.
+		uint32_t m_BaseInstance  = 0; // The base instance.
+	};
+
+	struct OpenGLStaticInstanceGroupData : public OpenGLRendererData
+	{
+	public:
+		OpenGLStaticInstanceGroupData(renderer::culling::StaticInstanceGroup* group);
+
+		virtual void CleanUp() override;
+
+		// Reupload the instances if the group is dirty.
+		// Dynamic groups write their instances to the stream buffer every frame instead, if one is given.
+		void UpdateGLData(buffer::OpenGLRingBuffer* streamBuffer = nullptr, uint64_t streamAlignment = 16);
+		// Reset the draw command for a new frame.
+		// If the instances aren't culled on the gpu all instances are copied to the visible instances instead.
+		void ResetDrawCommand(uint32_t count, bool cullOnGPU);
+		// Bind the buffers to their shader storage bindings.
+		void BindBuffers();
+
+		// Get the number of instances.
+		uint32_t GetInstanceCount() const;
+		// Get the draw command buffer.
+		uint32_t GetDrawCommandBuffer() const;
+
+		friend OpenGLRenderer;
+
+	private:
+		// Grow the visible instance buffer to hold every instance.
+		void EnsureVisibleCapacity();
+
+	private:
+		uint32_t m_InstanceBuffer        = 0; // The buffer holding every instance's transform.
+		uint32_t m_VisibleInstanceBuffer = 0; // The buffer the culling pass compacts the visible instances' transforms into.
+		uint32_t m_DrawCommandBuffer     = 0; // The buffer holding the indirect draw command.
+		uint32_t m_InstanceCount         = 0; // The number of instances uploaded.
+		uint32_t m_InstanceCapacity      = 0; // The number of instances the instance buffer can hold.
+		uint32_t m_VisibleCapacity       = 0; // The number of instances the visible instance buffer can hold.
+		uint32_t m_SourceBuffer          = 0; // The buffer this frame's instances are read from. (i.e. the instance buffer or the stream buffer)
+		uint64_t m_SourceOffset          = 0; // The offset of this frame's instances in the source buffer.
+	};
+
+} // namespace gp1::renderer::apis::opengl::culling
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "Engine/Renderer/Apis/OpenGL/Buffer/OpenGLRingBuffer.h"
 #include "Engine/Renderer/Apis/OpenGL/OpenGLRendererData.h"
 #include "Engine/Renderer/Mesh/Mesh.h"
+#include "Engine/Renderer/Mesh/VertexPacking.h"
 
 #include <glad/glad.h>
 
@@ -29,15 +31,26 @@ namespace gp1::renderer::apis::opengl::mesh
 		virtual uint32_t GetCustomDataSize() = 0;
 		// Initialize custom gl data.
 		virtual void InitCustomGLData() = 0;
+		// Upload the custom data of the vertices [begin, end).
+		virtual void UpdateCustomGLData(uint32_t begin, uint32_t end) = 0;
 		// Clear custom gl data.
 		virtual void ClearCustomData() = 0;
 
 		// Does this mesh have indices.
 		bool HasIndices();
-		// Get this mesh's vao.
-		uint32_t GetVAO();
+		// Get the type of this mesh's indices.
+		GLenum GetIndexType() const;
+		// Are this mesh's vertices packed.
+		bool HasPackedVertices() const;
+		// Get the matrix that turns this mesh's quantized positions back into mesh space, identity if the vertices aren't packed.
+		glm::fmat4 GetDequantizationMatrix() const;
+		// Get this mesh's vao, uploading the mesh first if it changed.
+		// Dynamic meshes write their changes to the stream buffer and copy them on the gpu, if one is given.
+		uint32_t GetVAO(buffer::OpenGLRingBuffer* streamBuffer = nullptr);
 		// Initialize gl data.
-		void         InitGLData();
+		void InitGLData();
+		// Upload the dirty parts of the mesh, reusing the existing buffers when possible.
+		void         UpdateGLData();
 		virtual void CleanUp() override;
 
 		friend OpenGLRenderer;
@@ -53,6 +66,23 @@ namespace gp1::renderer::apis::opengl::mesh
 		// Unbind vbo.
 		void UnbindVBO(GLenum bufferType);
 
+		// Upload the vertices [begin, end) of data to the vertex buffer, which is always the first vbo.
+		void UploadVertices(const void* data, uint64_t vertexSize, uint32_t count, uint32_t begin, uint32_t end);
+		// Upload the elements [begin, end) of data to the buffer currently bound to target.
+		// The buffer is reallocated with geometric growth if count elements don't fit in its capacity.
+		void UploadBufferData(GLenum target, const void* data, uint64_t elementSize, uint32_t count, uint32_t& capacity, uint32_t begin, uint32_t end);
+		// Reallocate the buffer currently bound to target with geometric growth if count elements don't fit in its capacity.
+		// Returns true if the buffer was reallocated, in which case every element has to be uploaded again.
+		bool EnsureBufferCapacity(GLenum target, uint64_t elementSize, uint32_t count, uint32_t& capacity);
+		// Upload rangeData, which holds the elements [begin, end), to the buffer currently bound to target.
+		void UploadBufferRange(GLenum target, const void* rangeData, uint64_t elementSize, uint32_t begin, uint32_t end);
+		// Upload the indices [begin, end) to the index buffer currently bound, converting them to the index type.
+		void UploadIndices(uint32_t begin, uint32_t end);
+		// Get the smallest index type that can address every vertex, if the mesh is compressed.
+		GLenum ChooseIndexType();
+		// Set and enable the attrib pointers of packed vertices.
+		void SetPackedVertexAttribPointers(uint64_t stride);
+
 		// Set and enable attrib pointer.
 		void SetVertexAttribPointer(uint32_t index, uint32_t size, GLenum type, bool normalized, uint64_t stride, uint64_t offset);
 		// Set and enable attrib pointer.
@@ -61,15 +91,25 @@ namespace gp1::renderer::apis::opengl::mesh
 		void SetVertexAttribLPointer(uint32_t index, uint32_t size, GLenum type, uint64_t stride, uint64_t offset);
 
 	protected:
-		uint32_t  m_VAO            = 0;       // This mesh's VAO.
-		uint8_t   m_NumVBOs        = 0;       // The number of VBOs that this mesh has.
-		uint8_t   m_CurrentVBO     = 0;       // The current VBO.
-		uint32_t* m_VBOs           = nullptr; // This mesh's VBOs.
-		uint8_t   m_NumAttribs     = 0;       // The number of enabled vertex attribs this mesh has.
-		uint8_t   m_CurrentAttrib  = 0;       // The current vertex attrib.
-		uint32_t* m_EnabledAttribs = nullptr; // The vertex attribs that have been enabled for this mesh.
-		uint32_t  m_BufferSize     = 0;       // This mesh's Buffer Size. (i.e. the number of vertices/indices)
-		bool      m_HasIndices     = false;   // Does this mesh have indices.
+		uint32_t  m_VAO            = 0;               // This mesh's VAO.
+		uint8_t   m_NumVBOs        = 0;               // The number of VBOs that this mesh has.
+		uint8_t   m_CurrentVBO     = 0;               // The current VBO.
+		uint32_t* m_VBOs           = nullptr;         // This mesh's VBOs.
+		uint8_t   m_NumAttribs     = 0;               // The number of enabled vertex attribs this mesh has.
+		uint8_t   m_CurrentAttrib  = 0;               // The current vertex attrib.
+		uint32_t* m_EnabledAttribs = nullptr;         // The vertex attribs that have been enabled for this mesh.
+		uint32_t  m_BufferSize     = 0;               // This mesh's Buffer Size. (i.e. the number of vertices/indices)
+		bool      m_HasIndices     = false;           // Does this mesh have indices.
+		uint32_t  m_VertexCapacity = 0;               // The number of vertices the vertex buffer can hold.
+		uint32_t  m_IndexCapacity  = 0;               // The number of indices the index buffer can hold.
+		GLenum    m_IndexType      = GL_UNSIGNED_INT; // The type of the uploaded indices.
+		bool      m_PackedVertices = false;           // Are the uploaded vertices packed.
+		bool      m_Compressed     = false;           // Was the mesh set to be compressed when the buffers were created.
+
+		renderer::mesh::PositionBounds m_PositionBounds;         // The bounds the packed positions are quantized relative to.
+		buffer::OpenGLRingBuffer*      m_StreamBuffer = nullptr; // The stream buffer the current update writes through, nullptr outside of updates and for meshes that aren't dynamic.
+
+		static constexpr uint64_t s_MapRangeThreshold = 65536; // Uploads of at least this many bytes are written through a mapped range.
 	};
 
 } // namespace gp1::renderer::apis::opengl::mesh
@@ -8,6 +8,14 @@
 
 namespace gp1::renderer::apis::opengl::mesh
 {
+	// The shader storage buffer bindings used by the skinned shaders, after the culling and voxel bindings.
+	namespace SkinningBufferBinding
+	{
+		constexpr const uint32_t JOINT_PALETTES = 4;
+	}; // namespace SkinningBufferBinding
+
+	// Skeletal meshes only use m_CompressVertices to pick 16-bit indices, their vertices are always uploaded as floats.
+	// The packed vertex layout has no room for the joint indices and weights, and the skinned shader doesn't decode packed positions.
 	struct OpenGLSkeletalMeshData : public OpenGLMeshData
 	{
 	public:
@@ -17,6 +25,7 @@ namespace gp1::renderer::apis::opengl::mesh
 		bool     HasVertices() override;
 		uint32_t GetCustomDataSize() override;
 		void     InitCustomGLData() override;
+		void     UpdateCustomGLData(uint32_t begin, uint32_t end) override;
 		void     ClearCustomData() override;
 	};
 
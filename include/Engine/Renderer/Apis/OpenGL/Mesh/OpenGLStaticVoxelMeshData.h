@@ -17,7 +17,13 @@ namespace gp1::renderer::apis::opengl::mesh
 		bool     HasVertices() override;
 		uint32_t GetCustomDataSize() override;
 		void     InitCustomGLData() override;
+		void     UpdateCustomGLData(uint32_t begin, uint32_t end) override;
 		void     ClearCustomData() override;
+
+		// Calculate the bounds the packed positions are quantized relative to.
+		void CalculatePositionBounds();
+		// Pack the vertices [begin, end) and upload them to the bound vertex buffer.
+		void UploadPackedVertices(uint32_t begin, uint32_t end);
 	};
 
 } // namespace gp1::renderer::apis::opengl::mesh
@@ -4,9 +4,15 @@
 
 #pragma once
 
+#include "Engine/Renderer/Mesh/Meshlet.h"
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Utility/Logger.h"
 
+#include <glm.hpp>
+
+#include <unordered_map>
+#include <vector>
+
 namespace gp1::renderer
 {
 	namespace mesh
@@ -14,8 +20,18 @@ namespace gp1::renderer
 		struct StaticMesh;
 	}
 
+	namespace culling
+	{
+		struct StaticInstanceGroup;
+	}
+
 	namespace apis::opengl
 	{
+		namespace buffer
+		{
+			class OpenGLRingBuffer;
+		}
+
 		namespace mesh
 		{
 			struct OpenGLMeshData;
@@ -26,6 +42,11 @@ namespace gp1::renderer
 			class OpenGLMaterialData;
 		}
 
+		namespace texture
+		{
+			class OpenGLTextureUploader;
+		}
+
 		class OpenGLRenderer : public Renderer
 		{
 		public:
@@ -39,6 +60,19 @@ namespace gp1::renderer
 
 			uint32_t GetMaxTextureUnits() const;
 
+			// Get the ring buffer per frame data is streamed through.
+			buffer::OpenGLRingBuffer* GetStreamBuffer() const;
+			// Get the uploader texture data is streamed through.
+			texture::OpenGLTextureUploader* GetTextureUploader() const;
+
+			// Get the meshlet culling stats of the last rendered frame.
+			const renderer::mesh::MeshletCullingStats& GetMeshletCullingStats() const;
+			// Get the screen size in pixels of what is being drawn, the streamed textures it samples are requested at it.
+			float GetTextureScreenSize() const;
+
+			virtual bool SupportsCompute() const override;
+			virtual void DispatchCompute(renderer::shader::Material* material, uint32_t numGroupsX, uint32_t numGroupsY = 1, uint32_t numGroupsZ = 1) override;
+
 		protected:
 			virtual void InitRenderer() override;
 			virtual void DeInitRenderer() override;
@@ -47,10 +81,25 @@ namespace gp1::renderer
 		private:
 			// Render an entity.
 			void RenderEntity(scene::Entity* entity);
+			// Set the uniforms the material needs to decode the mesh's vertices.
+			void SetMeshUniforms(renderer::mesh::Mesh* mesh, renderer::shader::Material* material);
 			// Render a mesh with a material.
 			void RenderMeshWithMaterial(renderer::mesh::Mesh* mesh, renderer::shader::Material* material);
 			// Render a mesh.
 			void RenderMesh(renderer::mesh::Mesh* mesh);
+			// Cull the mesh's meshlets and render the visible ones.
+			void RenderMeshlets(renderer::mesh::Mesh* mesh, const glm::fmat4& transformationMatrix, scene::Camera* camera);
+			// Cull the instances of a static instance group on the gpu and render the visible ones.
+			void RenderStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group, scene::Camera* camera);
+			// Write the joint palette of every posed entity into one buffer range and bind it for the whole frame.
+			void PrepareJointPalettes(scene::Scene* scene);
+			// Estimate the screen size in pixels the bounding sphere is drawn at with the transformation matrix.
+			float EstimateScreenSize(const glm::fvec4& boundingSphere, const glm::fmat4& transformationMatrix, scene::Camera* camera) const;
+
+			// Build the hierarchical depth buffer from this frame's depth buffer, used for occlusion culling in the next frame.
+			void BuildHiZ(uint32_t width, uint32_t height, const glm::fmat4& projectionViewMatrix);
+			// Clean up the hierarchical depth buffer.
+			void CleanUpHiZ();
 
 			// Set up data for the material.
 			void PreMaterial(renderer::shader::Material* material);
@@ -59,8 +108,40 @@ namespace gp1::renderer
 
 			static void ErrorMessageCallback(uint32_t source, uint32_t type, uint32_t id, uint32_t severity, int32_t length, const char* message, const void* userParam);
 
+		public:
+			bool m_UseHiZOcclusion = false; // Should the gpu culling pass also test against last frame's hierarchical depth buffer.
+			bool m_CullMeshlets    = true;  // Should meshes with meshlets have their meshlets culled on the cpu.
+
 		private:
-			uint32_t m_MaxTextureUnits = 0; // The max texture units that can be used.
+			uint32_t m_MaxTextureUnits = 0;     // The max texture units that can be used.
+			bool     m_SupportsCompute = false; // Does the context support compute shaders and shader storage buffers.
+
+			buffer::OpenGLRingBuffer* m_StreamBuffer           = nullptr; // The ring buffer per frame data is streamed through.
+			uint32_t                  m_StorageBufferAlignment = 16;      // The offset alignment of shader storage buffer bindings.
+
+			texture::OpenGLTextureUploader* m_TextureUploader = nullptr; // The uploader texture data is streamed through.
+
+			renderer::mesh::MeshletCullingStats       m_MeshletCullingStats;     // The meshlet culling stats of the current frame.
+			renderer::mesh::MeshletCullingStats       m_LastMeshletCullingStats; // The meshlet culling stats of the last rendered frame.
+			std::vector<renderer::mesh::MeshletRange> m_MeshletRanges;           // The visible index ranges of the meshlets being rendered.
+			std::vector<int32_t>                      m_MultiDrawCounts;         // The index counts passed to glMultiDrawElements.
+			std::vector<const void*>                  m_MultiDrawOffsets;        // The index offsets passed to glMultiDrawElements.
+
+			std::unordered_map<const scene::Entity*, uint32_t> m_JointPaletteOffsets; // The first joint matrix of every posed entity's palette this frame.
+
+			uint32_t m_ViewportHeight    = 0;    // The height of the viewport being rendered to.
+			float    m_TextureScreenSize = 0.0f; // The screen size in pixels of what is being drawn.
+
+			renderer::shader::Material* m_CullingMaterial = nullptr; // The material used to dispatch the culling pass.
+			renderer::shader::Material* m_HiZMaterial     = nullptr; // The material used to build the hierarchical depth buffer.
+
+			uint32_t   m_DepthTexture                 = 0;                // The copy of this frame's depth buffer.
+			uint32_t   m_HiZTexture                   = 0;                // The hierarchical depth buffer.
+			uint32_t   m_HiZWidth                     = 0;                // The width of the hierarchical depth buffer.
+			uint32_t   m_HiZHeight                    = 0;                // The height of the hierarchical depth buffer.
+			uint32_t   m_HiZLevels                    = 0;                // The number of levels of the hierarchical depth buffer.
+			bool       m_HiZValid                     = false;            // Does the hierarchical depth buffer hold last frame's depth.
+			glm::fmat4 m_PreviousProjectionViewMatrix = glm::fmat4(1.0f); // The projection view matrix the hierarchical depth buffer was rendered with.
 
 		private:
 			static Logger s_Logger; // The logger this renderer uses.
@@ -11,6 +11,8 @@
 
 namespace gp1::renderer::apis::opengl::texture
 {
+	class OpenGLTextureUploader;
+
 	struct OpenGLTexture2DData : public OpenGLRendererData
 	{
 	public:
@@ -18,16 +20,21 @@ namespace gp1::renderer::apis::opengl::texture
 
 		virtual void CleanUp() override;
 
-		// Get the texture id.
-		uint32_t GetTextureID();
+		// Get the texture id, uploading the texture through the uploader if it is dirty.
+		uint32_t GetTextureID(OpenGLTextureUploader* uploader);
 
-		// Initialize the opengl data.
-		void InitGLData();
+		// Allocate immutable storage for the texture and upload its data through the uploader.
+		void InitGLData(OpenGLTextureUploader* uploader);
 
 		friend OpenGLRenderer;
 
+	private:
+		// Set the wrapping, filter and level of detail settings of the bound texture.
+		void SetSamplerParameters(renderer::texture::Texture2D* texture);
+
 	private:
 		uint32_t m_TextureID = 0; // The texture id.
+		uint32_t m_BaseLevel = 0; // The level of the texture the allocated levels start at.
 	};
 
 } // namespace gp1::renderer::apis::opengl::texture
@@ -11,6 +11,8 @@
 
 namespace gp1::renderer::apis::opengl::texture
 {
+	class OpenGLTextureUploader;
+
 	struct OpenGLTexture3DData : public OpenGLRendererData
 	{
 	public:
@@ -18,14 +20,18 @@ namespace gp1::renderer::apis::opengl::texture
 
 		virtual void CleanUp() override;
 
-		// Get the texture id.
-		uint32_t GetTextureID();
+		// Get the texture id, uploading the texture through the uploader if it is dirty and writing its pending updates otherwise.
+		uint32_t GetTextureID(OpenGLTextureUploader* uploader);
 
-		// Initialize the opengl data.
-		void InitGLData();
+		// Allocate immutable storage for the texture and upload its data and pending updates through the uploader.
+		void InitGLData(OpenGLTextureUploader* uploader);
 
 		friend OpenGLRenderer;
 
+	private:
+		// Write the pending updates to the bound texture through the uploader, compressed textures can't be updated.
+		void WriteUpdates(OpenGLTextureUploader* uploader);
+
 	private:
 		uint32_t m_TextureID = 0; // The texture id.
 	};
@@ -8,6 +8,20 @@
 
 #include <glad/glad.h>
 
+#include <stdint.h>
+
+// The s3tc formats come from an extension glad wasn't generated with, every desktop driver supports them.
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT        0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT       0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT       0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT       0x83F3
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
 namespace gp1::renderer::apis::opengl::textureCommon
 {
 	// Get the opengl texture wrap value.
@@ -18,5 +32,17 @@ namespace gp1::renderer::apis::opengl::textureCommon
 	GLenum GetTextureFormat(renderer::texture::TextureFormat format);
 	// Get the opengl texture type value.
 	GLenum GetTextureType(renderer::texture::TextureDataType type);
+	// Get the sized opengl internal format the texture is stored in, the compressed format for block compressed textures.
+	GLenum GetTextureInternalFormat(renderer::texture::TextureFormat format, renderer::texture::TextureDataType type);
+
+	// Does the filter sample mipmaps.
+	bool UsesMipmaps(renderer::texture::TextureFilter filter);
+	// Get the number of levels to allocate, the full chain down to 1x1 capped by the max level if the filter samples mipmaps.
+	// The depth is only halved per level for 3D textures, so pass 1 for arrays and cube maps.
+	uint32_t GetLevelCount(renderer::texture::TextureFilter filter, uint32_t maxLevel, uint32_t width, uint32_t height, uint32_t depth = 1);
+
+	// Allocate immutable storage for the bound texture, falls back to allocating every level with glTexImage* before opengl 4.2.
+	// The format and type are only used by the fallback.
+	void AllocateTextureStorage(GLenum target, uint32_t levels, GLenum internalFormat, uint32_t width, uint32_t height, uint32_t depth, GLenum format, GLenum type);
 
 } // namespace gp1::renderer::apis::opengl::textureCommon
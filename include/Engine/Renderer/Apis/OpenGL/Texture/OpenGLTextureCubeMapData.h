@@ -9,6 +9,8 @@
 
 namespace gp1::renderer::apis::opengl::texture
 {
+	class OpenGLTextureUploader;
+
 	struct OpenGLTextureCubeMapData : public OpenGLRendererData
 	{
 	public:
@@ -16,11 +18,11 @@ namespace gp1::renderer::apis::opengl::texture
 
 		virtual void CleanUp() override;
 
-		// Get the texture id.
-		uint32_t GetTextureID();
+		// Get the texture id, uploading the texture through the uploader if it is dirty.
+		uint32_t GetTextureID(OpenGLTextureUploader* uploader);
 
-		// Initialize the opengl data.
-		void InitGLData();
+		// Allocate immutable storage for the texture and upload its data through the uploader.
+		void InitGLData(OpenGLTextureUploader* uploader);
 
 		friend OpenGLRenderer;
 
@@ -0,0 +1,101 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Utility/Logger.h"
+
+#include <glad/glad.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::apis::opengl::texture
+{
+	// A region of one level of the bound texture and the tightly packed pixels to write to it.
+	// Compressed pixels are rows of 4x4 blocks, so the region has to start on a block.
+	struct TextureUpload
+	{
+	public:
+		GLenum      m_Target    = GL_TEXTURE_2D;    // The target the texture is bound to, or the cube map face.
+		uint32_t    m_Level     = 0;                // The level to write.
+		uint32_t    m_X         = 0;                // The first column of the region.
+		uint32_t    m_Y         = 0;                // The first row of the region.
+		uint32_t    m_Width     = 0;                // The width of the region.
+		uint32_t    m_Height    = 0;                // The height of the region.
+		uint32_t    m_Depth     = 1;                // The depth of the region, or the number of array layers.
+		uint32_t    m_Layer     = 0;                // The first slice or array layer of the region.
+		GLenum      m_Format    = GL_RGBA;          // The format of the pixels, the compressed internal format of compressed pixels.
+		GLenum      m_Type      = GL_UNSIGNED_BYTE; // The type of the pixels.
+		uint32_t    m_PixelSize = 4;                // The bytes of one pixel.
+		uint32_t    m_BlockSize = 0;                // The bytes of one 4x4 block of compressed pixels, 0 if the pixels aren't compressed.
+		const void* m_Data      = nullptr;          // The pixels.
+	};
+
+	struct TextureUploaderStats
+	{
+	public:
+		uint64_t m_Uploads       = 0;   // The number of regions uploaded.
+		uint64_t m_Chunks        = 0;   // The number of copies through the pixel buffers.
+		uint64_t m_BytesUploaded = 0;   // The total number of bytes uploaded.
+		uint64_t m_Stalls        = 0;   // The number of times the cpu had to wait for the gpu to release a pixel buffer.
+		double   m_StallTime     = 0.0; // The total time spent waiting for the gpu in milliseconds.
+		uint32_t m_Buffers       = 0;   // The number of pixel buffers in the pool.
+	};
+
+	// Streams texture data to the gpu through a pool of pixel buffers.
+	// The pixels are copied into a pixel buffer and the texture is updated from it, so the driver copies into the texture
+	// asynchronously instead of blocking until the pixels have been read. Large images are split into chunks of rows, so
+	// copying the next chunk overlaps with the gpu reading the last one. Each buffer is fenced and only reused once the gpu is done with it.
+	class OpenGLTextureUploader
+	{
+	public:
+		OpenGLTextureUploader(uint64_t bufferSize = 4 << 20, uint32_t maxBuffers = 4);
+		~OpenGLTextureUploader();
+
+		// Delete the pixel buffers.
+		void CleanUp();
+
+		// Write the pixels to the region of the bound texture.
+		void Upload(const TextureUpload& upload);
+
+		// Log the stalls of the frame, if there were any.
+		void EndFrame();
+
+		// Get the upload stats.
+		const TextureUploaderStats& GetStats() const;
+
+	private:
+		struct PixelBuffer
+		{
+		public:
+			uint32_t m_Buffer = 0;       // The gl buffer.
+			uint64_t m_Size   = 0;       // The size of the gl buffer.
+			GLsync   m_Fence  = nullptr; // The fence of the last update that read from the buffer.
+		};
+
+	private:
+		// Get a pixel buffer the gpu is done with holding at least size bytes, bound to the unpack target.
+		PixelBuffer& AcquireBuffer(uint64_t size);
+		// Copy the rows or slices of the region through a pixel buffer and update the texture from it.
+		void CopyChunk(const TextureUpload& upload, uint32_t y, uint32_t height, uint32_t layer, uint32_t depth, const uint8_t* pixels, uint64_t size);
+		// Update the rows or slices of the region from the bound pixel buffer or client memory.
+		void TexSubImage(const TextureUpload& upload, uint32_t y, uint32_t height, uint32_t layer, uint32_t depth, const void* pixels, uint64_t size);
+
+	private:
+		uint64_t m_BufferSize; // The size of the pixel buffers, buffers grow to fit rows larger than this.
+		uint32_t m_MaxBuffers; // The most pixel buffers in the pool.
+
+		std::vector<PixelBuffer> m_Buffers;        // The pixel buffers.
+		uint32_t                 m_NextBuffer = 0; // The pixel buffer to use next.
+
+		TextureUploaderStats m_Stats;                // The upload stats.
+		uint32_t             m_FrameStalls    = 0;   // The number of stalls this frame.
+		double               m_FrameStallTime = 0.0; // The time spent stalling this frame in milliseconds.
+
+	private:
+		static Logger s_Logger; // The logger texture uploaders use.
+	};
+
+} // namespace gp1::renderer::apis::opengl::texture
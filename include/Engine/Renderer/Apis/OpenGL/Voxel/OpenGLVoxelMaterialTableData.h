@@ -0,0 +1,52 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Apis/OpenGL/OpenGLRendererData.h"
+#include "Engine/Renderer/Voxel/VoxelMaterialTable.h"
+
+#include <glm.hpp>
+
+#include <stdint.h>
+
+namespace gp1::renderer::apis::opengl::voxel
+{
+	// The shader storage buffer bindings used by the voxel shaders, after the culling bindings.
+	namespace VoxelBufferBinding
+	{
+		constexpr const uint32_t MATERIALS = 3;
+	}; // namespace VoxelBufferBinding
+
+	// The std430 layout of one material in the shader storage buffer.
+	struct GPUVoxelMaterial
+	{
+	public:
+		glm::fvec4 m_Tint { 1.0f, 1.0f, 1.0f, 1.0f };     // The color the texture is multiplied by.
+		glm::fvec4 m_Emissive { 0.0f, 0.0f, 0.0f, 0.0f }; // The color added after lighting, w is unused.
+		uint32_t   m_TextureLayer = 0;                    // The layer of the texture array.
+		uint32_t   m_Flags        = 0;                    // The VoxelMaterialFlag bits.
+		uint32_t   m_Padding[2] { 0, 0 };                 // Pads the struct to the 16 byte std430 alignment.
+	};
+
+	struct OpenGLVoxelMaterialTableData : public OpenGLRendererData
+	{
+	public:
+		OpenGLVoxelMaterialTableData(renderer::voxel::VoxelMaterialTable* table);
+
+		virtual void CleanUp() override;
+
+		// Reupload the dirty materials.
+		void UpdateGLData();
+		// Bind the table to its shader storage binding.
+		void BindBuffer();
+
+		friend OpenGLRenderer;
+
+	private:
+		uint32_t m_Buffer   = 0; // The buffer holding every material.
+		uint32_t m_Capacity = 0; // The number of materials the buffer can hold.
+	};
+
+} // namespace gp1::renderer::apis::opengl::voxel
@@ -18,6 +18,9 @@ namespace gp1::renderer::apis::vulkan
 
 		virtual RendererData* CreateRendererData(Data* data) override;
 
+		virtual bool SupportsCompute() const override;
+		virtual void DispatchCompute(renderer::shader::Material* material, uint32_t numGroupsX, uint32_t numGroupsY = 1, uint32_t numGroupsZ = 1) override;
+
 	protected:
 		virtual void InitRenderer() override;
 		virtual void DeInitRenderer() override;
@@ -0,0 +1,75 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/RendererData.h"
+
+#include <glm.hpp>
+
+#include <vector>
+
+namespace gp1::renderer
+{
+	namespace mesh
+	{
+		struct StaticMesh;
+	}
+
+	namespace shader
+	{
+		struct Material;
+	}
+
+	namespace culling
+	{
+		// A group of static instances of one mesh drawn with one material.
+		// Visibility of every instance is decided on the gpu, so the cpu only uploads the transforms when they change.
+		struct StaticInstanceGroup : public Data
+		{
+		public:
+			StaticInstanceGroup(mesh::StaticMesh* mesh = nullptr, shader::Material* material = nullptr);
+
+			// Add an instance and grow the bounds to cover it.
+			void AddInstance(const glm::fmat4& transformationMatrix);
+			// Set the transform of an instance and grow the bounds to cover it.
+			// The bounds only shrink when they're recalculated, which happens once they've grown to twice their recalculated radius.
+			void SetInstanceTransform(uint32_t index, const glm::fmat4& transformationMatrix);
+
+			// Mark this group dirty for reupload, the bounds are recalculated as the transforms may have been changed directly.
+			void MarkDirty();
+			// Clears this group's dirtiness.
+			void ClearDirty();
+			// Is this group dirty.
+			bool IsDirty();
+
+			// Recalculate the bounding spheres if the group was marked dirty or the mesh's bounding sphere has changed.
+			// The mesh's bounds are calculated when it is uploaded, so it has to be uploaded first.
+			void UpdateBounds();
+			// Recalculate the bounding spheres from the mesh's bounding sphere and the transforms.
+			void RecalculateBounds();
+
+		public:
+			mesh::StaticMesh*       m_Mesh     = nullptr; // The mesh every instance uses.
+			shader::Material*       m_Material = nullptr; // The material every instance uses, its shader reads the visible transforms from a shader storage buffer.
+			std::vector<glm::fmat4> m_Transforms;         // The transformation matrix of every instance. (Call MarkDirty after changing them directly)
+			bool                    m_IsDynamic = false;  // Are the transforms rewritten every frame. (i.e. should they be streamed instead of kept in a dedicated buffer)
+
+			glm::fvec4 m_BoundingSphere { 0.0f, 0.0f, 0.0f, 0.0f };      // The mesh space bounding sphere of the mesh. (xyz = center, w = radius)
+			glm::fvec4 m_WorldBoundingSphere { 0.0f, 0.0f, 0.0f, 0.0f }; // A conservative world space bounding sphere of every instance. (xyz = center, w = radius)
+			float      m_MaxInstanceRadius = 0.0f;                       // The world space radius of the largest instance.
+
+		protected:
+			// Grow the world space bounding sphere to cover the instance.
+			void ExpandBounds(const glm::fmat4& transformationMatrix);
+
+		protected:
+			bool  m_Dirty              = true; // Should the instances be reuploaded.
+			bool  m_BoundsDirty        = true; // Should the bounds be recalculated.
+			float m_RecalculatedRadius = 0.0f; // The world space radius of the group as of the last recalculation.
+		};
+
+	} // namespace culling
+
+} // namespace gp1::renderer
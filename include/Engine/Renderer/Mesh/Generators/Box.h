@@ -0,0 +1,14 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// Generate a box with flat faces and put it inside the given mesh.
+	void GenerateBox(mesh::StaticMesh& mesh, const glm::fvec3& halfExtents);
+
+} // namespace gp1::renderer::meshGenerators
@@ -0,0 +1,14 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// Generate a unit sphere by projecting a cube with resolution by resolution quads per face and put it inside the given mesh.
+	void GenerateCubeSphere(mesh::StaticMesh& mesh, uint32_t resolution);
+
+} // namespace gp1::renderer::meshGenerators
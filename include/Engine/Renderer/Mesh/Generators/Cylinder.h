@@ -0,0 +1,14 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// Generate a cylinder along the y axis centered on the origin and put it inside the given mesh.
+	void GenerateCylinder(mesh::StaticMesh& mesh, uint32_t segments, float radius, float height, bool caps = true);
+
+} // namespace gp1::renderer::meshGenerators
@@ -0,0 +1,30 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// The functions below share one mesh between all requests with the same parameters.
+	// The meshes are owned by the cache and stay alive until ClearMeshCache is called.
+
+	// Get the shared icosphere with the given subdivisions.
+	mesh::StaticMesh* GetIcosphere(uint32_t subdivisions);
+	// Get the shared uv sphere with the given segments and rings.
+	mesh::StaticMesh* GetUVSphere(uint32_t segments, uint32_t rings);
+	// Get the shared cube sphere with the given resolution.
+	mesh::StaticMesh* GetCubeSphere(uint32_t resolution);
+	// Get the shared plane grid with the given size, columns and rows.
+	mesh::StaticMesh* GetPlaneGrid(const glm::fvec2& size, uint32_t columns, uint32_t rows);
+	// Get the shared box with the given half extents.
+	mesh::StaticMesh* GetBox(const glm::fvec3& halfExtents);
+	// Get the shared cylinder with the given segments, radius, height and caps.
+	mesh::StaticMesh* GetCylinder(uint32_t segments, float radius, float height, bool caps = true);
+
+	// Delete all shared meshes, has to happen before the renderer is deinitialized.
+	void ClearMeshCache();
+
+} // namespace gp1::renderer::meshGenerators
@@ -0,0 +1,14 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// Generate a grid of columns by rows quads on the xz plane facing +y and put it inside the given mesh.
+	void GeneratePlaneGrid(mesh::StaticMesh& mesh, const glm::fvec2& size, uint32_t columns, uint32_t rows);
+
+} // namespace gp1::renderer::meshGenerators
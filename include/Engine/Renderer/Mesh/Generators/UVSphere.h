@@ -0,0 +1,14 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// Generate a unit uv sphere with the given segments around and rings from pole to pole and put it inside the given mesh.
+	void GenerateUVSphere(mesh::StaticMesh& mesh, uint32_t segments, uint32_t rings);
+
+} // namespace gp1::renderer::meshGenerators
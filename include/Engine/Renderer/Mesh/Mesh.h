@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include "Engine/Renderer/Mesh/Meshlet.h"
 #include "Engine/Renderer/RendererData.h"
 
+#include <glm.hpp>
+
 #include <stdint.h>
 #include <type_traits>
 #include <vector>
@@ -38,6 +41,42 @@ namespace gp1::renderer::mesh
 		PATCHES
 	};
 
+	struct DirtyRange
+	{
+	public:
+		// Expand this range to also cover [first, first + count).
+		void Expand(uint32_t first, uint32_t count);
+		// Reset this range to be empty.
+		void Clear();
+		// Is this range empty.
+		bool IsEmpty() const;
+
+	public:
+		uint32_t m_Begin = 0; // The first dirty element.
+		uint32_t m_End   = 0; // One past the last dirty element.
+	};
+
+	// A few disjoint dirty ranges, so edits far apart don't upload everything between them.
+	struct DirtyRanges
+	{
+	public:
+		static constexpr uint32_t s_MaxRanges = 8; // The most ranges kept, past that the closest ranges are merged.
+
+	public:
+		// Add [first, first + count) to the ranges, merging it with the ranges it overlaps or touches.
+		void Expand(uint32_t first, uint32_t count);
+		// Remove every range.
+		void Clear();
+		// Are there no ranges.
+		bool IsEmpty() const;
+
+		// Get the ranges, sorted by their first element.
+		const std::vector<DirtyRange>& GetRanges() const;
+
+	private:
+		std::vector<DirtyRange> m_Ranges; // The sorted and disjoint ranges.
+	};
+
 	struct Mesh : public Data
 	{
 	public:
@@ -47,17 +86,39 @@ namespace gp1::renderer::mesh
 		{
 		}
 
-		// Mark this mesh dirty for recreation.
+		// Mark this mesh dirty for a full upload.
 		void MarkDirty();
+		// Mark the vertices [first, first + count) dirty for upload.
+		// Meshes that aren't dynamic don't keep their vertices, so they're marked fully dirty instead.
+		void MarkVerticesDirty(uint32_t first, uint32_t count);
+		// Mark the indices [first, first + count) dirty for upload.
+		// Meshes that aren't dynamic don't keep their indices, so they're marked fully dirty instead.
+		void MarkIndicesDirty(uint32_t first, uint32_t count);
 		// Clears this mesh's dirtiness.
 		void ClearDirty();
 		// Is this mesh dirty.
 		bool IsDirty();
+		// Does this mesh have dirty vertex or index ranges.
+		bool HasDirtyRanges();
+
+		// Get the dirty vertex ranges.
+		const DirtyRanges& GetDirtyVertices() const;
+		// Get the dirty index ranges.
+		const DirtyRanges& GetDirtyIndices() const;
 
 		// Is the mesh editable.
 		bool IsEditable();
 		// Is the mesh dynamic.
 		bool IsDynamic();
+		// Set whether the mesh is dynamic, only dynamic meshes keep their vertices and indices for range updates.
+		void SetDynamic(bool dynamic);
+
+		// Recalculate the bounding sphere from every vertex, done when the mesh is fully uploaded.
+		// Meshes that don't know their vertex layout keep the bounding sphere they were given.
+		virtual void RecalculateBounds();
+		// Grow the bounding sphere to also cover the vertices [begin, end), done when a range is uploaded. It only shrinks when the bounds are recalculated.
+		// Meshes that don't know their vertex layout keep the bounding sphere they were given.
+		virtual void ExpandBounds(uint32_t begin, uint32_t end);
 
 	public:
 		std::vector<uint32_t> m_Indices; // This mesh's indices.
@@ -65,10 +126,54 @@ namespace gp1::renderer::mesh
 		RenderMode m_RenderMode = RenderMode::TRIANGLES; // The render mode.
 		float      m_LineWidth  = 1.0f;                  // The line width of this mesh if rendered with points or lines.
 
+		bool m_CompressVertices = false; // Should the vertices and indices be packed into smaller formats when uploaded. (Its shader has to decode them)
+
+		std::vector<Meshlet> m_Meshlets; // This mesh's meshlets, culled individually when not empty. (Kept after initialization of the GL data)
+
+		glm::fvec4 m_BoundingSphere { 0.0f, 0.0f, 0.0f, 0.0f }; // The mesh space bounding sphere of the vertices as of the last upload. (xyz = center, w = radius)
+
 	protected:
-		bool m_Dirty     = true;  // Should this mesh be recreated.
-		bool m_Editable  = true;  // Is this mesh editable.
-		bool m_IsDynamic = false; // Is this mesh dynamic. (i.e. should the vertices and indices be kept after initialization of the GL data)
+		// Calculate the bounding sphere of the vertices' positions.
+		template <typename Vertex>
+		void CalculateBoundingSphere(const std::vector<Vertex>& vertices)
+		{
+			if (vertices.empty())
+			{
+				this->m_BoundingSphere = { 0.0f, 0.0f, 0.0f, 0.0f };
+				return;
+			}
+
+			glm::fvec3 min = vertices[0].position;
+			glm::fvec3 max = min;
+			for (const Vertex& vertex : vertices)
+			{
+				min = glm::min(min, vertex.position);
+				max = glm::max(max, vertex.position);
+			}
+
+			glm::fvec3 center = (min + max) * 0.5f;
+			float      radius = 0.0f;
+			for (const Vertex& vertex : vertices)
+				radius = glm::max(radius, glm::length(vertex.position - center));
+			this->m_BoundingSphere = { center, radius };
+		}
+
+		// Grow the bounding sphere around its center to cover the positions of the vertices [begin, end).
+		template <typename Vertex>
+		void ExpandBoundingSphere(const std::vector<Vertex>& vertices, uint32_t begin, uint32_t end)
+		{
+			glm::fvec3 center = glm::fvec3(this->m_BoundingSphere);
+			float      radius = this->m_BoundingSphere.w;
+			for (uint32_t i = begin; i < end && i < vertices.size(); i++)
+				radius = glm::max(radius, glm::length(vertices[i].position - center));
+			this->m_BoundingSphere.w = radius;
+		}
+
+		bool        m_Dirty     = true;  // Should this mesh be fully uploaded.
+		bool        m_Editable  = true;  // Is this mesh editable.
+		bool        m_IsDynamic = false; // Is this mesh dynamic. (i.e. should the vertices and indices be kept after initialization of the GL data)
+		DirtyRanges m_DirtyVertices;     // The vertices that have changed since the last upload.
+		DirtyRanges m_DirtyIndices;      // The indices that have changed since the last upload.
 	};
 
 } // namespace gp1::renderer::mesh
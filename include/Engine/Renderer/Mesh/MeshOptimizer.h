@@ -0,0 +1,63 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/SkeletalMesh.h"
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::meshOptimizer
+{
+	struct VertexCacheStats
+	{
+	public:
+		uint32_t m_TransformedVertices = 0;    // The number of vertices the simulated cache had to transform.
+		float    m_ACMR                = 0.0f; // The average number of transformed vertices per triangle. (0.5 is the best possible, 3 the worst)
+		float    m_ATVR                = 0.0f; // The number of transformed vertices per referenced vertex. (1 is the best possible)
+	};
+
+	struct OptimizeStats
+	{
+	public:
+		VertexCacheStats m_Before;               // The vertex cache stats before optimizing.
+		VertexCacheStats m_After;                // The vertex cache stats after optimizing.
+		uint32_t         m_VerticesBefore = 0;   // The number of vertices before welding.
+		uint32_t         m_VerticesAfter  = 0;   // The number of vertices after welding and dropping unreferenced ones.
+		double           m_WeldTime       = 0.0; // The time spent welding in milliseconds.
+		double           m_CacheTime      = 0.0; // The time spent reordering for the vertex cache in milliseconds.
+		double           m_OverdrawTime   = 0.0; // The time spent ordering clusters for overdraw in milliseconds.
+		double           m_FetchTime      = 0.0; // The time spent remapping for vertex fetch in milliseconds.
+	};
+
+	// Find the unique vertices by comparing their bytes, remap receives the new index of every vertex.
+	// Returns the number of unique vertices.
+	uint32_t WeldVertices(std::vector<uint32_t>& remap, const void* vertices, size_t vertexCount, size_t vertexSize);
+	// Reorder the triangles for the post transform vertex cache using Forsyth's algorithm.
+	void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount);
+	// Split the triangles into clusters at vertex cache restarts and order the clusters so outwards facing ones are drawn first.
+	// Clusters are only split further when the split keeps their ACMR within threshold of the unsplit cluster.
+	void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const void* vertices, size_t vertexCount, size_t vertexStride, float threshold = 1.05f);
+	// Number the vertices in the order they are first referenced, remap receives the new index of every vertex or ~0U if it isn't referenced.
+	// Returns the number of referenced vertices.
+	uint32_t OptimizeVertexFetchRemap(std::vector<uint32_t>& remap, const uint32_t* indices, size_t indexCount, size_t vertexCount);
+	// Simulate a fifo vertex cache of the given size.
+	VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = 16);
+
+	// Weld, reorder for the vertex cache, overdraw and vertex fetch.
+	// Only meshes rendered with RenderMode::TRIANGLES that still have their vertices are optimized.
+	OptimizeStats OptimizeMesh(mesh::StaticMesh& mesh);
+	// Weld, reorder for the vertex cache, overdraw and vertex fetch.
+	// Only meshes rendered with RenderMode::TRIANGLES that still have their vertices are optimized.
+	OptimizeStats OptimizeMesh(mesh::SkeletalMesh& mesh);
+
+	// Split the triangles into meshlets of at most maxVertices unique vertices and maxTriangles triangles, following the index order.
+	// The meshlets cover contiguous index ranges, so optimize the mesh first and rebuild the meshlets whenever its indices change.
+	// Only meshes rendered with RenderMode::TRIANGLES that still have their vertices get meshlets.
+	void BuildMeshlets(mesh::StaticMesh& mesh, uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+
+} // namespace gp1::renderer::meshOptimizer
@@ -0,0 +1,52 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::mesh
+{
+	// A small cluster of triangles covering a contiguous range of its mesh's indices.
+	struct Meshlet
+	{
+	public:
+		glm::fvec4 m_BoundingSphere { 0.0f, 0.0f, 0.0f, 0.0f }; // The mesh space bounding sphere of the triangles. (xyz = center, w = radius)
+		glm::fvec3 m_ConeAxis { 0.0f, 0.0f, 1.0f };             // The average direction the triangles face.
+		float      m_ConeCutoff  = 1.0f;                        // The sine of the largest angle between the axis and a triangle's normal, 1 if the meshlet can't be backface culled.
+		uint32_t   m_FirstIndex  = 0;                           // The first index of the meshlet.
+		uint32_t   m_IndexCount  = 0;                           // The number of indices of the meshlet.
+		uint32_t   m_VertexCount = 0;                           // The number of unique vertices the meshlet references.
+	};
+
+	struct MeshletRange
+	{
+	public:
+		uint32_t m_FirstIndex = 0; // The first index of the range.
+		uint32_t m_IndexCount = 0; // The number of indices in the range.
+	};
+
+	struct MeshletCullingStats
+	{
+	public:
+		// Reset the stats to zero.
+		void Reset();
+		// Get the fraction of triangles that were rejected.
+		float GetRejectedFraction() const;
+
+	public:
+		uint64_t m_Meshlets          = 0; // The number of meshlets tested.
+		uint64_t m_FrustumCulled     = 0; // The number of meshlets outside the frustum.
+		uint64_t m_BackfaceCulled    = 0; // The number of meshlets facing away from the camera.
+		uint64_t m_Triangles         = 0; // The number of triangles tested.
+		uint64_t m_RejectedTriangles = 0; // The number of triangles in culled meshlets.
+	};
+
+	// Cull the meshlets against the frustum and their normal cones, the visible meshlets are merged into as few index ranges as possible.
+	void CullMeshlets(const std::vector<Meshlet>& meshlets, const glm::fmat4& transformationMatrix, const glm::fmat4& projectionViewMatrix, const glm::fvec3& cameraPosition, std::vector<MeshletRange>& ranges, MeshletCullingStats& stats);
+
+} // namespace gp1::renderer::mesh
@@ -2,6 +2,8 @@
 //	Created by MarcasRealAccount on 30. Oct. 2020
 //
 
+#pragma once
+
 #include "Engine/Renderer/Mesh/Mesh.h"
 
 #include <glm.hpp>
@@ -21,6 +23,9 @@ namespace gp1::renderer::mesh
 	public:
 		StaticMesh();
 
+		virtual void RecalculateBounds() override;
+		virtual void ExpandBounds(uint32_t begin, uint32_t end) override;
+
 	public:
 		std::vector<StaticMeshVertex> m_Vertices; // This mesh's vertices.
 	};
@@ -2,6 +2,8 @@
 //	Created by MarcasRealAccount on 30. Oct. 2020
 //
 
+#pragma once
+
 #include "Engine/Renderer/Mesh/Mesh.h"
 
 #include <glm.hpp>
@@ -22,6 +24,9 @@ namespace gp1::renderer::mesh
 	public:
 		StaticVoxelMesh();
 
+		virtual void RecalculateBounds() override;
+		virtual void ExpandBounds(uint32_t begin, uint32_t end) override;
+
 	public:
 		std::vector<StaticVoxelMeshVertex> m_Vertices; // This mesh's vertices.
 	};
@@ -0,0 +1,51 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+
+#include <stdint.h>
+
+namespace gp1::renderer::mesh
+{
+	struct PackedVertex
+	{
+	public:
+		uint16_t m_Position[4] { 0, 0, 0, 0 }; // The position quantized to 16 bit relative to the mesh bounds, the fourth value is padding.
+		int16_t  m_Normal[2] { 0, 0 };         // The octahedral encoded normal.
+		uint16_t m_UV[2] { 0, 0 };             // The uv as half floats.
+	};
+
+	struct PackedVoxelVertex
+	{
+	public:
+		PackedVertex m_Vertex;        // The packed position, normal and uv.
+		uint32_t     m_SSBOIndex = 0; // The texture this vertex uses.
+	};
+
+	struct PositionBounds
+	{
+	public:
+		// Expand the bounds to include the position.
+		void Expand(const glm::fvec3& position);
+		// Does the bounds contain the position.
+		bool Contains(const glm::fvec3& position) const;
+		// Get the matrix that turns normalized quantized positions back into mesh space positions.
+		glm::fmat4 GetDequantizationMatrix() const;
+
+	public:
+		glm::fvec3 m_Min { 0.0f, 0.0f, 0.0f }; // The smallest position.
+		glm::fvec3 m_Max { 0.0f, 0.0f, 0.0f }; // The largest position.
+		bool       m_Empty = true;             // Has no position been added yet.
+	};
+
+	// Convert a float to a half float, rounding to nearest even.
+	uint16_t PackHalf(float value);
+	// Encode a normal into two signed normalized 16 bit values using the octahedral mapping.
+	void PackOctahedral(const glm::fvec3& normal, int16_t (&packed)[2]);
+	// Pack a vertex with its position quantized relative to the bounds.
+	void PackVertex(const glm::fvec3& position, const glm::fvec3& normal, const glm::fvec2& uv, const PositionBounds& bounds, PackedVertex& packed);
+
+} // namespace gp1::renderer::mesh
@@ -28,6 +28,11 @@ namespace gp1
 			class DebugRenderer;
 		}
 
+		namespace shader
+		{
+			struct Material;
+		}
+
 		struct RendererData;
 		struct Data;
 
@@ -57,6 +62,12 @@ namespace gp1
 			// Create renderer data that is associated with the given data.
 			virtual RendererData* CreateRendererData(Data* data) = 0;
 
+			// Does this renderer support compute dispatches.
+			virtual bool SupportsCompute() const = 0;
+			// Dispatch the compute shader of the given material, the material's uniforms are set before dispatching.
+			// All shader storage, command and texture writes are visible to subsequent draws and dispatches.
+			virtual void DispatchCompute(shader::Material* material, uint32_t numGroupsX, uint32_t numGroupsY = 1, uint32_t numGroupsZ = 1) = 0;
+
 		protected:
 			// Initialize the renderer.
 			virtual void InitRenderer() = 0;
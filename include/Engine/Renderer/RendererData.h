@@ -27,6 +27,8 @@ namespace gp1::renderer
 
 		// Get's the renderer data of the specified type.
 		template <typename T> T* GetRendererData(Renderer* renderer);
+		// Has renderer data been created for this data.
+		bool HasRendererData() const;
 
 		friend RendererData;
 
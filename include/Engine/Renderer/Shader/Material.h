@@ -9,6 +9,13 @@
 #include <any>
 #include <unordered_map>
 
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+	struct TextureAtlasRegion;
+	class BrickedVolume;
+} // namespace gp1::renderer::texture
+
 namespace gp1::renderer::shader
 {
 	struct Shader;
@@ -77,6 +84,15 @@ namespace gp1::renderer::shader
 			return nullptr;
 		}
 
+		// Set the 2D texture uniform to the texture, and its "<id>Transform" vec4 uniform to the identity uv transform if the shader has one.
+		void SetTexture(const std::string& id, texture::Texture2D* texture);
+		// Set the 2D texture uniform to the atlas page of the region, and its "<id>Transform" vec4 uniform to the region's uv transform.
+		// Shaders that map their uvs with uv * transform.xy + transform.zw sample the region as if it was the texture on its own.
+		void SetTexture(const std::string& id, const texture::TextureAtlasRegion& region);
+		// Set the 3D texture uniform to the pool of the volume, its "<id>Indirection" 3D texture uniform to the indirection texture
+		// and its "<id>Volume" vec4 uniform to the width, height and depth of the volume and the brick size, see BrickedVolume.
+		void SetTexture(const std::string& id, const texture::BrickedVolume& volume);
+
 		// Gets all the uniforms this material has.
 		const std::unordered_map<std::string, std::any>& GetUniforms() const;
 
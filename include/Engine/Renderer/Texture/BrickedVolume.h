@@ -0,0 +1,125 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	struct Texture3D;
+
+	struct BrickedVolumeSettings
+	{
+	public:
+		uint32_t        m_BrickSize = 8;                              // The width, height and depth of every brick, 8 or 16.
+		TextureFormat   m_Format    = TextureFormat::RED;             // The format of the texels, can't be compressed.
+		TextureDataType m_Type      = TextureDataType::UNSIGNED_BYTE; // The data type of the texels.
+		uint32_t        m_PoolWidth = 16;                             // The bricks along the width and height of the pool, its depth grows to fit the stored bricks.
+	};
+
+	struct BrickedVolumeStats
+	{
+	public:
+		uint32_t m_Bricks          = 0; // The number of bricks covering the volume.
+		uint32_t m_StoredBricks    = 0; // The number of bricks that aren't empty.
+		uint32_t m_RunLengthBricks = 0; // The number of stored bricks that are run length encoded.
+		uint64_t m_DenseSize       = 0; // The bytes the volume would take as a plain 3D texture.
+		uint64_t m_StoredSize      = 0; // The bytes of the stored bricks.
+		uint64_t m_PoolSize        = 0; // The bytes of the pool texture.
+		uint64_t m_UploadedBricks  = 0; // The total number of bricks written to the pool.
+		uint32_t m_PendingBricks   = 0; // The number of dirty bricks waiting for the next update.
+	};
+
+	// A sparse 3D texture split into bricks, where only bricks with texels other than zero are stored.
+	// Stored bricks are run length encoded when that makes them smaller and are only decoded to be written, read or uploaded.
+	// On the gpu the stored bricks are packed into slots of a pool texture with a texel of border copied from their neighbours,
+	// so filtering across bricks matches the dense volume. The indirection texture has a texel per brick holding the slot of the brick
+	// in xyz and 255 in alpha, or zero for empty bricks. A shader samples the texel at p (in texels of the volume) with:
+	//   entry = texelFetch(indirection, ivec3(p / brickSize), 0); if (entry.a == 0) the texel is zero, otherwise
+	//   texture(pool, (round(entry.xyz * 255) * (brickSize + 2) + 1 + p - floor(p / brickSize) * brickSize) / textureSize(pool, 0))
+	// Changes only upload the bricks they touch and the indirection texels that changed, as updates of the textures.
+	class BrickedVolume
+	{
+	public:
+		BrickedVolume(uint32_t width, uint32_t height, uint32_t depth, const BrickedVolumeSettings& settings = {});
+		~BrickedVolume();
+
+		// Write the tightly packed texels to the region, which has to be inside the volume. The bricks it touches are encoded again and marked dirty.
+		void Write(uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const void* texels);
+		// Write the base level of the texture, returns false if it doesn't match the size, format and type of the volume.
+		bool Write(const Texture3D& texture);
+		// Read the region, which has to be inside the volume, into tightly packed texels.
+		void Read(uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, void* texels) const;
+		// Queue the dirty bricks and the indirection texels that changed as updates of the pool and indirection textures.
+		// The pool grows when the stored bricks don't fit, which recreates it and uploads every stored brick again.
+		void Update();
+
+		// Get the pool texture holding the stored bricks.
+		Texture3D* GetPool() const;
+		// Get the indirection texture holding the slot of every brick.
+		Texture3D* GetIndirection() const;
+		// Get the width of the volume.
+		uint32_t GetWidth() const;
+		// Get the height of the volume.
+		uint32_t GetHeight() const;
+		// Get the depth of the volume.
+		uint32_t GetDepth() const;
+		// Get the settings.
+		const BrickedVolumeSettings& GetSettings() const;
+		// Get the stats.
+		BrickedVolumeStats GetStats() const;
+
+	private:
+		enum class BrickEncoding : uint8_t
+		{
+			RAW,       // The texels as they are.
+			RUN_LENGTH // Packets of a count byte followed by texels, counts below 128 are count + 1 texels, others repeat one texel count - 126 times.
+		};
+
+		struct Brick
+		{
+		public:
+			std::vector<uint8_t> m_Data;                          // The encoded texels.
+			BrickEncoding        m_Encoding = BrickEncoding::RAW; // How the texels are encoded.
+			uint32_t             m_Slot     = ~0U;                // The slot of the pool the brick is uploaded to, ~0U before it has one.
+		};
+
+	private:
+		// Get the index of the brick.
+		uint32_t GetBrickIndex(uint32_t x, uint32_t y, uint32_t z) const;
+		// Decode the stored brick into its texels.
+		void DecodeBrick(const Brick& brick, uint8_t* texels) const;
+		// Encode the texels of a brick, returns false if they are all zero.
+		bool EncodeBrick(const uint8_t* texels, Brick& brick) const;
+		// Mark the brick dirty.
+		void MarkBrickDirty(uint32_t index);
+		// Grow the pool to fit the slots, returns false if it can't grow that far.
+		bool GrowPool(uint32_t slots);
+
+	private:
+		uint32_t              m_Width, m_Height, m_Depth;      // The size of the volume.
+		uint32_t              m_BricksX, m_BricksY, m_BricksZ; // The number of bricks along each axis.
+		BrickedVolumeSettings m_Settings;                      // The settings.
+		uint32_t              m_PixelSize;                     // The bytes of one texel.
+
+		std::vector<uint32_t> m_BrickTable;  // The index of every brick's entry in m_Bricks, ~0U for empty bricks.
+		std::vector<Brick>    m_Bricks;      // The stored bricks.
+		std::vector<uint32_t> m_FreeBricks;  // The entries of m_Bricks that aren't used.
+		std::vector<bool>     m_Dirty;       // Has every brick changed since the last update.
+		std::vector<uint32_t> m_DirtyBricks; // The bricks that changed since the last update.
+
+		std::unique_ptr<Texture3D> m_Pool;               // The texture the stored bricks are uploaded to.
+		std::unique_ptr<Texture3D> m_Indirection;        // The texture holding the slot of every brick, its data is kept to write updates from.
+		uint32_t                   m_PoolDepth      = 0; // The bricks along the depth of the pool.
+		uint32_t                   m_UsedSlots      = 0; // The number of slots handed out, including released ones.
+		std::vector<uint32_t>      m_FreeSlots;          // The slots released by bricks that became empty.
+		uint64_t                   m_UploadedBricks = 0; // The total number of bricks written to the pool.
+	};
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,53 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+	struct TextureCubeMap;
+
+	struct EnvironmentMapSettings
+	{
+	public:
+		uint32_t    m_CubeSize       = 512;                 // The face size of the cube map the equirectangular image is projected onto.
+		uint32_t    m_SpecularSize   = 128;                 // The face size of the first level of the prefiltered specular cube map.
+		uint32_t    m_SpecularLevels = 6;                   // The number of specular levels, the roughness goes from 0 at the first to 1 at the last.
+		uint32_t    m_SampleCount    = 512;                 // The number of GGX samples taken for every specular texel.
+		std::string m_CacheDirectory = "Cache/Environment"; // The directory the results are cached in, empty to not cache them.
+	};
+
+	struct EnvironmentMap
+	{
+	public:
+		std::unique_ptr<TextureCubeMap> m_Environment;   // The environment as a half float cube map with its mipmaps, for drawing the sky.
+		std::unique_ptr<TextureCubeMap> m_Specular;      // The GGX prefiltered environment as a half float cube map, level n has roughness n / (levels - 1).
+		glm::fvec3                      m_Irradiance[9]; // The L2 spherical harmonics of the irradiance, see EvaluateIrradiance.
+	};
+
+	// Load the equirectangular hdr image and prefilter it for image based lighting, the work is split over the job system.
+	// The results are cached keyed by a hash of the file's bytes and the settings, so later loads only read the cache.
+	// Returns nullptr if the image couldn't be loaded.
+	std::unique_ptr<EnvironmentMap> LoadEnvironmentMap(const std::string& file, const EnvironmentMapSettings& settings = {});
+
+	// Project the float rgba equirectangular image onto a float rgba cube map with faces of the size, sampling it bilinearly.
+	// Returns false if the image isn't float rgba.
+	bool ProjectEquirectangular(const Texture2D& equirect, uint32_t size, TextureCubeMap& cubeMap);
+	// Project the radiance of the float rgba cube map onto L2 spherical harmonics and convolve them with the cosine lobe, giving the irradiance.
+	void ComputeIrradiance(const TextureCubeMap& cubeMap, glm::fvec3 (&irradiance)[9]);
+	// Evaluate the irradiance for the normal, the diffuse lighting is it times the albedo over pi.
+	glm::fvec3 EvaluateIrradiance(const glm::fvec3 (&irradiance)[9], const glm::fvec3& normal);
+	// Prefilter the float rgba cube map with the GGX distribution by importance sampling, into a float rgba cube map with a level per roughness.
+	// Samples less likely than a texel of the source read its lower levels, so generate its mipmaps first to keep few samples from aliasing.
+	// Returns false if the cube map isn't float rgba.
+	bool PrefilterSpecular(const TextureCubeMap& cubeMap, uint32_t size, uint32_t levels, uint32_t sampleCount, TextureCubeMap& specular);
+
+} // namespace gp1::renderer::texture
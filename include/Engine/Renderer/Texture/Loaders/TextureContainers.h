@@ -0,0 +1,38 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+namespace gp1::renderer
+{
+	namespace texture
+	{
+		struct Texture2D;
+	}
+
+	namespace textureLoaders
+	{
+		// Is the file a texture container by its extension, a .dds or .ktx2 file.
+		bool IsTextureContainer(const std::string& file);
+
+		// Read the 2D texture and its mipmaps from a .dds or .ktx2 file, picked by the extension.
+		// Containers hold the levels as they are uploaded, so block compressed textures are read without decoding them.
+		// Levels wider or taller than the max size are left empty and aren't read, so a texture can be streamed in from its mip tail.
+		// Returns false if the file couldn't be read or holds a format, cube map, array or volume that isn't supported.
+		bool ReadTextureContainer(const std::string& file, texture::Texture2D& texture, uint32_t maxSize = ~0U);
+		// Read the 2D texture and its mipmaps from a DDS file.
+		bool ReadDDS(const std::string& file, texture::Texture2D& texture, uint32_t maxSize = ~0U);
+		// Read the 2D texture and its mipmaps from a KTX2 file, supercompressed files aren't supported.
+		bool ReadKTX2(const std::string& file, texture::Texture2D& texture, uint32_t maxSize = ~0U);
+
+		// Write the texture and its stored mipmaps to a DDS file with the DX10 header, so compressed textures from the asset pipeline can be loaded as they are.
+		// Returns false if the format has no DXGI format or the file couldn't be written.
+		bool WriteDDS(const std::string& file, const texture::Texture2D& texture);
+
+	} // namespace textureLoaders
+
+} // namespace gp1::renderer
@@ -4,17 +4,28 @@
 
 #pragma once
 
+#include "Engine/Renderer/Texture/TextureCache.h"
+
+#include <array>
+#include <future>
+#include <memory>
+#include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace gp1::renderer
 {
 	namespace texture
 	{
 		struct Texture2D;
+		struct Texture2DArray;
+		struct TextureCubeMap;
 	}
 
 	namespace textureLoaders
 	{
+		using Texture2DReference = texture::TextureReference<texture::Texture2D>;
+
 		enum class TextureLoadMode
 		{
 			NORMAL,
@@ -22,8 +33,62 @@ namespace gp1::renderer
 			BPC16
 		};
 
-		// Load a 2D texture from the given file in the given mode.
-		texture::Texture2D* LoadTexture2D(std::string file, TextureLoadMode mode = TextureLoadMode::NORMAL);
+		// A texture being decoded on the job system, which becomes ready once decoding finishes.
+		// The handle keeps the texture referenced in the texture cache.
+		class TextureLoadHandle
+		{
+		public:
+			TextureLoadHandle() = default;
+			TextureLoadHandle(std::shared_ptr<const std::shared_future<Texture2DReference>> load);
+
+			// Is the handle tracking a load.
+			bool IsValid() const;
+			// Has the texture finished decoding, never blocks.
+			bool IsReady() const;
+			// Wait for the texture to finish decoding, returns an empty reference if it failed to load.
+			Texture2DReference Get() const;
+
+		private:
+			std::shared_ptr<const std::shared_future<Texture2DReference>> m_Load; // The result of the decoding job, shared by every handle of the file.
+		};
+
+		// Textures loaded together, like everything needed at startup, so their progress can be shown.
+		class TextureLoadBatch
+		{
+		public:
+			// Start loading the file, returns the index of its handle.
+			uint32_t Add(std::string file, TextureLoadMode mode = TextureLoadMode::NORMAL);
+
+			// Get the number of textures in the batch.
+			uint32_t GetCount() const;
+			// Get the number of textures that have finished decoding.
+			uint32_t GetReadyCount() const;
+			// Get the fraction of textures that have finished decoding, 1 for an empty batch.
+			float GetProgress() const;
+			// Have all textures finished decoding.
+			bool IsDone() const;
+			// Wait for all textures to finish decoding.
+			void Wait() const;
+
+			// Get the handle at the given index.
+			const TextureLoadHandle& GetHandle(uint32_t index) const;
+
+		private:
+			std::vector<TextureLoadHandle> m_Handles; // The handles of the textures.
+		};
+
+		// Start loading a 2D texture from the given file in the given mode into the texture cache on the job system, .dds and .ktx2 files are read as they are stored.
+		// Files already cached or loading return a handle to the same texture.
+		TextureLoadHandle LoadTexture2DAsync(std::string file, TextureLoadMode mode = TextureLoadMode::NORMAL);
+		// Decode the levels of a 2D texture that are no wider or taller than the max size, the larger levels are left empty and the texture isn't cached.
+		// .dds and .ktx2 files only read those levels, images are decoded whole and drop the larger levels once their mipmaps are built.
+		// Used by the texture streamer, returns nullptr if the file couldn't be loaded.
+		std::unique_ptr<texture::Texture2D> LoadTexture2DLevels(const std::string& file, uint32_t maxSize, TextureLoadMode mode = TextureLoadMode::NORMAL);
+		// Load the files as the layers of a 2D texture array, decoding them on the job system. Every layer has to be the same size.
+		// Layers are converted to the format of the first, or to rgba if their formats differ. Returns nullptr if a layer couldn't be loaded.
+		std::unique_ptr<texture::Texture2DArray> LoadTexture2DArray(const std::vector<std::string>& files, TextureLoadMode mode = TextureLoadMode::NORMAL);
+		// Load the files as the faces of a cube map in TextureCubeMapFaceIndex order, like LoadTexture2DArray.
+		std::unique_ptr<texture::TextureCubeMap> LoadTextureCubeMap(const std::array<std::string, 6>& files, TextureLoadMode mode = TextureLoadMode::NORMAL);
 
 	} // namespace textureLoaders
 
@@ -0,0 +1,60 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+#include <stdint.h>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+	struct Texture2DArray;
+	struct Texture3D;
+	struct TextureCubeMap;
+
+	enum class MipmapFilter
+	{
+		BOX,
+		KAISER
+	};
+
+	struct MipmapSettings
+	{
+	public:
+		MipmapFilter m_Filter                = MipmapFilter::BOX; // The filter each level is reduced with.
+		bool         m_SRGB                  = false;             // Are the color channels stored in sRGB, they are filtered as linear values either way.
+		bool         m_PreserveAlphaCoverage = false;             // Should every level keep the fraction of texels passing the alpha cutoff, for alpha tested cutouts.
+		float        m_AlphaCutoff           = 0.5f;              // The alpha value cutouts are tested against.
+		float        m_KaiserRadius          = 3.0f;              // The radius of the kaiser filter in texels of the smaller level.
+		float        m_KaiserAlpha           = 4.0f;              // The sharpness of the kaiser window, higher is smoother.
+	};
+
+	// Does the filter sample mipmaps.
+	bool UsesMipmaps(TextureFilter filter);
+	// Can mipmaps be generated for textures of the format and type.
+	// Unsigned byte, unsigned short and float textures with up to four color channels are supported.
+	bool CanGenerateMipmaps(TextureFormat format, TextureDataType type);
+
+	// Build the mip chain of the texture down to 1x1 or its max level and store it with the texture, so it is uploaded as is.
+	// Replaces mipmaps stored before, returns false if the format isn't supported or the texture has no data.
+	bool GenerateMipmaps(Texture2D& texture, const MipmapSettings& settings = {});
+	// Build the mip chain of every layer.
+	bool GenerateMipmaps(Texture2DArray& texture, const MipmapSettings& settings = {});
+	// Build the mip chain of the texture, the depth is halved with the width and height.
+	bool GenerateMipmaps(Texture3D& texture, const MipmapSettings& settings = {});
+	// Build the mip chain of every face, the faces are filtered on their own so the edges clamp.
+	bool GenerateMipmaps(TextureCubeMap& texture, const MipmapSettings& settings = {});
+
+	// Get the number of levels the texture has data for, including the base level.
+	// Stored mipmaps are only counted while their sizes match the base level, so data changed since they were generated isn't paired with stale mipmaps.
+	uint32_t GetStoredLevelCount(const Texture2D& texture);
+	uint32_t GetStoredLevelCount(const Texture2DArray& texture);
+	uint32_t GetStoredLevelCount(const Texture3D& texture);
+	uint32_t GetStoredLevelCount(const TextureCubeMap& texture);
+	// Get the number of levels the texture has data for from the first level on, for textures that don't hold the levels before their base level.
+	uint32_t GetStoredLevelCount(const Texture2D& texture, uint32_t firstLevel);
+
+} // namespace gp1::renderer::texture
@@ -6,6 +6,7 @@
 
 #include "Engine/Renderer/RendererData.h"
 #include "Engine/Renderer/Texture/TextureCommon.h"
+#include "Engine/Renderer/Texture/TextureData.h"
 
 #include <stdint.h>
 #include <vector>
@@ -23,17 +24,26 @@ namespace gp1::renderer::texture
 		void ClearDirty();
 		// Is this texture dirty.
 		bool IsDirty();
+		// Mark this texture's wrapping, filter and level of detail settings dirty, so they are updated without recreating it.
+		void MarkSamplerDirty();
+		// Clears this texture's sampler dirtiness.
+		void ClearSamplerDirty();
+		// Are this texture's sampler settings dirty.
+		bool IsSamplerDirty();
 
 		// Is the texture editable.
 		bool IsEditable();
 		// Is the texture dynamic.
 		bool IsDynamic();
+		// Set whether the texture is dynamic, only dynamic textures keep their data after upload so it can be edited and uploaded again.
+		void SetDynamic(bool dynamic);
 
 	public:
-		std::vector<uint8_t> m_Data;                                    // This texture's raw byte data.
-		uint32_t             m_Width = 0, m_Height = 0;                 // The size of the texture.
-		TextureFormat        m_Format = TextureFormat::RGBA;            // The format of the texture data.
-		TextureDataType      m_Type   = TextureDataType::UNSIGNED_BYTE; // The type of texture data.
+		TextureData              m_Data;                                    // This texture's raw byte data.
+		std::vector<TextureData> m_Mips;                                    // The raw byte data of the mipmaps from level 1 down, see GenerateMipmaps.
+		uint32_t                 m_Width = 0, m_Height = 0;                 // The size of the texture.
+		TextureFormat            m_Format = TextureFormat::RGBA;            // The format of the texture data.
+		TextureDataType          m_Type   = TextureDataType::UNSIGNED_BYTE; // The type of texture data.
 
 		struct
 		{
@@ -48,15 +58,16 @@ namespace gp1::renderer::texture
 		} m_Filter;                                                       // The filter of this texture.
 
 		float    m_LodBias   = 0.0f;     // The level of detail bias for the texture.
-		float    m_MinLod    = -1000.0f; // The min level of detail for the texture.
-		float    m_MaxLod    = 1000.0f;  // The max level of detail for the texture.
-		uint32_t m_BaseLevel = 0;        // The base mapmap level for the texture.
+		float    m_MinLod    = -1000.0f; // The min level of detail for the texture, relative to the base level.
+		float    m_MaxLod    = 1000.0f;  // The max level of detail for the texture, relative to the base level.
+		uint32_t m_BaseLevel = 0;        // The base mapmap level for the texture, only the levels from it on are allocated and need data. (Changing it needs MarkDirty)
 		uint32_t m_MaxLevel  = 1000;     // The max mipmap level for the texture.
 
 	protected:
-		bool m_Dirty     = true;  // Should this texture be recreated.
-		bool m_Editable  = true;  // Is this texture editable.
-		bool m_IsDynamic = false; // Is this texture dynamic. (i.e. should the raw byte data be kept after initialization of the GL data)
+		bool m_Dirty        = true;  // Should this texture be recreated.
+		bool m_SamplerDirty = false; // Should this texture's sampler settings be updated.
+		bool m_Editable     = true;  // Is this texture editable.
+		bool m_IsDynamic    = false; // Is this texture dynamic. (i.e. should the raw byte data be kept after initialization of the GL data)
 	};
 
 } // namespace gp1::renderer::texture
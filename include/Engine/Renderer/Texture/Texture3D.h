@@ -12,6 +12,15 @@
 
 namespace gp1::renderer::texture
 {
+	// A region of the base level of a 3D texture and the tightly packed texels to write to it.
+	struct Texture3DUpdate
+	{
+	public:
+		uint32_t             m_X = 0, m_Y = 0, m_Z = 0;              // The first texel of the region.
+		uint32_t             m_Width = 0, m_Height = 0, m_Depth = 0; // The size of the region.
+		std::vector<uint8_t> m_Data;                                 // The texels of the region.
+	};
+
 	struct Texture3D : public Data
 	{
 	public:
@@ -28,12 +37,16 @@ namespace gp1::renderer::texture
 		bool IsEditable();
 		// Is the texture dynamic.
 		bool IsDynamic();
+		// Set whether the texture is dynamic, only dynamic textures keep their data after upload so it can be edited and uploaded again.
+		void SetDynamic(bool dynamic);
 
 	public:
-		std::vector<uint8_t> m_Data;                                    // This texture's raw byte data.
-		uint32_t             m_Width = 0, m_Height = 0, m_Depth = 0;    // The size of the texture.
-		TextureFormat        m_Format = TextureFormat::RGBA;            // The format of the texture data.
-		TextureDataType      m_Type   = TextureDataType::UNSIGNED_BYTE; // The type of texture data.
+		std::vector<uint8_t>              m_Data;                                    // This texture's raw byte data.
+		std::vector<std::vector<uint8_t>> m_Mips;                                    // The raw byte data of the mipmaps from level 1 down, see GenerateMipmaps.
+		std::vector<Texture3DUpdate>      m_Updates;                                 // Regions written to the base level on the next use without recreating the texture, cleared once written.
+		uint32_t                          m_Width = 0, m_Height = 0, m_Depth = 0;    // The size of the texture.
+		TextureFormat                     m_Format = TextureFormat::RGBA;            // The format of the texture data.
+		TextureDataType                   m_Type   = TextureDataType::UNSIGNED_BYTE; // The type of texture data.
 
 		struct
 		{
@@ -0,0 +1,120 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+#include <glm.hpp>
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+
+	enum class AtlasPacking
+	{
+		MAX_RECTS, // Keeps every free rectangle and places textures where the shorter leftover side is smallest, packs tightest.
+		SKYLINE    // Keeps the top edge of the placed textures and places textures as low as they fit, faster with less tight packing.
+	};
+
+	struct TextureAtlasSettings
+	{
+	public:
+		uint32_t        m_PageSize  = 2048;                           // The width and height of every page, has to be a power of two.
+		TextureFormat   m_Format    = TextureFormat::RGBA;            // The format of the pages, added textures have to match it.
+		TextureDataType m_Type      = TextureDataType::UNSIGNED_BYTE; // The data type of the pages, added textures have to match it.
+		AtlasPacking    m_Packing   = AtlasPacking::MAX_RECTS;        // The way textures are placed on the pages.
+		uint32_t        m_Padding   = 2;                              // The texels of gutter around every texture, filled by extending its edges.
+		uint32_t        m_MipLevels = 5;                              // The number of levels of every page, including the base level.
+		MipmapSettings  m_Mipmaps;                                    // The settings the levels of added textures are generated with, each texture is filtered on its own.
+	};
+
+	struct TextureAtlasRegion
+	{
+	public:
+		// Was the texture placed.
+		bool IsValid() const;
+
+	public:
+		Texture2D* m_Texture = nullptr;                      // The page the texture was placed on, owned by the atlas.
+		uint32_t   m_Page    = 0;                            // The index of the page.
+		uint32_t   m_X = 0, m_Y = 0;                         // The texel the texture starts at on the page, not including the gutter.
+		uint32_t   m_Width = 0, m_Height = 0;                // The size of the texture.
+		glm::fvec4 m_UVTransform { 1.0f, 1.0f, 0.0f, 0.0f }; // Maps uvs of the texture onto the page as uv * xy + zw.
+	};
+
+	// Packs small 2D textures into shared pages, so materials using them bind one texture instead of one each.
+	// Every texture is surrounded by a gutter of its edge texels and placed on texels aligned to every page level, so sampling
+	// the region with mipmaps doesn't bleed in its neighbours down to the last level. Regions clamp, so textures that repeat can't be atlased.
+	// Textures can be added at any time, their levels are generated as they are added and the changed pages are uploaded on the next update.
+	// Pages are dynamic and keep their data on the cpu for that.
+	class TextureAtlas
+	{
+	public:
+		TextureAtlas(const TextureAtlasSettings& settings = {});
+		~TextureAtlas();
+
+		// Add the texture to a page with room for it, opening a new page if none has.
+		// Only the texture's base level is read, returns an invalid region if it doesn't match the atlas's format or doesn't fit on a page.
+		TextureAtlasRegion Add(const Texture2D& texture);
+		// Mark the pages that changed since the last update dirty, so their textures are uploaded.
+		void Update();
+		// Release every page, regions handed out before aren't valid anymore.
+		void Clear();
+
+		// Get the number of pages.
+		uint32_t GetPageCount() const;
+		// Get the page at the index.
+		Texture2D* GetPage(uint32_t page) const;
+		// Get the fraction of the page's texels that are used by textures and their gutters.
+		float GetPageOccupancy(uint32_t page) const;
+		// Get the settings.
+		const TextureAtlasSettings& GetSettings() const;
+
+	private:
+		struct Rect
+		{
+		public:
+			uint32_t m_X = 0, m_Y = 0, m_Width = 0, m_Height = 0;
+		};
+
+		struct SkylineNode
+		{
+		public:
+			uint32_t m_X = 0, m_Y = 0, m_Width = 0;
+		};
+
+		struct Page
+		{
+		public:
+			std::unique_ptr<Texture2D> m_Texture;            // The texture of the page.
+			std::vector<Rect>          m_FreeRects;          // The free rectangles for max rects packing.
+			std::vector<SkylineNode>   m_Skyline;            // The top edge of the placed textures for skyline packing.
+			uint64_t                   m_UsedTexels = 0;     // The texels used by textures and their gutters.
+			bool                       m_Changed    = false; // Were textures added since the last update.
+		};
+
+	private:
+		// Open a new page.
+		Page& AddPage();
+		// Find a place for the rectangle on the page, returns false if it doesn't fit.
+		bool Place(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+		// Find a place for the rectangle with max rects packing.
+		bool PlaceMaxRects(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+		// Find a place for the rectangle with skyline packing.
+		bool PlaceSkyline(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+	private:
+		TextureAtlasSettings m_Settings;  // The settings.
+		uint32_t             m_Alignment; // The texels placed rectangles are aligned to, so their levels line up with the page's levels.
+		uint32_t             m_Gutter;    // The texels of gutter around every texture.
+		std::vector<Page>    m_Pages;     // The pages.
+	};
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,230 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/RendererData.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+	struct Texture2DArray;
+	struct Texture3D;
+	struct TextureCubeMap;
+
+	class TextureCache;
+
+	struct TextureCacheEntry
+	{
+	public:
+		// Measures the bytes of a texture.
+		using ByteCounter = uint64_t (*)(Data* texture);
+
+	public:
+		std::string           m_Name;                  // The name the texture is cached under.
+		std::unique_ptr<Data> m_Texture;               // The texture.
+		std::atomic<uint32_t> m_References { 0 };      // The number of references to the texture.
+		std::atomic<uint64_t> m_LastUse { 0 };         // When the texture was last referenced or released.
+		uint64_t              m_CPUBytes    = 0;       // The bytes of raw data the texture holds, as of the last trim.
+		uint64_t              m_GPUBytes    = 0;       // The bytes the texture takes on the gpu, as of the last trim.
+		ByteCounter           m_GetCPUBytes = nullptr; // Measures the bytes of raw data.
+		ByteCounter           m_GetGPUBytes = nullptr; // Measures the bytes on the gpu.
+	};
+
+	// Keeps a cached texture from being evicted while it is alive.
+	template <typename T>
+	class TextureReference
+	{
+	public:
+		TextureReference() = default;
+		TextureReference(const TextureReference& other);
+		TextureReference(TextureReference&& other) noexcept;
+		~TextureReference();
+
+		TextureReference& operator=(const TextureReference& other);
+		TextureReference& operator=(TextureReference&& other) noexcept;
+
+		// Get the texture, nullptr if this doesn't reference one.
+		T* Get() const;
+		// Drop the reference.
+		void Release();
+
+		T* operator->() const { return Get(); }
+		explicit operator bool() const { return this->m_Entry; }
+
+		friend TextureCache;
+
+	private:
+		// Take over a reference already added to the entry.
+		TextureReference(TextureCacheEntry* entry);
+
+	private:
+		TextureCacheEntry* m_Entry = nullptr; // The entry of the referenced texture.
+	};
+
+	// Owns textures by name, counts their references and tracks the bytes they take on the cpu and gpu.
+	// Once either budget is exceeded the least recently used unreferenced textures are evicted, which releases both their
+	// raw data and their renderer data.
+	class TextureCache
+	{
+	public:
+		~TextureCache();
+
+		// Add the texture under the name and reference it.
+		// If the name is taken the cached texture is referenced instead and the given one is dropped,
+		// an empty reference is returned if the cached texture is of another type.
+		template <typename T>
+		TextureReference<T> Add(const std::string& name, std::unique_ptr<T> texture);
+		// Reference the texture cached under the name, empty if there is none of the type.
+		template <typename T>
+		TextureReference<T> Find(const std::string& name);
+
+		// Set the budgets in bytes.
+		void SetBudget(uint64_t cpuBytes, uint64_t gpuBytes);
+		// Measure every texture and evict the least recently used unreferenced textures until both budgets are met.
+		// Evicting releases renderer data, so this has to be called on the renderer's thread.
+		void Trim();
+		// Evict every unreferenced texture, on the renderer's thread like Trim.
+		void Clear();
+
+		// Get the bytes of raw data held by the cached textures, as of the last trim.
+		uint64_t GetCPUBytes() const;
+		// Get the bytes the cached textures take on the gpu, as of the last trim.
+		uint64_t GetGPUBytes() const;
+		// Get the number of cached textures.
+		uint32_t GetTextureCount() const;
+		// Get the number of textures evicted so far.
+		uint64_t GetEvictionCount() const;
+
+	public:
+		// Get the texture cache shared by the engine.
+		static TextureCache* GetInstance();
+
+		// Add a reference to the entry.
+		static void AddReference(TextureCacheEntry* entry);
+		// Remove a reference from the entry, marking when it was last used.
+		static void RemoveReference(TextureCacheEntry* entry);
+
+	private:
+		// Add the texture and reference its entry, or reference the entry already cached under the name.
+		// Returns nullptr if the cached entry is of another type.
+		TextureCacheEntry* AddEntry(const std::string& name, std::unique_ptr<Data> texture, TextureCacheEntry::ByteCounter getCPUBytes, TextureCacheEntry::ByteCounter getGPUBytes);
+		// Reference the entry cached under the name, nullptr if there is none of the type.
+		TextureCacheEntry* FindEntry(const std::string& name, const std::type_info& type);
+		// Evict unreferenced textures, least recently used first, until the budgets are met or every one is evicted.
+		void Evict(bool all);
+
+	private:
+		static std::atomic<uint64_t> s_Clock; // Counts every reference change, used to order the textures by last use.
+
+	private:
+		std::unordered_map<std::string, std::unique_ptr<TextureCacheEntry>> m_Entries; // The cached textures by name.
+		mutable std::mutex                                                  m_Mutex;   // The mutex guarding the entries.
+
+		uint64_t m_CPUBudget     = 256ULL << 20; // The bytes of raw data allowed before evicting.
+		uint64_t m_GPUBudget     = 1ULL << 30;   // The bytes on the gpu allowed before evicting.
+		uint64_t m_CPUBytes      = 0;            // The bytes of raw data, as of the last trim.
+		uint64_t m_GPUBytes      = 0;            // The bytes on the gpu, as of the last trim.
+		uint64_t m_EvictionCount = 0;            // The number of textures evicted so far.
+		bool     m_OverBudget    = false;        // Did the last trim fail to meet the budgets.
+	};
+
+	// Get the bytes of raw data the texture holds.
+	uint64_t GetTextureCPUBytes(Texture2D& texture);
+	uint64_t GetTextureCPUBytes(Texture2DArray& texture);
+	uint64_t GetTextureCPUBytes(Texture3D& texture);
+	uint64_t GetTextureCPUBytes(TextureCubeMap& texture);
+	// Get the bytes the texture takes on the gpu including its mipmaps, 0 if it hasn't been uploaded.
+	uint64_t GetTextureGPUBytes(Texture2D& texture);
+	uint64_t GetTextureGPUBytes(Texture2DArray& texture);
+	uint64_t GetTextureGPUBytes(Texture3D& texture);
+	uint64_t GetTextureGPUBytes(TextureCubeMap& texture);
+
+	template <typename T>
+	TextureReference<T>::TextureReference(TextureCacheEntry* entry)
+	    : m_Entry(entry) {}
+
+	template <typename T>
+	TextureReference<T>::TextureReference(const TextureReference& other)
+	    : m_Entry(other.m_Entry)
+	{
+		if (this->m_Entry)
+			TextureCache::AddReference(this->m_Entry);
+	}
+
+	template <typename T>
+	TextureReference<T>::TextureReference(TextureReference&& other) noexcept
+	    : m_Entry(other.m_Entry)
+	{
+		other.m_Entry = nullptr;
+	}
+
+	template <typename T>
+	TextureReference<T>::~TextureReference()
+	{
+		Release();
+	}
+
+	template <typename T>
+	TextureReference<T>& TextureReference<T>::operator=(const TextureReference& other)
+	{
+		if (other.m_Entry)
+			TextureCache::AddReference(other.m_Entry);
+		Release();
+		this->m_Entry = other.m_Entry;
+		return *this;
+	}
+
+	template <typename T>
+	TextureReference<T>& TextureReference<T>::operator=(TextureReference&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			this->m_Entry = other.m_Entry;
+			other.m_Entry = nullptr;
+		}
+		return *this;
+	}
+
+	template <typename T>
+	T* TextureReference<T>::Get() const
+	{
+		return this->m_Entry ? static_cast<T*>(this->m_Entry->m_Texture.get()) : nullptr;
+	}
+
+	template <typename T>
+	void TextureReference<T>::Release()
+	{
+		if (this->m_Entry)
+		{
+			TextureCache::RemoveReference(this->m_Entry);
+			this->m_Entry = nullptr;
+		}
+	}
+
+	template <typename T>
+	TextureReference<T> TextureCache::Add(const std::string& name, std::unique_ptr<T> texture)
+	{
+		return TextureReference<T>(AddEntry(
+		    name, std::move(texture),
+		    [](Data* data) { return GetTextureCPUBytes(*static_cast<T*>(data)); },
+		    [](Data* data) { return GetTextureGPUBytes(*static_cast<T*>(data)); }));
+	}
+
+	template <typename T>
+	TextureReference<T> TextureCache::Find(const std::string& name)
+	{
+		return TextureReference<T>(FindEntry(name, typeid(T)));
+	}
+
+} // namespace gp1::renderer::texture
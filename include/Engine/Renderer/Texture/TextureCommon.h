@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace gp1::renderer::texture
 {
 	enum class TextureWrapping
@@ -41,7 +43,24 @@ namespace gp1::renderer::texture
 		BGRA_INTEGER,
 		STENCIL_INDEX,
 		DEPTH_COMPONENT,
-		DEPTH_STENCIL
+		DEPTH_STENCIL,
+		// Block compressed formats, the data is stored in 4x4 texel blocks and the data type is ignored.
+		BC1_RGB,        // 8 byte blocks of rgb.
+		BC1_RGBA,       // 8 byte blocks of rgb with 1 bit alpha.
+		BC1_SRGB,       // BC1_RGB with srgb color.
+		BC1_SRGB_ALPHA, // BC1_RGBA with srgb color.
+		BC2,            // 16 byte blocks of rgb with 4 bit alpha.
+		BC2_SRGB,       // BC2 with srgb color.
+		BC3,            // 16 byte blocks of rgb with interpolated alpha.
+		BC3_SRGB,       // BC3 with srgb color.
+		BC4,            // 8 byte blocks of red.
+		BC4_SIGNED,     // BC4 with signed red.
+		BC5,            // 16 byte blocks of red and green.
+		BC5_SIGNED,     // BC5 with signed red and green.
+		BC6H,           // 16 byte blocks of unsigned half float rgb.
+		BC6H_SIGNED,    // 16 byte blocks of signed half float rgb.
+		BC7,            // 16 byte blocks of rgba.
+		BC7_SRGB        // BC7 with srgb color.
 	};
 
 	enum class TextureDataType
@@ -68,4 +87,13 @@ namespace gp1::renderer::texture
 		UNSIGNED_INT_2_10_10_10_REV
 	};
 
+	// Is the format block compressed.
+	bool IsCompressedFormat(TextureFormat format);
+	// Get the bytes of one 4x4 block of the compressed format, 0 for uncompressed formats.
+	uint32_t GetBlockSize(TextureFormat format);
+	// Get the bytes of one pixel of uncompressed data.
+	uint32_t GetPixelSize(TextureFormat format, TextureDataType type);
+	// Get the bytes of an image of the given size, compressed images are rounded up to whole blocks.
+	uint64_t GetImageSize(TextureFormat format, TextureDataType type, uint32_t width, uint32_t height, uint32_t depth = 1);
+
 } // namespace gp1::renderer::texture
@@ -0,0 +1,23 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+
+	// Can textures be compressed to the format.
+	// BC1, BC3, BC4, BC5 and BC7 along with their srgb formats can be, BC7 is encoded with its single subset rgba mode.
+	bool CanCompressTexture(TextureFormat format);
+
+	// Compress the texture and its stored mipmaps to the block compressed format, meant for the asset pipeline as encoding is slow.
+	// The texture has to hold unsigned byte red, rg, rgb or rgba data. BC4 encodes the red channel and BC5 the red and green channels.
+	// Generate the mipmaps first, as compressed textures can't have any generated. The blocks are encoded on the job system.
+	// Returns false if the format can't be encoded to or the texture has no data.
+	bool CompressTexture(Texture2D& texture, TextureFormat format);
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,50 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+
+	// The kernels work on tightly packed texels and use SSE2 where it is available, SSSE3 and F16C are used as well when the build enables them.
+	// Counts are in texels unless noted otherwise. Sources and targets may be the same buffer, except when expanding rgb to rgba.
+
+	// Expand rgb texels to rgba with opaque alpha.
+	void ExpandRGBToRGBA(const uint8_t* source, uint8_t* target, size_t count);
+	void ExpandRGBToRGBA(const uint16_t* source, uint16_t* target, size_t count);
+	void ExpandRGBToRGBA(const float* source, float* target, size_t count);
+	// Swap the red and blue channels of rgba or bgra texels.
+	void SwizzleBGRAToRGBA(const uint8_t* source, uint8_t* target, size_t count);
+	// Convert unsigned normalized 16 bit components to half floats, the count is in components.
+	void ConvertUnorm16ToHalf(const uint16_t* source, uint16_t* target, size_t count);
+	// Convert float components to half floats, rounding to the nearest even value, the count is in components.
+	void ConvertFloatToHalf(const float* source, uint16_t* target, size_t count);
+	// Convert half float components to floats, the count is in components.
+	void ConvertHalfToFloat(const uint16_t* source, float* target, size_t count);
+	// Multiply the color channels of rgba texels by their alpha.
+	void PremultiplyAlpha(uint8_t* texels, size_t count);
+	void PremultiplyAlpha(float* texels, size_t count);
+	// Renormalize the tangent space normals of rgb or rgba texels and store their x and y in rg texels, the shader reconstructs z.
+	void PackNormals(const uint8_t* source, uint32_t channels, uint8_t* target, size_t count);
+
+	// Can the texture be converted from the format and type to the other format and type.
+	// Red, rg, rgb and bgr textures can become rgba ones of their type, and bgra ones can be swizzled to rgba.
+	// Unsigned short and float textures can become half float textures of their format, and half float textures can become float ones.
+	bool CanConvertTexture(TextureFormat sourceFormat, TextureDataType sourceType, TextureFormat targetFormat, TextureDataType targetType);
+	// Convert the texture and its stored mipmaps to the format and type, see CanConvertTexture.
+	// Generate the mipmaps before converting to half floats, as they can't be generated from them. Returns false if the conversion isn't supported.
+	bool ConvertTexture(Texture2D& texture, TextureFormat format, TextureDataType type);
+	// Multiply the color of the texture and its stored mipmaps by alpha, for unsigned byte and float rgba textures.
+	// Premultiply before generating the mipmaps, so the colors of transparent texels don't bleed into the lower levels.
+	bool PremultiplyTextureAlpha(Texture2D& texture);
+	// Pack the unsigned byte rgb or rgba normal map and its stored mipmaps into an rg texture holding x and y, ready for BC5 compression.
+	bool PackNormalMap(Texture2D& texture);
+
+} // namespace gp1::renderer::texture
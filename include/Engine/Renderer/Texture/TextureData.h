@@ -0,0 +1,64 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	// The raw bytes of a texture, either owned or adopted from a buffer allocated elsewhere, like by a decoder,
+	// so decoded images don't have to be copied.
+	// Mirrors the parts of std::vector the renderer uses.
+	class TextureData
+	{
+	public:
+		// Releases an adopted buffer.
+		using Deleter = void (*)(void* data);
+
+	public:
+		TextureData() = default;
+		TextureData(const TextureData& other);
+		TextureData(TextureData&& other) noexcept;
+		~TextureData();
+
+		TextureData& operator=(const TextureData& other);
+		TextureData& operator=(TextureData&& other) noexcept;
+
+		// Take ownership of the buffer, which is released with the deleter once it isn't needed anymore.
+		void Adopt(void* data, size_t size, Deleter deleter);
+
+		// Get the bytes.
+		uint8_t* data();
+		// Get the bytes.
+		const uint8_t* data() const;
+		// Get the number of bytes.
+		size_t size() const;
+		// Are there no bytes.
+		bool empty() const;
+
+		// Resize to the number of bytes, an adopted buffer is copied into owned storage first.
+		void resize(size_t size);
+		// Append a byte, an adopted buffer is copied into owned storage first.
+		void push_back(uint8_t value);
+		// Release the bytes.
+		void clear();
+
+		uint8_t&       operator[](size_t index);
+		const uint8_t& operator[](size_t index) const;
+
+	private:
+		// Release the adopted buffer.
+		void ReleaseAdopted();
+
+	private:
+		std::vector<uint8_t> m_Owned;                 // The bytes if they are owned.
+		uint8_t*             m_Adopted     = nullptr; // The adopted buffer.
+		size_t               m_AdoptedSize = 0;       // The size of the adopted buffer.
+		Deleter              m_Deleter     = nullptr; // Releases the adopted buffer.
+	};
+
+} // namespace gp1::renderer::texture
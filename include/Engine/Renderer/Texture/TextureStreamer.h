@@ -0,0 +1,102 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Texture/Loaders/TextureLoaders.h"
+
+#include <future>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	struct Texture2D;
+
+	struct TextureStreamerStats
+	{
+	public:
+		uint32_t m_Textures      = 0; // The number of streamed textures.
+		uint32_t m_PendingLoads  = 0; // The number of level loads in flight.
+		uint64_t m_ResidentBytes = 0; // The bytes of the resident levels, as of the last update.
+		uint64_t m_WantedBytes   = 0; // The bytes the levels wanted by the renderer would take, before the budget is applied.
+		uint32_t m_BudgetBias    = 0; // The number of levels every drawn texture gives up to meet the budget.
+		uint64_t m_LoadedLevels  = 0; // The number of levels streamed in so far.
+		uint64_t m_DroppedLevels = 0; // The number of levels dropped so far.
+	};
+
+	struct StreamedTexture
+	{
+	public:
+		std::string                             m_File;                                            // The file the levels are loaded from.
+		textureLoaders::TextureLoadMode         m_Mode = textureLoaders::TextureLoadMode::NORMAL;  // The mode images are decoded in.
+		std::unique_ptr<Texture2D>              m_Texture;                                         // The texture, its base level is its finest resident level.
+		std::vector<uint64_t>                   m_LevelBytes;                                      // The bytes of every level from the level on down to the last one.
+		uint32_t                                m_TailLevel   = 0;                                 // The first level of the mip tail, which is always resident.
+		uint32_t                                m_WantedLevel = 0;                                 // The finest level the renderer wants resident.
+		float                                   m_Demand      = 0.0f;                              // The largest screen size the texture was requested at since the last update.
+		uint64_t                                m_LastRequest = 0;                                 // The update the texture was last requested in.
+		float                                   m_MinLod      = 0.0f;                              // The min level of detail of the texture when it isn't fading in levels.
+		float                                   m_Fade        = 0.0f;                              // The levels of detail left to fade in.
+		std::future<std::unique_ptr<Texture2D>> m_Load;                                            // The levels being loaded, not valid if there is no load in flight.
+		uint32_t                                m_LoadLevel = 0;                                   // The first level being loaded.
+	};
+
+	// Streams the levels of 2D textures in and out by the size they are drawn at, so large texture sets don't have to be resident at once.
+	// Streamed textures start with their mip tail resident and the renderer requests finer levels as it draws them, which are loaded on the job system.
+	// The base level of a streamed texture is its finest resident level, as only the levels from it on are allocated, and new levels are
+	// faded in through its min level of detail instead of popping in. The streamer owns both of them.
+	// Once the wanted levels don't fit the budget, textures that weren't drawn in the last update drop back to their mip tail and then
+	// every drawn texture gives up a level at a time until they fit.
+	// Textures are streamed, requested and updated on the renderer's thread.
+	class TextureStreamer
+	{
+	public:
+		~TextureStreamer();
+
+		// Stream the 2D texture from the file, its mip tail is loaded before this returns and files already streamed return the same texture.
+		// .dds and .ktx2 files read each level on its own, images are decoded whole whenever levels are loaded as they can't be read a level at a time.
+		// The texture is owned by the streamer, returns nullptr if the file couldn't be loaded.
+		Texture2D* Stream(const std::string& file, textureLoaders::TextureLoadMode mode = textureLoaders::TextureLoadMode::NORMAL);
+		// Record that the texture is drawn at the screen size in pixels, see EstimateScreenSize. Textures that aren't streamed are ignored.
+		// The finest level wanted is picked from the largest size recorded between updates.
+		void Request(const Texture2D* texture, float screenSize);
+		// Apply the finished loads, fade in new levels, pick the levels to keep under the budget and start the loads they need.
+		// Applying loads recreates the textures, so this has to be called on the renderer's thread.
+		void Update();
+		// Stop streaming and release every texture, waiting for the loads in flight.
+		void Clear();
+
+		// Set the budget of the resident levels in bytes.
+		void SetBudget(uint64_t bytes);
+		// Get the stats, as of the last update.
+		const TextureStreamerStats& GetStats() const;
+
+	public:
+		// Get the texture streamer shared by the engine.
+		static TextureStreamer* GetInstance();
+
+	private:
+		// Apply the load of the texture, replacing its levels and base level.
+		void ApplyLoad(StreamedTexture& texture);
+		// Start loading the levels of the texture from the level on.
+		void StartLoad(StreamedTexture& texture, uint32_t level);
+
+	private:
+		std::unordered_map<std::string, std::unique_ptr<StreamedTexture>> m_Textures;           // The streamed textures by file.
+		std::unordered_map<const Texture2D*, StreamedTexture*>             m_TexturesByPointer; // The streamed textures by texture, for requests.
+
+		uint64_t             m_Budget = 512ULL << 20; // The bytes the resident levels may take.
+		uint64_t             m_Update = 0;            // The number of updates so far.
+		TextureStreamerStats m_Stats;                 // The stats as of the last update.
+	};
+
+	// Estimate the size in pixels an object with the bounding radius is drawn at from the distance to it, which is what its textures are requested at.
+	// The projection scale is the projection matrix's [1][1] entry. Assumes the texture is mapped across the object once.
+	float EstimateScreenSize(float radius, float distance, float projectionScale, uint32_t viewportHeight);
+
+} // namespace gp1::renderer::texture
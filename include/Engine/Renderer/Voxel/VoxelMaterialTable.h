@@ -0,0 +1,89 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/Mesh.h"
+#include "Engine/Renderer/RendererData.h"
+
+#include <glm.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::renderer
+{
+	namespace shader
+	{
+		struct Material;
+	}
+
+	namespace texture
+	{
+		struct Texture2DArray;
+	}
+
+	namespace voxel
+	{
+		// The flags a voxel material can have, read by the voxel shader.
+		namespace VoxelMaterialFlag
+		{
+			constexpr const uint32_t ALPHA_TESTED = 1; // Discard fragments whose alpha is below one half.
+			constexpr const uint32_t UNLIT        = 2; // Skip the directional light.
+		}; // namespace VoxelMaterialFlag
+
+		struct VoxelMaterial
+		{
+		public:
+			uint32_t   m_TextureLayer = 0;                // The layer of the texture array this material samples.
+			glm::fvec4 m_Tint { 1.0f, 1.0f, 1.0f, 1.0f }; // The color the texture is multiplied by.
+			glm::fvec3 m_Emissive { 0.0f, 0.0f, 0.0f };   // The color added after lighting.
+			uint32_t   m_Flags = 0;                       // The VoxelMaterialFlag bits of this material.
+		};
+
+		// The materials of every block, indexed by the block id each voxel vertex stores in its SSBOIndex.
+		// The table lives in one shader storage buffer bound once per frame, so every chunk is drawn with the same material and no per chunk uniforms.
+		struct VoxelMaterialTable : public Data
+		{
+		public:
+			VoxelMaterialTable(shader::Material* material = nullptr, texture::Texture2DArray* textures = nullptr);
+
+			// Set the material of a block id, the table grows to hold it.
+			void SetMaterial(uint32_t blockID, const VoxelMaterial& material);
+			// Get the material of a block id, block ids outside the table get the default material.
+			const VoxelMaterial& GetMaterial(uint32_t blockID) const;
+			// Get the number of materials in the table.
+			uint32_t GetMaterialCount() const;
+			// Get all materials in the table.
+			const std::vector<VoxelMaterial>& GetMaterials() const;
+
+			// Set the texture array the materials' layers index and give it to the shared material.
+			void SetTextures(texture::Texture2DArray* textures);
+			// Get the texture array the materials' layers index.
+			texture::Texture2DArray* GetTextures() const;
+
+			// Mark the whole table dirty for reupload.
+			void MarkDirty();
+			// Clears this table's dirtiness.
+			void ClearDirty();
+			// Is this table dirty.
+			bool IsDirty();
+			// Get the dirty material range.
+			const mesh::DirtyRange& GetDirtyMaterials() const;
+
+		public:
+			shader::Material* m_Material = nullptr; // The material every voxel chunk is drawn with, its shader reads the table from a shader storage buffer.
+
+		protected:
+			std::vector<VoxelMaterial> m_Materials;          // The material of every block id.
+			texture::Texture2DArray*   m_Textures = nullptr; // The texture array the materials' layers index.
+			mesh::DirtyRange           m_DirtyMaterials;     // The materials changed since the last upload.
+
+		private:
+			static const VoxelMaterial s_DefaultMaterial; // The material of block ids outside the table.
+		};
+
+	} // namespace voxel
+
+} // namespace gp1::renderer
@@ -8,6 +8,11 @@
 
 namespace gp1
 {
+	namespace animation
+	{
+		class Pose;
+	}
+
 	namespace renderer::mesh
 	{
 		struct Mesh;
@@ -36,6 +41,8 @@ namespace gp1
 			virtual renderer::mesh::Mesh* GetMesh() const;
 			// Gets a material if this entity has one else returns nullptr.
 			virtual renderer::shader::Material* GetMaterial() const;
+			// Gets the pose a skeletal mesh is skinned with if this entity has one else returns nullptr.
+			virtual const animation::Pose* GetPose() const;
 
 			// Get the scene this entity is part of.
 			Scene* GetScene() const;
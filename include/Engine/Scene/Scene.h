@@ -6,6 +6,24 @@
 
 #include <vector>
 
+namespace gp1
+{
+	namespace renderer::culling
+	{
+		struct StaticInstanceGroup;
+	}
+
+	namespace renderer::voxel
+	{
+		struct VoxelMaterialTable;
+	}
+
+	namespace voxel
+	{
+		class WorldPartition;
+	}
+}
+
 namespace gp1::scene
 {
 	class Entity;
@@ -27,9 +45,30 @@ namespace gp1::scene
 		// Get all entities this scene holds.
 		const std::vector<Entity*>& GetEntities();
 
+		// Attach a static instance group to this scene.
+		void AttachStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group);
+		// Detach a static instance group from this scene.
+		void DetachStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group);
+
+		// Get all static instance groups this scene holds.
+		const std::vector<renderer::culling::StaticInstanceGroup*>& GetStaticInstanceGroups();
+
+		// Set the material table the voxel chunks of this scene are drawn with.
+		void SetVoxelMaterialTable(renderer::voxel::VoxelMaterialTable* table);
+		// Get the material table the voxel chunks of this scene are drawn with.
+		renderer::voxel::VoxelMaterialTable* GetVoxelMaterialTable();
+
+		// Set the world partition streaming the voxel world around the main camera.
+		void SetWorldPartition(voxel::WorldPartition* worldPartition);
+		// Get the world partition streaming the voxel world around the main camera.
+		voxel::WorldPartition* GetWorldPartition();
+
 	private:
-		std::vector<Entity*> m_Entities;             // The entities this scene holds.
-		Camera*              m_MainCamera = nullptr; // The main camera of this scene.
+		std::vector<Entity*>                                 m_Entities;                     // The entities this scene holds.
+		std::vector<renderer::culling::StaticInstanceGroup*> m_StaticInstanceGroups;         // The static instance groups this scene holds, these are culled on the gpu.
+		renderer::voxel::VoxelMaterialTable*                 m_VoxelMaterialTable = nullptr; // The material table of the voxel chunks, bound once per frame.
+		voxel::WorldPartition*                               m_WorldPartition     = nullptr; // The world partition streaming the voxel world.
+		Camera*                                              m_MainCamera         = nullptr; // The main camera of this scene.
 	};
 
 } // namespace gp1::scene
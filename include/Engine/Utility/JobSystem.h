@@ -0,0 +1,64 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace gp1
+{
+	class JobSystem
+	{
+	public:
+		// Start the given number of workers, 0 uses one less than the hardware's thread count.
+		JobSystem(uint32_t workerCount = 0);
+		~JobSystem();
+
+		// Queue a job on the workers.
+		// Returns a future that receives the job's result.
+		template <typename F>
+		auto Submit(F&& job) -> std::future<decltype(job())>
+		{
+			using Result = decltype(job());
+
+			auto                task   = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(job));
+			std::future<Result> future = task->get_future();
+			Push([task]() { (*task)(); });
+			return future;
+		}
+
+		// Run job(i) for every i in [0, count) on the workers and the calling thread, returns when all of them are done.
+		// The calling thread takes part in the work, so this is safe to call from inside a job.
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& job);
+
+		// Get the number of workers.
+		uint32_t GetWorkerCount() const;
+
+	public:
+		// Get the job system shared by the engine.
+		static JobSystem* GetInstance();
+
+	private:
+		// Add a job to the queue and wake a worker.
+		void Push(std::function<void()> job);
+		// Run queued jobs until the job system is destroyed.
+		void WorkerLoop();
+
+	private:
+		std::vector<std::thread>          m_Workers;        // The worker threads.
+		std::deque<std::function<void()>> m_Jobs;           // The queued jobs.
+		std::mutex                        m_Mutex;          // The mutex guarding the queue.
+		std::condition_variable           m_Condition;      // Signalled when a job is queued or the workers should stop.
+		bool                              m_Running = true; // Should the workers keep running.
+	};
+
+} // namespace gp1
@@ -0,0 +1,103 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include <glm.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace gp1::voxel
+{
+	using BlockID = uint16_t;
+
+	constexpr BlockID s_AirBlock = 0; // The block id of empty space.
+
+	struct ChunkPositionHash
+	{
+	public:
+		size_t operator()(const glm::ivec3& position) const
+		{
+			return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(position.x)) * 73856093ULL) ^ (static_cast<uint64_t>(static_cast<uint32_t>(position.y)) * 19349663ULL) ^ (static_cast<uint64_t>(static_cast<uint32_t>(position.z)) * 83492791ULL));
+		}
+	};
+
+	struct ChunkMemoryStats
+	{
+	public:
+		size_t   m_PaletteBytes = 0; // The bytes used by the palette and its reference counts.
+		size_t   m_IndexBytes   = 0; // The bytes used by the packed palette indices.
+		size_t   m_TotalBytes   = 0; // The bytes used by the whole chunk.
+		uint32_t m_PaletteSize  = 0; // The number of palette entries.
+		uint32_t m_BitsPerIndex = 0; // The bits per packed index, 0 for uniform chunks.
+	};
+
+	// A chunk stores its blocks as indices into a palette of the block ids it contains.
+	// The indices are bit packed with just enough bits for the palette, a chunk of a single block stores no indices at all.
+	class Chunk
+	{
+	public:
+		static constexpr uint32_t s_Size   = 32;                       // The number of blocks along each axis.
+		static constexpr uint32_t s_Volume = s_Size * s_Size * s_Size; // The number of blocks in a chunk.
+
+	public:
+		Chunk(const glm::ivec3& position = { 0, 0, 0 });
+
+		// Get the block at the given position inside this chunk.
+		BlockID GetBlock(uint32_t x, uint32_t y, uint32_t z) const;
+		// Set the block at the given position inside this chunk.
+		void SetBlock(uint32_t x, uint32_t y, uint32_t z, BlockID block);
+		// Set every block in this chunk.
+		void Fill(BlockID block);
+		// Write all s_Volume blocks in index order into the given array.
+		void Decompress(BlockID* blocks) const;
+
+		// Drop unused palette entries and repack the indices with as few bits as possible.
+		void Compact();
+
+		// Is every block in this chunk the same.
+		bool IsUniform() const;
+		// Is every block in this chunk air.
+		bool IsEmpty() const;
+		// Get the bits per packed index, 0 for uniform chunks.
+		uint32_t GetBitsPerIndex() const;
+		// Get the palette, entries may be unused until the chunk is compacted.
+		const std::vector<BlockID>& GetPalette() const;
+		// Get the memory this chunk uses.
+		ChunkMemoryStats GetMemoryStats() const;
+
+		// Append the compacted chunk to the given buffer.
+		void Serialize(std::vector<uint8_t>& data);
+		// Replace the blocks with ones serialized by Serialize.
+		// Returns false and leaves the chunk untouched if the data is invalid.
+		bool Deserialize(const uint8_t* data, size_t size);
+
+		// Get the position of this chunk in chunks.
+		const glm::ivec3& GetPosition() const;
+
+	public:
+		// Get the index of the given position, x varies fastest then z then y.
+		static constexpr uint32_t GetIndex(uint32_t x, uint32_t y, uint32_t z) { return (y * s_Size + z) * s_Size + x; }
+
+	private:
+		// Get the palette index at the given block index.
+		uint32_t GetPaletteIndex(uint32_t index) const;
+		// Set the palette index at the given block index.
+		void SetPaletteIndex(uint32_t index, uint32_t paletteIndex);
+		// Get the palette index of the block, adding it to the palette if needed.
+		uint32_t FindOrAddPaletteEntry(BlockID block);
+		// Repack the indices with the given bits per index, the palette indices are remapped through the given table if not empty.
+		void Repack(uint32_t bitsPerIndex, const std::vector<uint32_t>& remap = {});
+
+	private:
+		glm::ivec3            m_Position;         // The position of this chunk in chunks.
+		std::vector<BlockID>  m_Palette;          // The block ids in this chunk.
+		std::vector<uint32_t> m_PaletteCounts;    // The number of blocks using each palette entry.
+		std::vector<uint64_t> m_Indices;          // The packed palette indices, indices don't span words.
+		uint32_t              m_BitsPerIndex = 0; // The bits per packed index, 0 for uniform chunks.
+	};
+
+} // namespace gp1::voxel
@@ -0,0 +1,34 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Scene/Entity.h"
+
+#include <glm.hpp>
+
+namespace gp1::voxel
+{
+	class ChunkRemesher;
+
+	// An entity drawing the mesh the remesher keeps for one chunk with the material of the scene's voxel material table.
+	class ChunkEntity : public scene::Entity
+	{
+	public:
+		ChunkEntity(const ChunkRemesher& remesher, const glm::ivec3& position);
+
+		// Gets the chunk's mesh, nullptr until it has any faces.
+		virtual renderer::mesh::Mesh* GetMesh() const override;
+		// Gets the material of the scene's voxel material table.
+		virtual renderer::shader::Material* GetMaterial() const override;
+
+		// Get the position of the chunk in chunks.
+		const glm::ivec3& GetChunkPosition() const;
+
+	private:
+		const ChunkRemesher& m_Remesher;      // The remesher holding the chunk's mesh.
+		glm::ivec3           m_ChunkPosition; // The position of the chunk in chunks.
+	};
+
+} // namespace gp1::voxel
@@ -0,0 +1,63 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticVoxelMesh.h"
+#include "Engine/Voxel/Chunk.h"
+
+#include <vector>
+
+namespace gp1::voxel
+{
+	enum class ChunkFace : uint32_t
+	{
+		POSITIVE_X = 0,
+		NEGATIVE_X = 1,
+		POSITIVE_Y = 2,
+		NEGATIVE_Y = 3,
+		POSITIVE_Z = 4,
+		NEGATIVE_Z = 5
+	};
+
+	struct ChunkNeighbours
+	{
+	public:
+		// Get the neighbour on the given side.
+		const Chunk*& operator[](ChunkFace face) { return this->m_Chunks[static_cast<uint32_t>(face)]; }
+		// Get the neighbour on the given side.
+		const Chunk* operator[](ChunkFace face) const { return this->m_Chunks[static_cast<uint32_t>(face)]; }
+
+	public:
+		const Chunk* m_Chunks[6] { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr }; // The neighbouring chunks, faces against a missing neighbour are always generated.
+	};
+
+	struct ChunkMeshJob
+	{
+	public:
+		renderer::mesh::StaticVoxelMesh* m_Mesh  = nullptr; // The mesh to generate into.
+		const Chunk*                     m_Chunk = nullptr; // The chunk to mesh.
+		ChunkNeighbours                  m_Neighbours;      // The neighbours of the chunk.
+	};
+
+	constexpr uint32_t s_PaddedChunkSize   = Chunk::s_Size + 2;                                      // The size of a chunk with a one block border.
+	constexpr uint32_t s_PaddedChunkVolume = s_PaddedChunkSize * s_PaddedChunkSize * s_PaddedChunkSize; // The number of blocks in a chunk with a one block border.
+
+	// Copy the chunk and a one block border from its neighbours into padded, which has to hold s_PaddedChunkVolume blocks.
+	// Missing neighbours leave the border as air, so the chunk's faces against them are generated.
+	void ExtractPaddedBlocks(BlockID* padded, const Chunk& chunk, const ChunkNeighbours& neighbours);
+	// Append the greedy faces of the blocks in [min, max) of the padded chunk to the vertices and indices.
+	// The quads are merged within the region only, so regions can be remeshed independently.
+	void GenerateGreedyRegionMesh(const BlockID* padded, const glm::ivec3& min, const glm::ivec3& max, std::vector<renderer::mesh::StaticVoxelMeshVertex>& vertices, std::vector<uint32_t>& indices);
+
+	// Generate a mesh merging coplanar faces of the same block into quads and put it inside the given mesh.
+	// The vertices are in block units relative to the chunk, the uvs are in blocks so textures repeat across merged quads and SSBOIndex is the block id.
+	void GenerateGreedyChunkMesh(renderer::mesh::StaticVoxelMesh& mesh, const Chunk& chunk, const ChunkNeighbours& neighbours = {});
+	// Generate a mesh with one quad for every visible block face and put it inside the given mesh.
+	void GenerateNaiveChunkMesh(renderer::mesh::StaticVoxelMesh& mesh, const Chunk& chunk, const ChunkNeighbours& neighbours = {});
+	// Mesh the chunks on the job system's workers, returns when all of them are done.
+	// The meshes must not be used by the renderer while they're generated.
+	void GenerateChunkMeshes(const std::vector<ChunkMeshJob>& jobs, bool greedy = true);
+
+} // namespace gp1::voxel
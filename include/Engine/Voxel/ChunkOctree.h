@@ -0,0 +1,94 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Voxel/Chunk.h"
+
+#include <functional>
+#include <memory>
+
+namespace gp1::voxel
+{
+	struct ChunkOctreeStats
+	{
+	public:
+		uint32_t m_Chunks        = 0; // The number of stored chunks.
+		uint32_t m_UniformChunks = 0; // The number of stored chunks without packed indices.
+		uint32_t m_Nodes         = 0; // The number of octree nodes, including the root.
+		size_t   m_ChunkBytes    = 0; // The bytes used by the chunks.
+		size_t   m_NodeBytes     = 0; // The bytes used by the octree nodes.
+	};
+
+	// A sparse octree of chunks, only the branches leading to stored chunks exist.
+	// Positions without a chunk are air, so empty volumes cost nothing.
+	class ChunkOctree
+	{
+	public:
+		// Create an octree covering 2^depth chunks along each axis centered on the origin.
+		ChunkOctree(uint32_t depth = 12);
+
+		// Is the chunk position inside the octree's bounds.
+		bool Contains(const glm::ivec3& position) const;
+		// Get the chunk at the given position, nullptr if there is none.
+		Chunk* GetChunk(const glm::ivec3& position) const;
+		// Get the chunk at the given position, creating an empty one if there is none.
+		// Returns nullptr if the position is outside the octree's bounds.
+		Chunk* GetOrCreateChunk(const glm::ivec3& position);
+		// Store the chunk at its position, replacing the chunk stored there.
+		// Returns nullptr and deletes the chunk if its position is outside the octree's bounds.
+		Chunk* InsertChunk(std::unique_ptr<Chunk> chunk);
+		// Remove the chunk at the given position along with the branch leading to it and hand it to the caller.
+		// Returns nullptr if there is no chunk.
+		std::unique_ptr<Chunk> ExtractChunk(const glm::ivec3& position);
+		// Remove and delete the chunk at the given position along with the branch leading to it.
+		void RemoveChunk(const glm::ivec3& position);
+		// Remove every chunk that is all air.
+		// Returns the number of removed chunks.
+		uint32_t RemoveEmptyChunks();
+
+		// Get the block at the given block position, air if there is no chunk.
+		BlockID GetBlock(const glm::ivec3& position) const;
+		// Set the block at the given block position, chunks are only created for blocks that aren't air.
+		void SetBlock(const glm::ivec3& position, BlockID block);
+
+		// Call the function for every stored chunk.
+		void ForEachChunk(const std::function<void(Chunk&)>& function) const;
+		// Call the function for every stored chunk with a position in [min, max].
+		void ForEachChunkInBox(const glm::ivec3& min, const glm::ivec3& max, const std::function<void(Chunk&)>& function) const;
+
+		// Get the memory used by the octree and its chunks.
+		ChunkOctreeStats GetMemoryStats() const;
+
+	private:
+		struct Node
+		{
+		public:
+			std::unique_ptr<Node>  m_Children[8]; // The child octants.
+			std::unique_ptr<Chunk> m_Chunk;       // The chunk of a leaf node.
+		};
+
+	private:
+		// Get the leaf node of the chunk position, creating the branch leading to it.
+		Node* GetOrCreateLeaf(const glm::ivec3& position);
+
+		// Get the child of the octant at the given level containing the offset position.
+		static uint32_t GetChildIndex(const glm::uvec3& offset, uint32_t level);
+		// Remove the chunks the predicate holds for, returns whether the node became empty.
+		static bool RemoveChunks(std::unique_ptr<Node>& node, const std::function<bool(Chunk&)>& predicate, uint32_t& removed);
+		// Call the function for every chunk in the node overlapping [min, max] in offset positions.
+		static void ForEachChunkInNode(const Node& node, const glm::uvec3& nodeMin, uint32_t nodeSize, const glm::uvec3& min, const glm::uvec3& max, const std::function<void(Chunk&)>& function);
+		// Accumulate the stats of the node and its children.
+		static void AccumulateStats(const Node& node, ChunkOctreeStats& stats);
+
+		// Get the position relative to the octree's minimum corner.
+		glm::uvec3 ToOffset(const glm::ivec3& position) const;
+
+	private:
+		std::unique_ptr<Node> m_Root;     // The root node.
+		uint32_t              m_Depth;    // The number of levels below the root.
+		int32_t               m_HalfSize; // Half the number of chunks along each axis.
+	};
+
+} // namespace gp1::voxel
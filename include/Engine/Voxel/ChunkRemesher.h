@@ -0,0 +1,123 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Renderer/Mesh/StaticVoxelMesh.h"
+#include "Engine/Voxel/ChunkOctree.h"
+
+#include <future>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace gp1::voxel
+{
+	struct ChunkRemeshStats
+	{
+	public:
+		uint32_t m_DirtySections    = 0;   // The sections waiting to be remeshed.
+		uint32_t m_JobsInFlight     = 0;   // The remesh jobs running on the workers.
+		uint32_t m_SectionsApplied  = 0;   // The remeshed sections written into their meshes this update.
+		uint32_t m_LayoutRebuilds   = 0;   // The meshes that had to be laid out again this update.
+		uint32_t m_UploadedVertices = 0;   // The vertices marked for upload this update.
+		uint32_t m_UploadedIndices  = 0;   // The indices marked for upload this update.
+		double   m_Milliseconds     = 0.0; // The time spent on the calling thread this update.
+	};
+
+	// Keeps the meshes of the world's chunks up to date with block edits.
+	// Chunks are split into horizontal sections that are remeshed on their own, every section owns a slot in its chunk's
+	// vertex and index arrays so a remeshed section that still fits is uploaded as just that range.
+	class ChunkRemesher
+	{
+	public:
+		static constexpr uint32_t s_SectionHeight = 4;                               // The number of block layers in a section.
+		static constexpr uint32_t s_SectionCount  = Chunk::s_Size / s_SectionHeight; // The number of sections in a chunk.
+
+	public:
+		ChunkRemesher(ChunkOctree& world, uint32_t maxJobsInFlight = 8);
+
+		// Mark the sections whose faces the block at the given block position affects dirty, including sections of neighbouring chunks.
+		void MarkBlockDirty(const glm::ivec3& position);
+		// Mark the whole chunk at the given chunk position dirty, creating its mesh if it has none.
+		void MarkChunkDirty(const glm::ivec3& position);
+		// Drop the mesh of the chunk at the given chunk position.
+		void RemoveChunk(const glm::ivec3& position);
+
+		// Get the mesh of the chunk at the given chunk position, nullptr if it has none.
+		renderer::mesh::StaticVoxelMesh* GetMesh(const glm::ivec3& position) const;
+
+		// Write finished sections into their meshes and start jobs for the dirty sections closest to the camera.
+		// Stops once the time spent on the calling thread exceeds the budget.
+		void Update(const glm::fvec3& cameraPosition, double budgetMilliseconds);
+
+		// Get the stats of the last update.
+		const ChunkRemeshStats& GetStats() const;
+
+	private:
+		struct Section
+		{
+		public:
+			uint32_t m_FirstVertex    = 0; // The first vertex of the section's slot.
+			uint32_t m_VertexCapacity = 0; // The number of vertices in the section's slot.
+			uint32_t m_VertexCount    = 0; // The number of vertices the section uses.
+			uint32_t m_FirstIndex     = 0; // The first index of the section's slot.
+			uint32_t m_IndexCapacity  = 0; // The number of indices in the section's slot.
+			uint32_t m_IndexCount     = 0; // The number of indices the section uses, the rest of the slot is degenerate triangles.
+		};
+
+		struct ChunkMeshState
+		{
+		public:
+			std::unique_ptr<renderer::mesh::StaticVoxelMesh> m_Mesh;                     // The mesh of the chunk.
+			Section                                          m_Sections[s_SectionCount]; // The slots of the sections.
+			uint32_t                                         m_DirtySections = 0;        // A bit for every section that has to be remeshed.
+			uint32_t                                         m_Generation    = 0;        // Tells this mesh apart from the chunk's meshes before it was removed and added again.
+			bool                                             m_HasLayout     = false;    // Have the sections been given slots yet.
+			bool                                             m_JobInFlight   = false;    // Is a worker remeshing this chunk.
+		};
+
+		struct SectionMesh
+		{
+		public:
+			std::vector<renderer::mesh::StaticVoxelMeshVertex> m_Vertices; // The vertices of the section.
+			std::vector<uint32_t>                              m_Indices;  // The indices of the section, relative to its first vertex.
+		};
+
+		struct RemeshResult
+		{
+		public:
+			uint32_t    m_Sections = 0;           // A bit for every remeshed section.
+			SectionMesh m_Meshes[s_SectionCount]; // The meshes of the remeshed sections.
+		};
+
+		struct RemeshJob
+		{
+		public:
+			glm::ivec3                                 m_Position;       // The chunk being remeshed.
+			uint32_t                                   m_Generation = 0; // The generation of the chunk's mesh when the job started.
+			std::future<std::unique_ptr<RemeshResult>> m_Result;         // The result of the worker.
+		};
+
+	private:
+		// Snapshot the chunk and its border and start a job remeshing its dirty sections.
+		void Dispatch(const glm::ivec3& position, ChunkMeshState& state);
+		// Write the remeshed sections into the chunk's mesh.
+		void Apply(ChunkMeshState& state, RemeshResult& result);
+		// Give every section a new slot with room to grow and rewrite the whole mesh.
+		void RebuildLayout(ChunkMeshState& state, RemeshResult& result);
+		// Mark the sections of the chunk at the given chunk position dirty if the chunk has a mesh.
+		void MarkSectionsDirty(const glm::ivec3& position, uint32_t sections);
+
+	private:
+		ChunkOctree& m_World;              // The world the chunks are taken from.
+		uint32_t     m_MaxJobsInFlight;    // The most remesh jobs running at once.
+		uint32_t     m_NextGeneration = 0; // The generation given to the next new mesh.
+
+		std::unordered_map<glm::ivec3, ChunkMeshState, ChunkPositionHash> m_Chunks; // The meshes of the chunks.
+		std::vector<RemeshJob>                                             m_Jobs;   // The running remesh jobs.
+		ChunkRemeshStats                                                   m_Stats;  // The stats of the last update.
+	};
+
+} // namespace gp1::voxel
@@ -0,0 +1,154 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#pragma once
+
+#include "Engine/Voxel/ChunkEntity.h"
+#include "Engine/Voxel/ChunkOctree.h"
+#include "Engine/Voxel/ChunkRemesher.h"
+
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace gp1::scene
+{
+	class Scene;
+}
+
+namespace gp1::voxel
+{
+	struct WorldPartitionStats
+	{
+	public:
+		uint32_t m_ResidentCells  = 0;     // The cells whose chunks are all in the world.
+		uint32_t m_PendingLoads   = 0;     // The cells being read or generated on the workers.
+		uint32_t m_PendingUploads = 0;     // The loaded cells waiting for their chunks to be handed to the world.
+		uint32_t m_PendingSaves   = 0;     // The unloaded cells being written on the workers.
+		uint32_t m_CellsLoaded    = 0;     // The cells that became resident this update.
+		uint32_t m_CellsUnloaded  = 0;     // The cells that were unloaded this update.
+		uint32_t m_ChunksUploaded = 0;     // The chunks handed to the world this update.
+		uint32_t m_Stalls         = 0;     // The updates so far where the camera's cell wasn't resident.
+		bool     m_Stalled        = false; // Was the camera's cell not resident this update.
+		double   m_Milliseconds   = 0.0;   // The time spent on the calling thread this update.
+	};
+
+	// Fills the chunks of a cell that has never been saved, the chunks have to be inside the cell.
+	// Called on a worker thread.
+	using CellGenerator = std::function<void(const glm::ivec3& cellPosition, std::vector<std::unique_ptr<Chunk>>& chunks)>;
+
+	// Streams the world in cells of chunks around the camera, so the world doesn't have to fit in memory.
+	// Cells are read from and written to one file each on the workers, and the chunks of loaded cells are handed to
+	// the world and the remesher a few at a time on the calling thread.
+	// A cell is loaded once the camera comes within the load radius and unloaded once it leaves the larger unload radius,
+	// so a camera moving along a cell border doesn't load and unload the same cells over and over.
+	class WorldPartition
+	{
+	public:
+		WorldPartition(ChunkOctree& world, ChunkRemesher& remesher, const std::filesystem::path& directory, uint32_t cellSize = 4);
+		// Waits for the pending loads, and saves every modified cell still resident.
+		~WorldPartition();
+
+		// Set the generator used for cells without a file.
+		void SetGenerator(CellGenerator generator);
+		// Set the radii in blocks, the unload radius is kept at least as large as the load radius.
+		void SetRadii(float loadRadius, float unloadRadius);
+
+		// Get the block at the given block position, air if its cell isn't resident.
+		BlockID GetBlock(const glm::ivec3& position) const;
+		// Set the block at the given block position, marking its cell for saving and its sections for remeshing.
+		// Returns false if the block's cell isn't resident.
+		bool SetBlock(const glm::ivec3& position, BlockID block);
+
+		// Stream the cells around the scene's main camera, and attach the entities of the uploaded chunks to the scene.
+		// Hands loaded chunks to the world until the budget is spent, and gives the remesher what is left of it.
+		void Update(scene::Scene* scene, double budgetMilliseconds);
+		// Write every modified resident cell and wait for all pending saves.
+		void SaveAll();
+
+		// Get the cell containing the block position.
+		glm::ivec3 GetCellPosition(const glm::ivec3& blockPosition) const;
+		// Are all chunks of the cell in the world.
+		bool IsCellResident(const glm::ivec3& cellPosition) const;
+
+		// Get the stats of the last update.
+		const WorldPartitionStats& GetStats() const;
+
+	public:
+		uint32_t m_MaxPendingLoads = 8;  // The most load jobs running at once.
+		uint32_t m_MaxChunkUploads = 16; // The most chunks handed to the world per update.
+
+	private:
+		enum class CellState : uint32_t
+		{
+			LOADING,
+			UPLOADING,
+			RESIDENT
+		};
+
+		struct CellData
+		{
+		public:
+			std::vector<std::unique_ptr<Chunk>> m_Chunks; // The chunks of the cell.
+		};
+
+		struct Cell
+		{
+		public:
+			CellState                              m_State = CellState::LOADING; // The state of the cell.
+			std::future<std::unique_ptr<CellData>> m_Load;                       // The result of the load job.
+			std::unique_ptr<CellData>              m_Data;                       // The loaded chunks not yet handed to the world.
+			uint32_t                               m_NextUpload = 0;             // The next chunk of the loaded data to hand to the world.
+			std::vector<glm::ivec3>                m_Chunks;                     // The chunks of this cell in the world.
+			bool                                   m_Modified = false;           // Has a block in this cell been changed since it was loaded.
+			bool                                   m_Unload   = false;           // Should the cell be dropped once its load finishes.
+		};
+
+	private:
+		// Get the center of the cell in blocks.
+		glm::fvec3 GetCellCenter(const glm::ivec3& cellPosition) const;
+		// Get the file of the cell.
+		std::filesystem::path GetCellPath(const glm::ivec3& cellPosition) const;
+
+		// Start a job reading or generating the cell.
+		void RequestLoad(const glm::ivec3& cellPosition);
+		// Hand the next loaded chunk of the cell to the world, returns false once the cell has no chunks left.
+		bool UploadChunk(Cell& cell, scene::Scene* scene);
+		// Take the cell's chunks out of the world and save them if they were modified.
+		void Unload(const glm::ivec3& cellPosition, Cell& cell);
+		// Start a job serializing the chunks and writing them to the cell's file.
+		void RequestSave(const glm::ivec3& cellPosition, std::vector<std::unique_ptr<Chunk>> chunks);
+		// Start a job writing the data to the cell's file, after calling the serialize function on the worker if one is given.
+		void RequestWrite(const glm::ivec3& cellPosition, std::shared_ptr<std::vector<uint8_t>> data, std::function<void()> serialize = nullptr);
+		// Drop the saves that have finished.
+		void CollectSaves();
+
+		// Read the cell's file, returns false if there is none or it is invalid.
+		// Chunks outside the cell are skipped, as another cell owns them.
+		static bool ReadCell(const std::filesystem::path& path, const glm::ivec3& cellPosition, int32_t cellSize, CellData& data);
+		// Write the data to the cell's file.
+		static bool WriteCell(const std::filesystem::path& path, const std::vector<uint8_t>& data);
+
+	private:
+		ChunkOctree&          m_World;     // The world the cells' chunks are handed to.
+		ChunkRemesher&        m_Remesher;  // The remesher meshing the cells' chunks.
+		std::filesystem::path m_Directory; // The directory holding the cells' files.
+		CellGenerator         m_Generator; // The generator used for cells without a file.
+		int32_t               m_CellSize;  // The number of chunks along each axis of a cell.
+
+		scene::Scene* m_Scene = nullptr; // The scene the chunks' entities are attached to.
+
+		float m_LoadRadius   = 256.0f; // The distance in blocks within which cells are loaded.
+		float m_UnloadRadius = 320.0f; // The distance in blocks beyond which cells are unloaded.
+
+		std::unordered_map<glm::ivec3, Cell, ChunkPositionHash>                          m_Cells;   // The cells being loaded or in the world.
+		std::unordered_map<glm::ivec3, std::shared_future<void>, ChunkPositionHash>      m_Saves;   // The saves running on the workers, loads of the same cell wait for them.
+		std::unordered_map<glm::ivec3, std::unique_ptr<ChunkEntity>, ChunkPositionHash> m_Entities; // The entities drawing the chunks in the world.
+		WorldPartitionStats                                                              m_Stats;   // The stats of the last update.
+	};
+
+} // namespace gp1::voxel
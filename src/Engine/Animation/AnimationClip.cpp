@@ -0,0 +1,117 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationMath.h"
+
+#include <algorithm>
+
+namespace gp1::animation
+{
+	// Find the key before the time and how far the time is towards the next key.
+	static void FindKey(const std::vector<float>& times, float time, uint32_t& key, float& factor)
+	{
+		auto next = std::upper_bound(times.begin(), times.end(), time);
+		if (next == times.begin())
+		{
+			key    = 0;
+			factor = 0.0f;
+			return;
+		}
+		if (next == times.end())
+		{
+			key    = static_cast<uint32_t>(times.size() - 1);
+			factor = 0.0f;
+			return;
+		}
+
+		key          = static_cast<uint32_t>(next - times.begin() - 1);
+		float length = *next - times[key];
+		factor       = length > 0.0f ? (time - times[key]) / length : 0.0f;
+	}
+
+	// Interpolate a vector channel at the time.
+	static glm::fvec3 SampleVectors(const std::vector<float>& times, const std::vector<glm::fvec3>& keys, float time)
+	{
+		uint32_t key;
+		float    factor;
+		FindKey(times, time, key, factor);
+		if (factor == 0.0f)
+			return keys[key];
+		return keys[key] + (keys[key + 1] - keys[key]) * factor;
+	}
+
+	AnimationClip::AnimationClip(const std::string& name, float duration, bool looping)
+	    : m_Name(name), m_Duration(duration), m_Looping(looping) {}
+
+	JointTrack& AnimationClip::GetTrack(uint32_t joint)
+	{
+		if (joint >= this->m_Tracks.size())
+			this->m_Tracks.resize(static_cast<size_t>(joint) + 1);
+		return this->m_Tracks[joint];
+	}
+
+	const std::vector<JointTrack>& AnimationClip::GetTracks() const
+	{
+		return this->m_Tracks;
+	}
+
+	const std::string& AnimationClip::GetName() const
+	{
+		return this->m_Name;
+	}
+
+	float AnimationClip::GetDuration() const
+	{
+		return this->m_Duration;
+	}
+
+	bool AnimationClip::IsLooping() const
+	{
+		return this->m_Looping;
+	}
+
+	void AnimationClip::Sample(float time, std::vector<JointTransform>& transforms) const
+	{
+		// The scratch is per thread so clips can be sampled by several jobs at once.
+		thread_local std::vector<glm::fquat> from;
+		thread_local std::vector<glm::fquat> to;
+		thread_local std::vector<float>      factors;
+		thread_local std::vector<uint32_t>   joints;
+		from.clear();
+		to.clear();
+		factors.clear();
+		joints.clear();
+
+		time         = std::clamp(time, 0.0f, this->m_Duration);
+		size_t count = std::min(this->m_Tracks.size(), transforms.size());
+		for (size_t i = 0; i < count; i++)
+		{
+			const JointTrack& track     = this->m_Tracks[i];
+			JointTransform&   transform = transforms[i];
+			if (!track.m_Translations.empty())
+				transform.m_Translation = SampleVectors(track.m_TranslationTimes, track.m_Translations, time);
+			if (!track.m_Scales.empty())
+				transform.m_Scale = SampleVectors(track.m_ScaleTimes, track.m_Scales, time);
+
+			if (track.m_Rotations.empty())
+				continue;
+
+			uint32_t key;
+			float    factor;
+			FindKey(track.m_RotationTimes, time, key, factor);
+			uint32_t next = factor > 0.0f ? key + 1 : key;
+			from.push_back(track.m_Rotations[key]);
+			to.push_back(track.m_Rotations[next]);
+			factors.push_back(factor);
+			joints.push_back(static_cast<uint32_t>(i));
+		}
+
+		uint32_t rotationCount = static_cast<uint32_t>(joints.size());
+		NLerpQuaternions(from.data(), to.data(), factors.data(), 0.0f, from.data(), rotationCount);
+		for (uint32_t i = 0; i < rotationCount; i++)
+			transforms[joints[i]].m_Rotation = from[i];
+	}
+
+} // namespace gp1::animation
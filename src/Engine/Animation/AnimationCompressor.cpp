@@ -0,0 +1,533 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/AnimationCompressor.h"
+#include "Engine/Animation/AnimationMath.h"
+#include "Engine/Animation/Pose.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace gp1::animation
+{
+	static Logger s_CompressorLogger("Animation Compressor");
+
+	// How one channel was encoded and the values its encoding reconstructs at every frame.
+	struct ChannelChoice
+	{
+	public:
+		ChannelEncoding         m_Encoding = ChannelEncoding::EMPTY; // The encoding of the channel.
+		uint8_t                 m_Bits     = 0;                      // The bits per component of per frame encodings.
+		glm::fvec3              m_First { 0.0f };                    // The constant value, the linear start or the quantized minimum.
+		glm::fvec3              m_Second { 0.0f };                   // The linear end or the quantized extent.
+		std::vector<glm::fvec3> m_Values;                            // The values reconstructed at every frame.
+	};
+
+	// The bit rates tried for quantized channels, lowest first.
+	constexpr uint8_t s_MinBits = 3;
+	constexpr uint8_t s_MaxBits = 16;
+
+	// Get the largest quantized value of the bit rate.
+	static uint32_t GetMaxQuantized(uint32_t bits)
+	{
+		return static_cast<uint32_t>((1ULL << bits) - 1);
+	}
+
+	// Quantize a component to the bit rate in its range.
+	static uint32_t QuantizeComponent(float value, uint32_t bits, float minimum, float extent)
+	{
+		if (extent <= 0.0f)
+			return 0;
+		float normalized = std::clamp((value - minimum) / extent, 0.0f, 1.0f);
+		return static_cast<uint32_t>(std::lround(normalized * static_cast<float>(GetMaxQuantized(bits))));
+	}
+
+	// Write bits into the data at the bit offset.
+	static void WriteBits(uint8_t* data, uint32_t offset, uint32_t bits, uint32_t value)
+	{
+		for (uint32_t i = 0; i < bits; i++, offset++)
+			if ((value >> i) & 1)
+				data[offset >> 3] |= static_cast<uint8_t>(1 << (offset & 7));
+	}
+
+	// Build the candidate's values at every frame the same way CompressedAnimationClip::Sample reconstructs them.
+	static void ReconstructChannel(ChannelChoice& choice, const std::vector<glm::fvec3>& samples, const std::vector<float>& clipAlphas, bool rotation)
+	{
+		size_t frameCount = samples.size();
+		choice.m_Values.resize(frameCount);
+		switch (choice.m_Encoding)
+		{
+		case ChannelEncoding::CONSTANT:
+			std::fill(choice.m_Values.begin(), choice.m_Values.end(), choice.m_First);
+			break;
+		case ChannelEncoding::LINEAR:
+			for (size_t i = 0; i < frameCount; i++)
+			{
+				if (rotation)
+				{
+					// Rotations are blended as quaternions, the xyz of the result is what the rotation matrix is built from again.
+					glm::fquat from = RotationFromVector(choice.m_First);
+					glm::fquat to   = RotationFromVector(choice.m_Second);
+					glm::fquat result;
+					if (clipAlphas[i] > 0.0f)
+						NLerpQuaternions(&from, &to, nullptr, clipAlphas[i], &result, 1);
+					else
+						result = from;
+					choice.m_Values[i] = { result.x, result.y, result.z };
+				}
+				else
+				{
+					choice.m_Values[i] = choice.m_First + (choice.m_Second - choice.m_First) * clipAlphas[i];
+				}
+			}
+			break;
+		case ChannelEncoding::QUANTIZED:
+			for (size_t i = 0; i < frameCount; i++)
+				for (uint32_t c = 0; c < 3; c++)
+					choice.m_Values[i][c] = DequantizeComponent(QuantizeComponent(samples[i][c], choice.m_Bits, choice.m_First[c], choice.m_Second[c]), choice.m_Bits, choice.m_First[c], choice.m_Second[c]);
+			break;
+		case ChannelEncoding::RAW:
+		default:
+			choice.m_Values = samples;
+			break;
+		}
+	}
+
+	// Compresses the channels of one clip, joint by joint.
+	class ClipCompressor
+	{
+	public:
+		ClipCompressor(const AnimationClip& clip, const Skeleton& skeleton, const CompressionSettings& settings)
+		    : m_Clip(clip), m_Skeleton(skeleton), m_Settings(settings)
+		{
+			this->m_JointCount = skeleton.GetJointCount();
+			this->m_FrameCount = static_cast<uint32_t>(std::ceil(clip.GetDuration() * settings.m_SampleRate - 0.001f)) + 1;
+			if (clip.GetDuration() <= 0.0f)
+				this->m_FrameCount = 1;
+			for (uint32_t i = 0; i < this->m_FrameCount; i++)
+			{
+				float time = std::min(static_cast<float>(i) / settings.m_SampleRate, clip.GetDuration());
+				this->m_ClipAlphas.push_back(clip.GetDuration() > 0.0f ? time / clip.GetDuration() : 0.0f);
+			}
+		}
+
+		// Compress every channel and build the clip.
+		CompressedAnimationClip Compress()
+		{
+			SampleClip();
+			FindDepths();
+
+			this->m_LossyModels.resize(static_cast<size_t>(this->m_JointCount) * this->m_FrameCount);
+			this->m_Choices.resize(static_cast<size_t>(this->m_JointCount) * ChannelType::COUNT);
+			for (uint32_t joint = 0; joint < this->m_JointCount; joint++)
+				CompressJoint(joint);
+
+			return Build();
+		}
+
+	private:
+		// Sample the clip at every frame, making every rotation's w positive.
+		void SampleClip()
+		{
+			std::vector<JointTransform> bind;
+			for (const Joint& joint : this->m_Skeleton.GetJoints())
+				bind.push_back(joint.m_BindTransform);
+
+			this->m_Locals.resize(static_cast<size_t>(this->m_JointCount) * this->m_FrameCount);
+			this->m_Models.resize(this->m_Locals.size());
+			std::vector<JointTransform> transforms;
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				transforms = bind;
+				this->m_Clip.Sample(this->m_ClipAlphas[frame] * this->m_Clip.GetDuration(), transforms);
+				for (uint32_t joint = 0; joint < this->m_JointCount; joint++)
+				{
+					JointTransform& transform = transforms[joint];
+					if (transform.m_Rotation.w < 0.0f)
+						transform.m_Rotation = glm::fquat(-transform.m_Rotation.w, -transform.m_Rotation.x, -transform.m_Rotation.y, -transform.m_Rotation.z);
+					GetLocal(joint, frame) = transform;
+
+					int32_t parent = this->m_Skeleton.GetJoint(joint).m_Parent;
+					if (parent >= 0)
+						MultiplyMatrices(GetModel(parent, frame), transform.ToMatrix(), GetModel(joint, frame));
+					else
+						GetModel(joint, frame) = transform.ToMatrix();
+				}
+			}
+		}
+
+		// Find the depth of every joint and the depth of the deepest joint below it, and the joints below every joint.
+		void FindDepths()
+		{
+			this->m_Depths.resize(this->m_JointCount);
+			this->m_DeepestDepths.resize(this->m_JointCount);
+			this->m_Descendants.resize(this->m_JointCount);
+			for (uint32_t joint = 0; joint < this->m_JointCount; joint++)
+			{
+				int32_t parent               = this->m_Skeleton.GetJoint(joint).m_Parent;
+				this->m_Depths[joint]        = parent >= 0 ? this->m_Depths[parent] + 1 : 0;
+				this->m_DeepestDepths[joint] = this->m_Depths[joint];
+				for (int32_t ancestor = parent; ancestor >= 0; ancestor = this->m_Skeleton.GetJoint(ancestor).m_Parent)
+				{
+					this->m_DeepestDepths[ancestor] = std::max(this->m_DeepestDepths[ancestor], this->m_Depths[joint]);
+					this->m_Descendants[ancestor].push_back(joint);
+				}
+			}
+		}
+
+		// Pick the encoding of every channel of the joint and calculate its compressed model matrices.
+		void CompressJoint(uint32_t joint)
+		{
+			// The points measured are around the joint and every joint below it, in the joint's space at every frame,
+			// along with where the uncompressed clip puts them.
+			const std::vector<uint32_t>& descendants = this->m_Descendants[joint];
+			size_t                       pointCount  = 3 * (descendants.size() + 1);
+			this->m_Points.resize(pointCount * this->m_FrameCount);
+			this->m_Targets.resize(this->m_Points.size());
+			this->m_Relatives.resize(this->m_JointCount);
+
+			float distance = this->m_Settings.m_VertexDistance;
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				// The joints below are moved into the joint's space by chaining their local matrices, which avoids inverting the model matrix.
+				this->m_Relatives[joint] = glm::fmat4(1.0f);
+				for (uint32_t descendant : descendants)
+					MultiplyMatrices(this->m_Relatives[this->m_Skeleton.GetJoint(descendant).m_Parent], GetLocal(descendant, frame).ToMatrix(), this->m_Relatives[descendant]);
+
+				for (size_t i = 0; i <= descendants.size(); i++)
+				{
+					uint32_t point = i == 0 ? joint : descendants[i - 1];
+					for (uint32_t axis = 0; axis < 3; axis++)
+					{
+						glm::fvec4 offset { 0.0f, 0.0f, 0.0f, 1.0f };
+						offset[axis]           = distance;
+						size_t index           = frame * pointCount + i * 3 + axis;
+						this->m_Points[index]  = this->m_Relatives[point] * offset;
+						this->m_Targets[index] = GetModel(point, frame) * offset;
+					}
+				}
+			}
+
+			float bound = this->m_Settings.m_MaxError * static_cast<float>(this->m_Depths[joint] + 1) / static_cast<float>(this->m_DeepestDepths[joint] + 1);
+			for (uint32_t type : { ChannelType::ROTATION, ChannelType::TRANSLATION, ChannelType::SCALE })
+				CompressChannel(joint, type, bound);
+
+			int32_t parent = this->m_Skeleton.GetJoint(joint).m_Parent;
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				glm::fmat4 local = GetLossyMatrix(joint, frame);
+				if (parent >= 0)
+					MultiplyMatrices(this->m_LossyModels[static_cast<size_t>(parent) * this->m_FrameCount + frame], local, this->m_LossyModels[static_cast<size_t>(joint) * this->m_FrameCount + frame]);
+				else
+					this->m_LossyModels[static_cast<size_t>(joint) * this->m_FrameCount + frame] = local;
+			}
+		}
+
+		// Pick the cheapest encoding of the channel within the bound.
+		void CompressChannel(uint32_t joint, uint32_t type, float bound)
+		{
+			ChannelChoice& choice = this->m_Choices[static_cast<size_t>(joint) * ChannelType::COUNT + type];
+			if (!IsAnimated(joint, type))
+				return;
+
+			bool                    rotation = type == ChannelType::ROTATION;
+			std::vector<glm::fvec3> samples(this->m_FrameCount);
+			glm::fvec3              minimum(std::numeric_limits<float>::max());
+			glm::fvec3              maximum(std::numeric_limits<float>::lowest());
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				const JointTransform& transform = GetLocal(joint, frame);
+				samples[frame]                  = type == ChannelType::TRANSLATION ? transform.m_Translation : (rotation ? glm::fvec3 { transform.m_Rotation.x, transform.m_Rotation.y, transform.m_Rotation.z } : transform.m_Scale);
+				minimum                         = glm::min(minimum, samples[frame]);
+				maximum                         = glm::max(maximum, samples[frame]);
+			}
+
+			// Constant and linear channels don't take any space per frame, so they are tried first.
+			ChannelChoice candidate;
+			candidate.m_Encoding = ChannelEncoding::CONSTANT;
+			candidate.m_First    = (minimum + maximum) * 0.5f;
+			if (TryCandidate(joint, type, candidate, samples, bound))
+			{
+				choice = candidate;
+				return;
+			}
+
+			candidate.m_Encoding = ChannelEncoding::LINEAR;
+			candidate.m_First    = samples.front();
+			candidate.m_Second   = samples.back();
+			if (TryCandidate(joint, type, candidate, samples, bound))
+			{
+				choice = candidate;
+				return;
+			}
+
+			// The error shrinks as bits are added, so the lowest bit rate within the bound is found by bisection.
+			candidate.m_Encoding = ChannelEncoding::QUANTIZED;
+			candidate.m_First    = minimum;
+			candidate.m_Second   = maximum - minimum;
+			uint8_t low          = s_MinBits;
+			uint8_t high         = s_MaxBits + 1;
+			while (low < high)
+			{
+				uint8_t middle   = (low + high) / 2;
+				candidate.m_Bits = middle;
+				if (TryCandidate(joint, type, candidate, samples, bound))
+					high = middle;
+				else
+					low = middle + 1;
+			}
+			if (low <= s_MaxBits)
+			{
+				candidate.m_Bits = low;
+			}
+			else
+			{
+				candidate.m_Encoding = ChannelEncoding::RAW;
+				candidate.m_Bits     = 32;
+			}
+			ReconstructChannel(candidate, samples, this->m_ClipAlphas, rotation);
+			choice = candidate;
+		}
+
+		// Reconstruct the candidate and check whether it keeps the joint within the bound.
+		bool TryCandidate(uint32_t joint, uint32_t type, ChannelChoice& candidate, const std::vector<glm::fvec3>& samples, float bound)
+		{
+			ReconstructChannel(candidate, samples, this->m_ClipAlphas, type == ChannelType::ROTATION);
+
+			// The channels not picked yet are still uncompressed, so the error is only that of the channels picked so far.
+			ChannelChoice& current = this->m_Choices[static_cast<size_t>(joint) * ChannelType::COUNT + type];
+			std::swap(current, candidate);
+			float error = MeasureJointError(joint);
+			std::swap(current, candidate);
+			return error <= bound;
+		}
+
+		// Get the largest distance between the compressed and uncompressed points around the joint and the joints below it.
+		float MeasureJointError(uint32_t joint)
+		{
+			int32_t parent     = this->m_Skeleton.GetJoint(joint).m_Parent;
+			size_t  pointCount = this->m_Points.size() / this->m_FrameCount;
+			float   error      = 0.0f;
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				glm::fmat4 model = GetLossyMatrix(joint, frame);
+				if (parent >= 0)
+					MultiplyMatrices(this->m_LossyModels[static_cast<size_t>(parent) * this->m_FrameCount + frame], model, model);
+
+				for (size_t i = 0; i < pointCount; i++)
+				{
+					size_t     index  = frame * pointCount + i;
+					glm::fvec4 offset = model * this->m_Points[index] - this->m_Targets[index];
+					error             = std::max(error, offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+				}
+			}
+			return std::sqrt(error);
+		}
+
+		// Get the local matrix of the joint with the channels picked so far.
+		glm::fmat4 GetLossyMatrix(uint32_t joint, uint32_t frame)
+		{
+			JointTransform transform = GetLocal(joint, frame);
+			for (uint32_t type = 0; type < ChannelType::COUNT; type++)
+			{
+				const ChannelChoice& choice = this->m_Choices[static_cast<size_t>(joint) * ChannelType::COUNT + type];
+				if (choice.m_Values.empty())
+					continue;
+
+				const glm::fvec3& value = choice.m_Values[frame];
+				if (type == ChannelType::TRANSLATION)
+					transform.m_Translation = value;
+				else if (type == ChannelType::ROTATION)
+					transform.m_Rotation = RotationFromVector(value);
+				else
+					transform.m_Scale = value;
+			}
+			return transform.ToMatrix();
+		}
+
+		// Does the source clip have keys for the channel.
+		bool IsAnimated(uint32_t joint, uint32_t type) const
+		{
+			const std::vector<JointTrack>& tracks = this->m_Clip.GetTracks();
+			if (joint >= tracks.size())
+				return false;
+			if (type == ChannelType::TRANSLATION)
+				return !tracks[joint].m_Translations.empty();
+			if (type == ChannelType::ROTATION)
+				return !tracks[joint].m_Rotations.empty();
+			return !tracks[joint].m_Scales.empty();
+		}
+
+		// Lay out the header, name, channels, values and frames in one block.
+		CompressedAnimationClip Build()
+		{
+			std::vector<CompressedChannel> channels(this->m_Choices.size());
+			std::vector<float>             values;
+			uint32_t                       frameBits = 0;
+			uint32_t                       counts[5] { 0, 0, 0, 0, 0 };
+			for (size_t i = 0; i < this->m_Choices.size(); i++)
+			{
+				const ChannelChoice& choice  = this->m_Choices[i];
+				CompressedChannel&   channel = channels[i];
+				channel.m_Encoding           = choice.m_Encoding;
+				channel.m_Bits               = choice.m_Bits;
+				channel.m_Padding            = 0;
+				channel.m_Value              = static_cast<uint32_t>(values.size());
+				channel.m_BitOffset          = frameBits;
+				counts[static_cast<uint32_t>(choice.m_Encoding)]++;
+				switch (choice.m_Encoding)
+				{
+				case ChannelEncoding::CONSTANT:
+					values.insert(values.end(), { choice.m_First.x, choice.m_First.y, choice.m_First.z });
+					break;
+				case ChannelEncoding::LINEAR:
+				case ChannelEncoding::QUANTIZED:
+					values.insert(values.end(), { choice.m_First.x, choice.m_First.y, choice.m_First.z, choice.m_Second.x, choice.m_Second.y, choice.m_Second.z });
+					break;
+				default:
+					break;
+				}
+				frameBits += 3 * choice.m_Bits;
+			}
+
+			std::string name        = this->m_Clip.GetName();
+			uint32_t    frameStride = (frameBits + 7) / 8;
+
+			CompressedClipHeader header;
+			header.m_Magic          = CompressedAnimationClip::s_Magic;
+			header.m_Version        = CompressedAnimationClip::s_Version;
+			header.m_Flags          = this->m_Clip.IsLooping() ? 1 : 0;
+			header.m_Duration       = std::max(this->m_Clip.GetDuration(), 0.0f);
+			header.m_SampleRate     = this->m_Settings.m_SampleRate;
+			header.m_FrameCount     = this->m_FrameCount;
+			header.m_FrameStride    = frameStride;
+			header.m_JointCount     = this->m_JointCount;
+			header.m_ValueCount     = static_cast<uint32_t>(values.size());
+			header.m_NameOffset     = sizeof(CompressedClipHeader);
+			header.m_NameLength     = static_cast<uint32_t>(name.size());
+			header.m_ChannelsOffset = (header.m_NameOffset + header.m_NameLength + 3) & ~3U;
+			header.m_ValuesOffset   = header.m_ChannelsOffset + static_cast<uint32_t>(channels.size() * sizeof(CompressedChannel));
+			header.m_FramesOffset   = header.m_ValuesOffset + static_cast<uint32_t>(values.size() * sizeof(float));
+			// The frames are followed by padding, so reading a channel never needs a bounds check.
+			header.m_Size           = header.m_FramesOffset + this->m_FrameCount * frameStride + sizeof(uint64_t);
+
+			std::vector<uint8_t> data(header.m_Size, 0);
+			std::memcpy(data.data(), &header, sizeof(header));
+			std::memcpy(data.data() + header.m_NameOffset, name.data(), name.size());
+			std::memcpy(data.data() + header.m_ChannelsOffset, channels.data(), channels.size() * sizeof(CompressedChannel));
+			std::memcpy(data.data() + header.m_ValuesOffset, values.data(), values.size() * sizeof(float));
+			for (uint32_t frame = 0; frame < this->m_FrameCount; frame++)
+			{
+				uint8_t* frameData = data.data() + header.m_FramesOffset + static_cast<size_t>(frame) * frameStride;
+				for (size_t i = 0; i < this->m_Choices.size(); i++)
+				{
+					const ChannelChoice& choice = this->m_Choices[i];
+					if (choice.m_Bits == 0)
+						continue;
+
+					const glm::fvec3& sample = GetLocalChannel(static_cast<uint32_t>(i / ChannelType::COUNT), static_cast<uint32_t>(i % ChannelType::COUNT), frame);
+					for (uint32_t c = 0; c < 3; c++)
+					{
+						uint32_t value;
+						if (choice.m_Encoding == ChannelEncoding::RAW)
+							std::memcpy(&value, &sample[c], sizeof(float));
+						else
+							value = QuantizeComponent(sample[c], choice.m_Bits, choice.m_First[c], choice.m_Second[c]);
+						WriteBits(frameData, channels[i].m_BitOffset + c * choice.m_Bits, choice.m_Bits, value);
+					}
+				}
+			}
+
+			s_CompressorLogger.LogDebug("Compressed '%s' to %u bytes, %u frames with %u bytes each, %u constant, %u linear, %u quantized and %u raw channels", name.c_str(), header.m_Size, this->m_FrameCount, frameStride, counts[1], counts[2], counts[3], counts[4]);
+
+			CompressedAnimationClip clip;
+			clip.SetData(std::move(data));
+			return clip;
+		}
+
+		// Get the uncompressed components of the channel at the frame.
+		glm::fvec3 GetLocalChannel(uint32_t joint, uint32_t type, uint32_t frame)
+		{
+			const JointTransform& transform = GetLocal(joint, frame);
+			if (type == ChannelType::TRANSLATION)
+				return transform.m_Translation;
+			if (type == ChannelType::ROTATION)
+				return { transform.m_Rotation.x, transform.m_Rotation.y, transform.m_Rotation.z };
+			return transform.m_Scale;
+		}
+
+		// Get the uncompressed local transform of the joint at the frame.
+		JointTransform& GetLocal(uint32_t joint, uint32_t frame)
+		{
+			return this->m_Locals[static_cast<size_t>(joint) * this->m_FrameCount + frame];
+		}
+
+		// Get the uncompressed model matrix of the joint at the frame.
+		glm::fmat4& GetModel(uint32_t joint, uint32_t frame)
+		{
+			return this->m_Models[static_cast<size_t>(joint) * this->m_FrameCount + frame];
+		}
+
+	private:
+		const AnimationClip&       m_Clip;           // The clip being compressed.
+		const Skeleton&            m_Skeleton;       // The skeleton the clip animates.
+		const CompressionSettings& m_Settings;       // The settings of the compression.
+		uint32_t                   m_JointCount = 0; // The number of joints.
+		uint32_t                   m_FrameCount = 0; // The number of frames.
+
+		std::vector<float>                 m_ClipAlphas;    // How far through the clip every frame is.
+		std::vector<JointTransform>        m_Locals;        // The uncompressed local transforms, joint major.
+		std::vector<glm::fmat4>            m_Models;        // The uncompressed model matrices, joint major.
+		std::vector<glm::fmat4>            m_LossyModels;   // The compressed model matrices of the joints done so far, joint major.
+		std::vector<uint32_t>              m_Depths;        // The depth of every joint.
+		std::vector<uint32_t>              m_DeepestDepths; // The depth of the deepest joint below every joint.
+		std::vector<std::vector<uint32_t>> m_Descendants;   // The joints below every joint.
+		std::vector<ChannelChoice>         m_Choices;       // The encoding of every channel.
+		std::vector<glm::fmat4>            m_Relatives;     // The matrices from the joints below the current joint to its space.
+		std::vector<glm::fvec4>            m_Points;        // The points measured for the current joint in its space, frame major.
+		std::vector<glm::fvec4>            m_Targets;       // Where the uncompressed clip puts the points.
+	};
+
+	CompressedAnimationClip CompressAnimationClip(const AnimationClip& clip, const Skeleton& skeleton, const CompressionSettings& settings)
+	{
+		if (skeleton.GetJointCount() == 0 || settings.m_SampleRate <= 0.0f)
+			return {};
+
+		ClipCompressor compressor(clip, skeleton, settings);
+		return compressor.Compress();
+	}
+
+	float MeasureAnimationError(const AnimationSource& reference, const AnimationSource& animation, const Skeleton& skeleton, float vertexDistance, uint32_t sampleCount)
+	{
+		Pose  referencePose(&skeleton);
+		Pose  pose(&skeleton);
+		float error = 0.0f;
+		for (uint32_t i = 0; i < sampleCount; i++)
+		{
+			float time = sampleCount > 1 ? reference.GetDuration() * static_cast<float>(i) / static_cast<float>(sampleCount - 1) : 0.0f;
+			referencePose.SetBindPose();
+			pose.SetBindPose();
+			reference.Sample(time, referencePose.m_LocalTransforms);
+			animation.Sample(time, pose.m_LocalTransforms);
+			referencePose.CalculateModelMatrices();
+			pose.CalculateModelMatrices();
+
+			for (uint32_t joint = 0; joint < skeleton.GetJointCount(); joint++)
+			{
+				for (uint32_t axis = 0; axis < 3; axis++)
+				{
+					glm::fvec4 offset { 0.0f, 0.0f, 0.0f, 1.0f };
+					offset[axis]          = vertexDistance;
+					glm::fvec4 difference = pose.m_ModelMatrices[joint] * offset - referencePose.m_ModelMatrices[joint] * offset;
+					error                 = std::max(error, std::sqrt(difference.x * difference.x + difference.y * difference.y + difference.z * difference.z));
+				}
+			}
+		}
+		return error;
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,119 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/AnimationMath.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define GP1_ANIMATION_SSE
+	#include <emmintrin.h>
+#endif
+
+namespace gp1::animation
+{
+	static_assert(sizeof(glm::fquat) == 4 * sizeof(float), "The quaternion kernels load quaternions as four packed floats");
+
+	void NLerpQuaternions(const glm::fquat* a, const glm::fquat* b, const float* factors, float weight, glm::fquat* out, uint32_t count)
+	{
+		uint32_t i = 0;
+#ifdef GP1_ANIMATION_SSE
+		// Four quaternions are transposed into one register per component, so every step works on four pairs.
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 one      = _mm_set1_ps(1.0f);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 ax = _mm_loadu_ps(&a[i].x);
+			__m128 ay = _mm_loadu_ps(&a[i + 1].x);
+			__m128 az = _mm_loadu_ps(&a[i + 2].x);
+			__m128 aw = _mm_loadu_ps(&a[i + 3].x);
+			__m128 bx = _mm_loadu_ps(&b[i].x);
+			__m128 by = _mm_loadu_ps(&b[i + 1].x);
+			__m128 bz = _mm_loadu_ps(&b[i + 2].x);
+			__m128 bw = _mm_loadu_ps(&b[i + 3].x);
+			_MM_TRANSPOSE4_PS(ax, ay, az, aw);
+			_MM_TRANSPOSE4_PS(bx, by, bz, bw);
+			__m128 t = factors ? _mm_loadu_ps(factors + i) : _mm_set1_ps(weight);
+
+			__m128 dot  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			__m128 sign = _mm_and_ps(dot, signMask);
+			bx          = _mm_xor_ps(bx, sign);
+			by          = _mm_xor_ps(by, sign);
+			bz          = _mm_xor_ps(bz, sign);
+			bw          = _mm_xor_ps(bw, sign);
+
+			__m128 rx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(bx, ax), t));
+			__m128 ry = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(by, ay), t));
+			__m128 rz = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(bz, az), t));
+			__m128 rw = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(bw, aw), t));
+
+			__m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+			__m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+			rx                   = _mm_mul_ps(rx, inverseLength);
+			ry                   = _mm_mul_ps(ry, inverseLength);
+			rz                   = _mm_mul_ps(rz, inverseLength);
+			rw                   = _mm_mul_ps(rw, inverseLength);
+
+			_MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+			_mm_storeu_ps(&out[i].x, rx);
+			_mm_storeu_ps(&out[i + 1].x, ry);
+			_mm_storeu_ps(&out[i + 2].x, rz);
+			_mm_storeu_ps(&out[i + 3].x, rw);
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			float      t   = factors ? factors[i] : weight;
+			glm::fquat q   = b[i];
+			float      dot = a[i].x * q.x + a[i].y * q.y + a[i].z * q.z + a[i].w * q.w;
+			if (dot < 0.0f)
+				q = glm::fquat(-q.w, -q.x, -q.y, -q.z);
+
+			glm::fquat r(a[i].w + (q.w - a[i].w) * t, a[i].x + (q.x - a[i].x) * t, a[i].y + (q.y - a[i].y) * t, a[i].z + (q.z - a[i].z) * t);
+			float      inverseLength = 1.0f / std::sqrt(r.x * r.x + r.y * r.y + r.z * r.z + r.w * r.w);
+			out[i]                   = glm::fquat(r.w * inverseLength, r.x * inverseLength, r.y * inverseLength, r.z * inverseLength);
+		}
+	}
+
+	void MultiplyQuaternions(const glm::fquat* a, const glm::fquat* b, glm::fquat* out, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const glm::fquat p = a[i];
+			const glm::fquat q = b[i];
+			float            w = p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z;
+			float            x = p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y;
+			float            y = p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z;
+			float            z = p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x;
+			out[i]             = glm::fquat(w, x, y, z);
+		}
+	}
+
+	void MultiplyMatrices(const glm::fmat4& a, const glm::fmat4& b, glm::fmat4& out)
+	{
+#ifdef GP1_ANIMATION_SSE
+		// Every column of the result is the columns of a weighted by the matching column of b.
+		__m128 a0 = _mm_loadu_ps(&a[0][0]);
+		__m128 a1 = _mm_loadu_ps(&a[1][0]);
+		__m128 a2 = _mm_loadu_ps(&a[2][0]);
+		__m128 a3 = _mm_loadu_ps(&a[3][0]);
+		__m128 columns[4];
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			__m128 column = _mm_loadu_ps(&b[i][0]);
+			__m128 x      = _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 y      = _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 z      = _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2));
+			__m128 w      = _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3));
+			columns[i]    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, x), _mm_mul_ps(a1, y)), _mm_add_ps(_mm_mul_ps(a2, z), _mm_mul_ps(a3, w)));
+		}
+		for (uint32_t i = 0; i < 4; i++)
+			_mm_storeu_ps(&out[i][0], columns[i]);
+#else
+		out = a * b;
+#endif
+	}
+
+} // namespace gp1::animation
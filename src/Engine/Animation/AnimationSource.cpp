@@ -0,0 +1,24 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/AnimationSource.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gp1::animation
+{
+	float AnimationSource::WrapTime(float time) const
+	{
+		float duration = GetDuration();
+		if (duration <= 0.0f)
+			return 0.0f;
+		if (!IsLooping())
+			return std::clamp(time, 0.0f, duration);
+
+		time = std::fmod(time, duration);
+		return time < 0.0f ? time + duration : time;
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,83 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/Animator.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/Blending.h"
+#include "Engine/Utility/JobSystem.h"
+
+namespace gp1::animation
+{
+	Animator::Animator(const Skeleton* skeleton)
+	    : m_Pose(skeleton)
+	{
+		this->m_BindTransforms = this->m_Pose.m_LocalTransforms;
+	}
+
+	uint32_t Animator::AddLayer(const AnimationLayer& layer)
+	{
+		this->m_Layers.push_back(layer);
+		return static_cast<uint32_t>(this->m_Layers.size() - 1);
+	}
+
+	AnimationLayer& Animator::GetLayer(uint32_t index)
+	{
+		return this->m_Layers[index];
+	}
+
+	uint32_t Animator::GetLayerCount() const
+	{
+		return static_cast<uint32_t>(this->m_Layers.size());
+	}
+
+	void Animator::Update(float deltaTime)
+	{
+		for (AnimationLayer& layer : this->m_Layers)
+			if (layer.m_Clip)
+				layer.m_Time = layer.m_Clip->WrapTime(layer.m_Time + deltaTime * layer.m_Speed);
+	}
+
+	void Animator::Evaluate()
+	{
+		std::vector<JointTransform>& transforms = this->m_Pose.m_LocalTransforms;
+		transforms                              = this->m_BindTransforms;
+		for (const AnimationLayer& layer : this->m_Layers)
+		{
+			if (!layer.m_Clip || layer.m_Weight <= 0.0f)
+				continue;
+
+			const float* mask = nullptr;
+			if (layer.m_JointMask && layer.m_JointMask->size() >= transforms.size())
+				mask = layer.m_JointMask->data();
+
+			// Joints the clip doesn't animate keep their bind transform, which adds nothing in an additive layer.
+			this->m_Sampled = this->m_BindTransforms;
+			layer.m_Clip->Sample(layer.m_Time, this->m_Sampled);
+			if (layer.m_Additive)
+			{
+				MakeAdditiveTransforms(this->m_Sampled, this->m_BindTransforms, this->m_Sampled);
+				ApplyAdditiveTransforms(transforms, this->m_Sampled, layer.m_Weight, mask, transforms);
+			}
+			else
+			{
+				BlendTransforms(transforms, this->m_Sampled, layer.m_Weight, mask, transforms);
+			}
+		}
+		this->m_Pose.CalculateModelMatrices();
+	}
+
+	const Pose& Animator::GetPose() const
+	{
+		return this->m_Pose;
+	}
+
+	void EvaluateAnimators(const std::vector<Animator*>& animators, float deltaTime)
+	{
+		JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(animators.size()), [&animators, deltaTime](uint32_t i) {
+			animators[i]->Update(deltaTime);
+			animators[i]->Evaluate();
+		});
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,109 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/Blending.h"
+#include "Engine/Animation/AnimationMath.h"
+
+#include <algorithm>
+
+namespace gp1::animation
+{
+	// The rotations are gathered out of the transforms into packed arrays for the SIMD kernels.
+	// The scratch is per thread so poses can be blended by several jobs at once.
+	struct BlendScratch
+	{
+	public:
+		// Resize every array to hold count joints.
+		void Resize(size_t count)
+		{
+			this->m_From.resize(count);
+			this->m_To.resize(count);
+			this->m_Factors.resize(count);
+		}
+
+	public:
+		std::vector<glm::fquat> m_From;    // The rotations blended from.
+		std::vector<glm::fquat> m_To;      // The rotations blended to.
+		std::vector<float>      m_Factors; // The weight of every joint.
+	};
+
+	static thread_local BlendScratch s_BlendScratch;
+
+	// Fill the scratch factors with the masked weights.
+	static void SetFactors(float weight, const float* mask, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			s_BlendScratch.m_Factors[i] = mask ? weight * mask[i] : weight;
+	}
+
+	void BlendTransforms(const std::vector<JointTransform>& a, const std::vector<JointTransform>& b, float weight, const float* mask, std::vector<JointTransform>& out)
+	{
+		size_t count = std::min(a.size(), b.size());
+		s_BlendScratch.Resize(count);
+		SetFactors(weight, mask, count);
+		for (size_t i = 0; i < count; i++)
+		{
+			s_BlendScratch.m_From[i] = a[i].m_Rotation;
+			s_BlendScratch.m_To[i]   = b[i].m_Rotation;
+		}
+		NLerpQuaternions(s_BlendScratch.m_From.data(), s_BlendScratch.m_To.data(), s_BlendScratch.m_Factors.data(), 0.0f, s_BlendScratch.m_From.data(), static_cast<uint32_t>(count));
+
+		out.resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			float t              = s_BlendScratch.m_Factors[i];
+			out[i].m_Translation = a[i].m_Translation + (b[i].m_Translation - a[i].m_Translation) * t;
+			out[i].m_Scale       = a[i].m_Scale + (b[i].m_Scale - a[i].m_Scale) * t;
+			out[i].m_Rotation    = s_BlendScratch.m_From[i];
+		}
+	}
+
+	void MakeAdditiveTransforms(const std::vector<JointTransform>& transforms, const std::vector<JointTransform>& reference, std::vector<JointTransform>& out)
+	{
+		size_t count = std::min(transforms.size(), reference.size());
+		s_BlendScratch.Resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			const glm::fquat& rotation = reference[i].m_Rotation;
+			s_BlendScratch.m_From[i]   = glm::fquat(rotation.w, -rotation.x, -rotation.y, -rotation.z);
+			s_BlendScratch.m_To[i]     = transforms[i].m_Rotation;
+		}
+		MultiplyQuaternions(s_BlendScratch.m_From.data(), s_BlendScratch.m_To.data(), s_BlendScratch.m_From.data(), static_cast<uint32_t>(count));
+
+		out.resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i].m_Translation = transforms[i].m_Translation - reference[i].m_Translation;
+			out[i].m_Scale       = transforms[i].m_Scale / reference[i].m_Scale;
+			out[i].m_Rotation    = s_BlendScratch.m_From[i];
+		}
+	}
+
+	void ApplyAdditiveTransforms(const std::vector<JointTransform>& base, const std::vector<JointTransform>& additive, float weight, const float* mask, std::vector<JointTransform>& out)
+	{
+		size_t count = std::min(base.size(), additive.size());
+		s_BlendScratch.Resize(count);
+		SetFactors(weight, mask, count);
+		for (size_t i = 0; i < count; i++)
+		{
+			s_BlendScratch.m_From[i] = glm::fquat(1.0f, 0.0f, 0.0f, 0.0f);
+			s_BlendScratch.m_To[i]   = additive[i].m_Rotation;
+		}
+		// Scaling the additive rotation by the weight is a blend from the identity, which is then applied after the base rotation.
+		NLerpQuaternions(s_BlendScratch.m_From.data(), s_BlendScratch.m_To.data(), s_BlendScratch.m_Factors.data(), 0.0f, s_BlendScratch.m_To.data(), static_cast<uint32_t>(count));
+		for (size_t i = 0; i < count; i++)
+			s_BlendScratch.m_From[i] = base[i].m_Rotation;
+		MultiplyQuaternions(s_BlendScratch.m_From.data(), s_BlendScratch.m_To.data(), s_BlendScratch.m_From.data(), static_cast<uint32_t>(count));
+
+		out.resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			float t              = s_BlendScratch.m_Factors[i];
+			out[i].m_Translation = base[i].m_Translation + additive[i].m_Translation * t;
+			out[i].m_Scale       = base[i].m_Scale * (glm::fvec3(1.0f) + (additive[i].m_Scale - glm::fvec3(1.0f)) * t);
+			out[i].m_Rotation    = s_BlendScratch.m_From[i];
+		}
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,304 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/CompressedAnimationClip.h"
+#include "Engine/Animation/AnimationMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace gp1::animation
+{
+	// Read bits from the data starting at the bit offset, the data needs 8 readable bytes from the offset's byte on.
+	static uint32_t ReadBits(const uint8_t* data, uint32_t offset, uint32_t bits)
+	{
+		uint64_t word;
+		std::memcpy(&word, data + (offset >> 3), sizeof(word));
+		return static_cast<uint32_t>((word >> (offset & 7)) & ((1ULL << bits) - 1));
+	}
+
+	glm::fquat RotationFromVector(const glm::fvec3& vector)
+	{
+		float w = std::sqrt(std::max(0.0f, 1.0f - vector.x * vector.x - vector.y * vector.y - vector.z * vector.z));
+		return glm::fquat(w, vector.x, vector.y, vector.z);
+	}
+
+	float DequantizeComponent(uint32_t value, uint32_t bits, float minimum, float extent)
+	{
+		return minimum + extent * (static_cast<float>(value) / static_cast<float>((1ULL << bits) - 1));
+	}
+
+	bool CompressedAnimationClip::SetData(std::vector<uint8_t> data)
+	{
+		this->m_OwnedData = std::move(data);
+		if (Validate(this->m_OwnedData.data(), this->m_OwnedData.size()))
+			return true;
+
+		this->m_OwnedData.clear();
+		return false;
+	}
+
+	bool CompressedAnimationClip::SetView(const uint8_t* data, size_t size)
+	{
+		this->m_OwnedData.clear();
+		return Validate(data, size);
+	}
+
+	bool CompressedAnimationClip::LoadFromFile(const std::filesystem::path& path)
+	{
+		FILE* file = fopen(path.string().c_str(), "rb");
+		if (!file)
+			return false;
+
+		std::vector<uint8_t> bytes;
+		fseek(file, 0, SEEK_END);
+		long length = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		if (length > 0)
+		{
+			bytes.resize(static_cast<size_t>(length));
+			bytes.resize(fread(bytes.data(), 1, bytes.size(), file));
+		}
+		fclose(file);
+
+		return SetData(std::move(bytes));
+	}
+
+	bool CompressedAnimationClip::SaveToFile(const std::filesystem::path& path) const
+	{
+		if (!IsValid())
+			return false;
+
+		FILE* file = fopen(path.string().c_str(), "wb");
+		if (!file)
+			return false;
+
+		bool written = fwrite(this->m_Data, 1, this->m_Size, file) == this->m_Size;
+		fclose(file);
+		return written;
+	}
+
+	bool CompressedAnimationClip::IsValid() const
+	{
+		return this->m_Header;
+	}
+
+	std::string CompressedAnimationClip::GetName() const
+	{
+		if (!this->m_Header)
+			return "";
+		return std::string(reinterpret_cast<const char*>(this->m_Data + this->m_Header->m_NameOffset), this->m_Header->m_NameLength);
+	}
+
+	uint32_t CompressedAnimationClip::GetJointCount() const
+	{
+		return this->m_Header ? this->m_Header->m_JointCount : 0;
+	}
+
+	uint32_t CompressedAnimationClip::GetFrameCount() const
+	{
+		return this->m_Header ? this->m_Header->m_FrameCount : 0;
+	}
+
+	float CompressedAnimationClip::GetSampleRate() const
+	{
+		return this->m_Header ? this->m_Header->m_SampleRate : 0.0f;
+	}
+
+	const uint8_t* CompressedAnimationClip::GetData() const
+	{
+		return this->m_Data;
+	}
+
+	size_t CompressedAnimationClip::GetSize() const
+	{
+		return this->m_Size;
+	}
+
+	float CompressedAnimationClip::GetDuration() const
+	{
+		return this->m_Header ? this->m_Header->m_Duration : 0.0f;
+	}
+
+	bool CompressedAnimationClip::IsLooping() const
+	{
+		return this->m_Header && (this->m_Header->m_Flags & 1);
+	}
+
+	void CompressedAnimationClip::Sample(float time, std::vector<JointTransform>& transforms) const
+	{
+		if (!this->m_Header)
+			return;
+
+		// The scratch is per thread so clips can be sampled by several jobs at once.
+		thread_local std::vector<glm::fquat> from;
+		thread_local std::vector<glm::fquat> to;
+		thread_local std::vector<float>      factors;
+		thread_local std::vector<uint32_t>   joints;
+		from.clear();
+		to.clear();
+		factors.clear();
+		joints.clear();
+
+		const CompressedClipHeader& header = *this->m_Header;
+
+		time                = std::clamp(time, 0.0f, header.m_Duration);
+		float    position   = time * header.m_SampleRate;
+		uint32_t frame      = std::min(static_cast<uint32_t>(position), header.m_FrameCount - 1);
+		uint32_t nextFrame  = std::min(frame + 1, header.m_FrameCount - 1);
+		float    frameAlpha = nextFrame > frame ? position - static_cast<float>(frame) : 0.0f;
+		float    clipAlpha  = header.m_Duration > 0.0f ? time / header.m_Duration : 0.0f;
+
+		uint32_t count = std::min(header.m_JointCount, static_cast<uint32_t>(transforms.size()));
+		for (uint32_t i = 0; i < count; i++)
+		{
+			JointTransform& transform = transforms[i];
+			for (uint32_t type = 0; type < ChannelType::COUNT; type++)
+			{
+				const CompressedChannel& channel = this->m_Channels[i * ChannelType::COUNT + type];
+				const float*             values  = this->m_Values + channel.m_Value;
+
+				glm::fvec3 a;
+				glm::fvec3 b;
+				float      alpha;
+				switch (channel.m_Encoding)
+				{
+				case ChannelEncoding::EMPTY:
+					continue;
+				case ChannelEncoding::CONSTANT:
+					a     = { values[0], values[1], values[2] };
+					b     = a;
+					alpha = 0.0f;
+					break;
+				case ChannelEncoding::LINEAR:
+					a     = { values[0], values[1], values[2] };
+					b     = { values[3], values[4], values[5] };
+					alpha = clipAlpha;
+					break;
+				case ChannelEncoding::QUANTIZED:
+				case ChannelEncoding::RAW:
+				default:
+					a     = ReadChannel(channel, frame);
+					b     = frameAlpha > 0.0f ? ReadChannel(channel, nextFrame) : a;
+					alpha = frameAlpha;
+					break;
+				}
+
+				if (type == ChannelType::ROTATION)
+				{
+					if (alpha > 0.0f)
+					{
+						from.push_back(RotationFromVector(a));
+						to.push_back(RotationFromVector(b));
+						factors.push_back(alpha);
+						joints.push_back(i);
+					}
+					else
+					{
+						transform.m_Rotation = RotationFromVector(a);
+					}
+				}
+				else
+				{
+					glm::fvec3& vector = type == ChannelType::TRANSLATION ? transform.m_Translation : transform.m_Scale;
+					vector             = a + (b - a) * alpha;
+				}
+			}
+		}
+
+		uint32_t rotationCount = static_cast<uint32_t>(joints.size());
+		NLerpQuaternions(from.data(), to.data(), factors.data(), 0.0f, from.data(), rotationCount);
+		for (uint32_t i = 0; i < rotationCount; i++)
+			transforms[joints[i]].m_Rotation = from[i];
+	}
+
+	bool CompressedAnimationClip::Validate(const uint8_t* data, size_t size)
+	{
+		this->m_Data     = nullptr;
+		this->m_Size     = 0;
+		this->m_Header   = nullptr;
+		this->m_Channels = nullptr;
+		this->m_Values   = nullptr;
+		this->m_Frames   = nullptr;
+
+		if (!data || size < sizeof(CompressedClipHeader) || reinterpret_cast<uintptr_t>(data) % alignof(CompressedClipHeader) != 0)
+			return false;
+
+		const CompressedClipHeader* header = reinterpret_cast<const CompressedClipHeader*>(data);
+		if (header->m_Magic != s_Magic || header->m_Version != s_Version || header->m_Size != size || header->m_FrameCount == 0 || !(header->m_Duration >= 0.0f))
+			return false;
+
+		// Every section has to fit in the data, the sizes are checked in 64 bits so they can't overflow.
+		uint64_t channelsSize = static_cast<uint64_t>(header->m_JointCount) * ChannelType::COUNT * sizeof(CompressedChannel);
+		uint64_t valuesSize   = static_cast<uint64_t>(header->m_ValueCount) * sizeof(float);
+		uint64_t framesSize   = static_cast<uint64_t>(header->m_FrameCount) * header->m_FrameStride + sizeof(uint64_t);
+		if (static_cast<uint64_t>(header->m_NameOffset) + header->m_NameLength > size ||
+		    header->m_ChannelsOffset % 4 != 0 || header->m_ChannelsOffset + channelsSize > size ||
+		    header->m_ValuesOffset % 4 != 0 || header->m_ValuesOffset + valuesSize > size ||
+		    header->m_FramesOffset + framesSize > size)
+			return false;
+
+		const CompressedChannel* channels = reinterpret_cast<const CompressedChannel*>(data + header->m_ChannelsOffset);
+		for (uint32_t i = 0; i < header->m_JointCount * ChannelType::COUNT; i++)
+		{
+			const CompressedChannel& channel = channels[i];
+			switch (channel.m_Encoding)
+			{
+			case ChannelEncoding::EMPTY:
+				break;
+			case ChannelEncoding::CONSTANT:
+				if (static_cast<uint64_t>(channel.m_Value) + 3 > header->m_ValueCount)
+					return false;
+				break;
+			case ChannelEncoding::LINEAR:
+				if (static_cast<uint64_t>(channel.m_Value) + 6 > header->m_ValueCount)
+					return false;
+				break;
+			case ChannelEncoding::QUANTIZED:
+				if (channel.m_Bits == 0 || channel.m_Bits > 31 || static_cast<uint64_t>(channel.m_Value) + 6 > header->m_ValueCount)
+					return false;
+				[[fallthrough]];
+			case ChannelEncoding::RAW:
+				if (static_cast<uint64_t>(channel.m_BitOffset) + 3 * channel.m_Bits > static_cast<uint64_t>(header->m_FrameStride) * 8)
+					return false;
+				if (channel.m_Encoding == ChannelEncoding::RAW && channel.m_Bits != 32)
+					return false;
+				break;
+			default:
+				return false;
+			}
+		}
+
+		this->m_Data     = data;
+		this->m_Size     = size;
+		this->m_Header   = header;
+		this->m_Channels = channels;
+		this->m_Values   = reinterpret_cast<const float*>(data + header->m_ValuesOffset);
+		this->m_Frames   = data + header->m_FramesOffset;
+		return true;
+	}
+
+	glm::fvec3 CompressedAnimationClip::ReadChannel(const CompressedChannel& channel, uint32_t frame) const
+	{
+		const uint8_t* data   = this->m_Frames + static_cast<size_t>(frame) * this->m_Header->m_FrameStride;
+		uint32_t       offset = channel.m_BitOffset;
+		glm::fvec3     result;
+		for (uint32_t i = 0; i < 3; i++, offset += channel.m_Bits)
+		{
+			uint32_t value = ReadBits(data, offset, channel.m_Bits);
+			if (channel.m_Encoding == ChannelEncoding::RAW)
+			{
+				std::memcpy(&result[i], &value, sizeof(float));
+			}
+			else
+			{
+				const float* range = this->m_Values + channel.m_Value;
+				result[i]          = DequantizeComponent(value, channel.m_Bits, range[i], range[3 + i]);
+			}
+		}
+		return result;
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,65 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/Pose.h"
+#include "Engine/Animation/AnimationMath.h"
+
+namespace gp1::animation
+{
+	Pose::Pose(const Skeleton* skeleton)
+	{
+		SetSkeleton(skeleton);
+	}
+
+	void Pose::SetSkeleton(const Skeleton* skeleton)
+	{
+		this->m_Skeleton = skeleton;
+		SetBindPose();
+	}
+
+	const Skeleton* Pose::GetSkeleton() const
+	{
+		return this->m_Skeleton;
+	}
+
+	uint32_t Pose::GetJointCount() const
+	{
+		return static_cast<uint32_t>(this->m_LocalTransforms.size());
+	}
+
+	void Pose::SetBindPose()
+	{
+		this->m_LocalTransforms.clear();
+		if (this->m_Skeleton)
+			for (const Joint& joint : this->m_Skeleton->GetJoints())
+				this->m_LocalTransforms.push_back(joint.m_BindTransform);
+		CalculateModelMatrices();
+	}
+
+	void Pose::CalculateModelMatrices()
+	{
+		this->m_ModelMatrices.resize(this->m_LocalTransforms.size());
+		if (!this->m_Skeleton)
+			return;
+
+		for (size_t i = 0; i < this->m_LocalTransforms.size(); i++)
+		{
+			int32_t parent = this->m_Skeleton->GetJoint(static_cast<uint32_t>(i)).m_Parent;
+			if (parent >= 0)
+				MultiplyMatrices(this->m_ModelMatrices[parent], this->m_LocalTransforms[i].ToMatrix(), this->m_ModelMatrices[i]);
+			else
+				this->m_ModelMatrices[i] = this->m_LocalTransforms[i].ToMatrix();
+		}
+	}
+
+	void Pose::CalculateSkinningMatrices(glm::fmat4* matrices) const
+	{
+		if (!this->m_Skeleton)
+			return;
+
+		for (size_t i = 0; i < this->m_ModelMatrices.size(); i++)
+			MultiplyMatrices(this->m_ModelMatrices[i], this->m_Skeleton->GetJoint(static_cast<uint32_t>(i)).m_InverseBindMatrix, matrices[i]);
+	}
+
+} // namespace gp1::animation
@@ -0,0 +1,80 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Animation/Skeleton.h"
+#include "Engine/Utility/Logger.h"
+
+namespace gp1::animation
+{
+	static Logger s_SkeletonLogger("Skeleton");
+
+	glm::fmat4 JointTransform::ToMatrix() const
+	{
+		const glm::fquat& q  = this->m_Rotation;
+		float             xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		float             xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		float             wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		glm::fmat4 matrix;
+		matrix[0] = glm::fvec4 { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f } * this->m_Scale.x;
+		matrix[1] = glm::fvec4 { 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f } * this->m_Scale.y;
+		matrix[2] = glm::fvec4 { 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f } * this->m_Scale.z;
+		matrix[3] = glm::fvec4 { this->m_Translation, 1.0f };
+		return matrix;
+	}
+
+	uint32_t Skeleton::AddJoint(const std::string& name, int32_t parent, const JointTransform& bindTransform, const glm::fmat4& inverseBindMatrix)
+	{
+		uint32_t index = static_cast<uint32_t>(this->m_Joints.size());
+		if (parent >= static_cast<int32_t>(index))
+		{
+			s_SkeletonLogger.LogWarning("Joint '%s' was added before its parent %d, it is made a root joint", name.c_str(), parent);
+			parent = -1;
+		}
+
+		Joint& joint              = this->m_Joints.emplace_back();
+		joint.m_Name              = name;
+		joint.m_Parent            = parent < 0 ? -1 : parent;
+		joint.m_BindTransform     = bindTransform;
+		joint.m_InverseBindMatrix = inverseBindMatrix;
+		return index;
+	}
+
+	int32_t Skeleton::FindJoint(const std::string& name) const
+	{
+		for (size_t i = 0; i < this->m_Joints.size(); i++)
+			if (this->m_Joints[i].m_Name == name)
+				return static_cast<int32_t>(i);
+		return -1;
+	}
+
+	void Skeleton::CalculateInverseBindMatrices()
+	{
+		std::vector<glm::fmat4> bindMatrices(this->m_Joints.size());
+		for (size_t i = 0; i < this->m_Joints.size(); i++)
+		{
+			Joint& joint    = this->m_Joints[i];
+			bindMatrices[i] = joint.m_BindTransform.ToMatrix();
+			if (joint.m_Parent >= 0)
+				bindMatrices[i] = bindMatrices[joint.m_Parent] * bindMatrices[i];
+			joint.m_InverseBindMatrix = glm::inverse(bindMatrices[i]);
+		}
+	}
+
+	uint32_t Skeleton::GetJointCount() const
+	{
+		return static_cast<uint32_t>(this->m_Joints.size());
+	}
+
+	const Joint& Skeleton::GetJoint(uint32_t index) const
+	{
+		return this->m_Joints[index];
+	}
+
+	const std::vector<Joint>& Skeleton::GetJoints() const
+	{
+		return this->m_Joints;
+	}
+
+} // namespace gp1::animation
@@ -12,10 +12,13 @@
 #include "Engine/Scene/Entity.h"
 #include "Engine/Utility/Config/ConfigManager.h"
 #include "Engine/Utility/Logger.h"
+#include "Engine/Voxel/WorldPartition.h"
 
 #include "Engine/Renderer/Mesh/StaticMesh.h"
 #include "Engine/Renderer/Shader/Material.h"
 #include "Engine/Renderer/Texture/Loaders/TextureLoaders.h"
+#include "Engine/Renderer/Texture/TextureCache.h"
+#include "Engine/Renderer/Texture/TextureStreamer.h"
 #include "Engine/Renderer/Texture/TextureCubeMap.h"
 
 #include "Engine/Audio/AudioCore.h"
@@ -155,10 +158,19 @@ namespace gp1
 			deltaTime     = (curFrame - lastFrame).count() * 1e-9F;
 			lastFrame     = curFrame;
 
+			// Streams the voxel world around the main camera, spending at most 4 ms of the frame on it.
+			voxel::WorldPartition* worldPartition = this->m_Scene.GetWorldPartition();
+			if (worldPartition)
+				worldPartition->Update(&this->m_Scene, 4.0);
+
 			for (scene::Entity* entity : this->m_Scene.GetEntities())
 				entity->Update(deltaTime);
 
 			m_Renderer->Render(&this->m_Scene);
+			// Evicts unused textures once the cache is over budget, after rendering so new uploads are counted.
+			renderer::texture::TextureCache::GetInstance()->Trim();
+			// Loads the levels the streamed textures were drawn at and drops the ones over the budget.
+			renderer::texture::TextureStreamer::GetInstance()->Update();
 			m_Window.OnUpdate();
 			input::JoystickHandler::OnUpdate();
 		}
@@ -166,6 +178,8 @@ namespace gp1
 
 	Application::~Application()
 	{
+		renderer::texture::TextureStreamer::GetInstance()->Clear();
+		renderer::texture::TextureCache::GetInstance()->Clear();
 		this->m_Renderer->DeInit();
 		delete m_Renderer;
 		renderer::shader::Shader::CleanUpShaders();
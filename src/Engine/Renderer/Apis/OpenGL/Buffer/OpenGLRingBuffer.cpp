@@ -0,0 +1,192 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Apis/OpenGL/Buffer/OpenGLRingBuffer.h"
+
+#include <chrono>
+
+namespace gp1::renderer::apis::opengl::buffer
+{
+	Logger OpenGLRingBuffer::s_Logger("OpenGL Ring Buffer");
+
+	OpenGLRingBuffer::OpenGLRingBuffer(GLenum target, uint64_t frameSize, uint32_t framesInFlight)
+	    : m_Target(target), m_FrameSize(frameSize), m_FramesInFlight(framesInFlight > 0 ? framesInFlight : 1) {}
+
+	OpenGLRingBuffer::~OpenGLRingBuffer()
+	{
+		CleanUp();
+	}
+
+	void OpenGLRingBuffer::Init()
+	{
+		if (this->m_Buffer)
+			CleanUp();
+
+		glGenBuffers(1, &this->m_Buffer);
+		glBindBuffer(this->m_Target, this->m_Buffer);
+
+		this->m_Stats.m_Persistent = GLAD_GL_VERSION_4_4;
+		if (this->m_Stats.m_Persistent)
+		{
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			GLsizeiptr size  = static_cast<GLsizeiptr>(this->m_FrameSize * this->m_FramesInFlight);
+			glBufferStorage(this->m_Target, size, nullptr, flags);
+			this->m_MappedData = reinterpret_cast<uint8_t*>(glMapBufferRange(this->m_Target, 0, size, flags));
+			if (!this->m_MappedData)
+			{
+				OpenGLRingBuffer::s_Logger.LogWarning("Failed to persistently map the buffer, falling back to orphaning");
+				glDeleteBuffers(1, &this->m_Buffer);
+				glGenBuffers(1, &this->m_Buffer);
+				glBindBuffer(this->m_Target, this->m_Buffer);
+				this->m_Stats.m_Persistent = false;
+			}
+		}
+
+		if (this->m_Stats.m_Persistent)
+		{
+			this->m_Fences.resize(this->m_FramesInFlight, nullptr);
+		}
+		else
+		{
+			// Orphaning hands the driver a fresh block every frame, so a single section is enough.
+			this->m_FramesInFlight = 1;
+			glBufferData(this->m_Target, static_cast<GLsizeiptr>(this->m_FrameSize), nullptr, GL_STREAM_DRAW);
+			this->m_Staging.resize(this->m_FrameSize);
+		}
+		glBindBuffer(this->m_Target, 0);
+
+		this->m_CurrentSection = 0;
+		this->m_Head           = 0;
+	}
+
+	void OpenGLRingBuffer::CleanUp()
+	{
+		for (GLsync fence : this->m_Fences)
+			if (fence)
+				glDeleteSync(fence);
+		this->m_Fences.clear();
+
+		if (this->m_Buffer)
+		{
+			if (this->m_MappedData)
+			{
+				glBindBuffer(this->m_Target, this->m_Buffer);
+				glUnmapBuffer(this->m_Target);
+				glBindBuffer(this->m_Target, 0);
+				this->m_MappedData = nullptr;
+			}
+			glDeleteBuffers(1, &this->m_Buffer);
+			this->m_Buffer = 0;
+		}
+		this->m_Staging.clear();
+		this->m_Staging.shrink_to_fit();
+	}
+
+	void OpenGLRingBuffer::BeginFrame()
+	{
+		if (!this->m_Buffer)
+			return;
+
+		this->m_Head = 0;
+		this->m_Stats.m_Frames++;
+
+		if (!this->m_Stats.m_Persistent)
+		{
+			glBindBuffer(this->m_Target, this->m_Buffer);
+			glBufferData(this->m_Target, static_cast<GLsizeiptr>(this->m_FrameSize), nullptr, GL_STREAM_DRAW);
+			glBindBuffer(this->m_Target, 0);
+			return;
+		}
+
+		this->m_CurrentSection = (this->m_CurrentSection + 1) % this->m_FramesInFlight;
+		GLsync& fence          = this->m_Fences[this->m_CurrentSection];
+		if (!fence)
+			return;
+
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			// The cpu has caught up with the gpu, there is nothing to do but wait for the section to be released.
+			auto start = std::chrono::high_resolution_clock::now();
+			do
+			{
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			} while (result == GL_TIMEOUT_EXPIRED);
+			double stallTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+			this->m_Stats.m_Stalls++;
+			this->m_Stats.m_StallTime += stallTime;
+			OpenGLRingBuffer::s_Logger.LogDebug("Stalled %.3f ms waiting for the gpu to release section %u (%llu stalls in %llu frames)", stallTime, this->m_CurrentSection, static_cast<unsigned long long>(this->m_Stats.m_Stalls), static_cast<unsigned long long>(this->m_Stats.m_Frames));
+		}
+		if (result == GL_WAIT_FAILED)
+			OpenGLRingBuffer::s_Logger.LogError("Waiting for section %u failed", this->m_CurrentSection);
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	void OpenGLRingBuffer::EndFrame()
+	{
+		if (!this->m_Buffer || !this->m_Stats.m_Persistent)
+			return;
+
+		GLsync& fence = this->m_Fences[this->m_CurrentSection];
+		if (fence)
+			glDeleteSync(fence);
+		fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	RingBufferAllocation OpenGLRingBuffer::Allocate(uint64_t size, uint64_t alignment)
+	{
+		RingBufferAllocation allocation;
+		if (!this->m_Buffer || size == 0)
+			return allocation;
+
+		uint64_t head = alignment > 1 ? (this->m_Head + alignment - 1) / alignment * alignment : this->m_Head;
+		if (head + size > this->m_FrameSize)
+		{
+			if (this->m_Stats.m_Overflows == 0)
+				OpenGLRingBuffer::s_Logger.LogWarning("Allocation of %llu bytes doesn't fit in a %llu byte frame", static_cast<unsigned long long>(size), static_cast<unsigned long long>(this->m_FrameSize));
+			this->m_Stats.m_Overflows++;
+			return allocation;
+		}
+		this->m_Head = head + size;
+		this->m_Stats.m_BytesStreamed += size;
+
+		if (this->m_Stats.m_Persistent)
+		{
+			allocation.m_Offset = this->m_CurrentSection * this->m_FrameSize + head;
+			allocation.m_Data   = this->m_MappedData + allocation.m_Offset;
+		}
+		else
+		{
+			allocation.m_Offset = head;
+			allocation.m_Data   = this->m_Staging.data() + head;
+		}
+		allocation.m_Size = size;
+		return allocation;
+	}
+
+	void OpenGLRingBuffer::Flush(const RingBufferAllocation& allocation)
+	{
+		// The persistent mapping is coherent, so only the fallback has to upload.
+		if (this->m_Stats.m_Persistent || !allocation.m_Data)
+			return;
+
+		glBindBuffer(this->m_Target, this->m_Buffer);
+		glBufferSubData(this->m_Target, static_cast<GLintptr>(allocation.m_Offset), static_cast<GLsizeiptr>(allocation.m_Size), allocation.m_Data);
+		glBindBuffer(this->m_Target, 0);
+	}
+
+	uint32_t OpenGLRingBuffer::GetBuffer() const
+	{
+		return this->m_Buffer;
+	}
+
+	const RingBufferStats& OpenGLRingBuffer::GetStats() const
+	{
+		return this->m_Stats;
+	}
+
+} // namespace gp1::renderer::apis::opengl::buffer
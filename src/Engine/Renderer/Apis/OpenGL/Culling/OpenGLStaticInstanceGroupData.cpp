@@ -0,0 +1,159 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Apis/OpenGL/Culling/OpenGLStaticInstanceGroupData.h"
+
+#include <glad/glad.h>
+
+#include <cstring>
+
+namespace gp1::renderer::apis::opengl::culling
+{
+	// Get the capacity of a buffer that has to hold count instances.
+	// The first allocation is exact as most groups never change size, after that the buffer doubles.
+	static uint32_t GetGrownCapacity(uint32_t capacity, uint32_t count)
+	{
+		uint32_t newCapacity = capacity == 0 ? count : capacity * 2;
+		return newCapacity < count ? count : newCapacity;
+	}
+
+	OpenGLStaticInstanceGroupData::OpenGLStaticInstanceGroupData(renderer::culling::StaticInstanceGroup* group)
+	    : OpenGLRendererData(group) {}
+
+	void OpenGLStaticInstanceGroupData::CleanUp()
+	{
+		if (this->m_InstanceBuffer)
+		{
+			uint32_t buffers[3] { this->m_InstanceBuffer, this->m_VisibleInstanceBuffer, this->m_DrawCommandBuffer };
+			glDeleteBuffers(3, buffers);
+			this->m_InstanceBuffer        = 0;
+			this->m_VisibleInstanceBuffer = 0;
+			this->m_DrawCommandBuffer     = 0;
+		}
+		this->m_InstanceCount    = 0;
+		this->m_InstanceCapacity = 0;
+		this->m_VisibleCapacity  = 0;
+		this->m_SourceBuffer     = 0;
+		this->m_SourceOffset     = 0;
+	}
+
+	void OpenGLStaticInstanceGroupData::UpdateGLData(buffer::OpenGLRingBuffer* streamBuffer, uint64_t streamAlignment)
+	{
+		renderer::culling::StaticInstanceGroup* group = GetDataUnsafe<renderer::culling::StaticInstanceGroup>();
+		group->UpdateBounds();
+
+		if (!this->m_InstanceBuffer)
+		{
+			uint32_t buffers[3];
+			glGenBuffers(3, buffers);
+			this->m_InstanceBuffer        = buffers[0];
+			this->m_VisibleInstanceBuffer = buffers[1];
+			this->m_DrawCommandBuffer     = buffers[2];
+
+			DrawElementsIndirectCommand command;
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->m_DrawCommandBuffer);
+			glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(command), &command, GL_DYNAMIC_DRAW);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		}
+
+		if (group->m_IsDynamic && streamBuffer)
+		{
+			uint32_t instanceCount = static_cast<uint32_t>(group->m_Transforms.size());
+			if (instanceCount == 0)
+			{
+				// Empty groups aren't drawn, so they don't take any of the frame's section.
+				this->m_InstanceCount = 0;
+				group->ClearDirty();
+				return;
+			}
+
+			buffer::RingBufferAllocation allocation = streamBuffer->Allocate(instanceCount * sizeof(glm::fmat4), streamAlignment);
+			if (allocation.m_Data)
+			{
+				std::memcpy(allocation.m_Data, group->m_Transforms.data(), allocation.m_Size);
+				streamBuffer->Flush(allocation);
+
+				this->m_InstanceCount = instanceCount;
+				this->m_SourceBuffer  = streamBuffer->GetBuffer();
+				this->m_SourceOffset  = allocation.m_Offset;
+				EnsureVisibleCapacity();
+				group->ClearDirty();
+				return;
+			}
+			// The frame's section is full, so the instances go through the dedicated buffer this frame.
+			this->m_SourceBuffer = 0;
+		}
+
+		if (!group->IsDirty() && this->m_SourceBuffer == this->m_InstanceBuffer)
+			return;
+
+		this->m_InstanceCount = static_cast<uint32_t>(group->m_Transforms.size());
+		this->m_SourceBuffer  = this->m_InstanceBuffer;
+		this->m_SourceOffset  = 0;
+		if (this->m_InstanceCount > this->m_InstanceCapacity)
+		{
+			this->m_InstanceCapacity = GetGrownCapacity(this->m_InstanceCapacity, this->m_InstanceCount);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->m_InstanceBuffer);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, this->m_InstanceCapacity * sizeof(glm::fmat4), nullptr, group->m_IsDynamic ? GL_STREAM_DRAW : GL_STATIC_DRAW);
+		}
+		EnsureVisibleCapacity();
+
+		if (this->m_InstanceCount > 0)
+		{
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->m_InstanceBuffer);
+			glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, this->m_InstanceCount * sizeof(glm::fmat4), group->m_Transforms.data());
+		}
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		group->ClearDirty();
+	}
+
+	void OpenGLStaticInstanceGroupData::ResetDrawCommand(uint32_t count, bool cullOnGPU)
+	{
+		DrawElementsIndirectCommand command;
+		command.m_Count = count;
+		if (!cullOnGPU)
+		{
+			command.m_InstanceCount = this->m_InstanceCount;
+			glBindBuffer(GL_COPY_READ_BUFFER, this->m_SourceBuffer);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, this->m_VisibleInstanceBuffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(this->m_SourceOffset), 0, this->m_InstanceCount * sizeof(glm::fmat4));
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		}
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->m_DrawCommandBuffer);
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(command), &command);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+
+	void OpenGLStaticInstanceGroupData::BindBuffers()
+	{
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, CullingBufferBinding::INSTANCES, this->m_SourceBuffer, static_cast<GLintptr>(this->m_SourceOffset), this->m_InstanceCount * sizeof(glm::fmat4));
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CullingBufferBinding::DRAW_COMMAND, this->m_DrawCommandBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CullingBufferBinding::VISIBLE_INSTANCES, this->m_VisibleInstanceBuffer);
+	}
+
+	void OpenGLStaticInstanceGroupData::EnsureVisibleCapacity()
+	{
+		if (this->m_InstanceCount <= this->m_VisibleCapacity)
+			return;
+
+		this->m_VisibleCapacity = GetGrownCapacity(this->m_VisibleCapacity, this->m_InstanceCount);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->m_VisibleInstanceBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, this->m_VisibleCapacity * sizeof(glm::fmat4), nullptr, GL_DYNAMIC_COPY);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+
+	uint32_t OpenGLStaticInstanceGroupData::GetInstanceCount() const
+	{
+		return this->m_InstanceCount;
+	}
+
+	uint32_t OpenGLStaticInstanceGroupData::GetDrawCommandBuffer() const
+	{
+		return this->m_DrawCommandBuffer;
+	}
+
+} // namespace gp1::renderer::apis::opengl::culling
@@ -4,6 +4,9 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLMeshData.h"
 
+#include <cstring>
+#include <vector>
+
 namespace gp1::renderer::apis::opengl::mesh
 {
 	GLenum OpenGLMeshData::GetRenderMode() const
@@ -44,10 +47,30 @@ namespace gp1::renderer::apis::opengl::mesh
 		return this->m_HasIndices;
 	}
 
-	uint32_t OpenGLMeshData::GetVAO()
+	GLenum OpenGLMeshData::GetIndexType() const
 	{
-		if (GetDataUnsafe<renderer::mesh::Mesh>()->IsDirty())
-			InitGLData();
+		return this->m_IndexType;
+	}
+
+	bool OpenGLMeshData::HasPackedVertices() const
+	{
+		return this->m_PackedVertices;
+	}
+
+	glm::fmat4 OpenGLMeshData::GetDequantizationMatrix() const
+	{
+		return this->m_PackedVertices ? this->m_PositionBounds.GetDequantizationMatrix() : glm::fmat4(1.0f);
+	}
+
+	uint32_t OpenGLMeshData::GetVAO(buffer::OpenGLRingBuffer* streamBuffer)
+	{
+		renderer::mesh::Mesh* mesh = GetDataUnsafe<renderer::mesh::Mesh>();
+		if (mesh->IsDirty() || mesh->HasDirtyRanges())
+		{
+			this->m_StreamBuffer = mesh->IsDynamic() ? streamBuffer : nullptr;
+			UpdateGLData();
+			this->m_StreamBuffer = nullptr;
+		}
 		return this->m_VAO;
 	}
 
@@ -60,8 +83,12 @@ namespace gp1::renderer::apis::opengl::mesh
 			return;
 
 		renderer::mesh::Mesh* mesh = GetDataUnsafe<renderer::mesh::Mesh>();
+		// The bounds are kept on the mesh, as meshes that aren't dynamic drop their vertices below.
+		mesh->RecalculateBounds();
 
 		this->m_HasIndices = mesh->m_Indices.size() > 0;
+		this->m_Compressed = mesh->m_CompressVertices;
+		this->m_IndexType  = ChooseIndexType();
 
 		glGenVertexArrays(1, &this->m_VAO);
 		glBindVertexArray(this->m_VAO);
@@ -72,9 +99,10 @@ namespace gp1::renderer::apis::opengl::mesh
 
 		if (this->m_HasIndices)
 		{
+			uint32_t indexCount = static_cast<uint32_t>(mesh->m_Indices.size());
 			BindNextVBO(GL_ELEMENT_ARRAY_BUFFER);
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->m_Indices.size() * sizeof(uint32_t), mesh->m_Indices.data(), GL_STATIC_DRAW);
-			this->m_BufferSize = static_cast<uint32_t>(mesh->m_Indices.size());
+			UploadIndices(0, indexCount);
+			this->m_BufferSize = indexCount;
 		}
 		else
 		{
@@ -91,6 +119,67 @@ namespace gp1::renderer::apis::opengl::mesh
 		mesh->ClearDirty();
 	}
 
+	void OpenGLMeshData::UpdateGLData()
+	{
+		renderer::mesh::Mesh* mesh = GetDataUnsafe<renderer::mesh::Mesh>();
+
+		// The vao only has to be recreated when there is none or when the layout changes, otherwise the buffers are updated in place.
+		bool hasIndices = mesh->m_Indices.size() > 0;
+		if (!this->m_VAO || !HasVertices() || hasIndices != this->m_HasIndices || mesh->m_CompressVertices != this->m_Compressed || ChooseIndexType() != this->m_IndexType)
+		{
+			InitGLData();
+			mesh->ClearDirty();
+			return;
+		}
+
+		uint32_t vertexCount = GetCustomDataSize();
+		if (mesh->IsDirty())
+		{
+			mesh->RecalculateBounds();
+			UpdateCustomGLData(0, vertexCount);
+		}
+		else
+		{
+			for (const renderer::mesh::DirtyRange& range : mesh->GetDirtyVertices().GetRanges())
+			{
+				uint32_t end = range.m_End < vertexCount ? range.m_End : vertexCount;
+				mesh->ExpandBounds(range.m_Begin, end);
+				UpdateCustomGLData(range.m_Begin, end);
+			}
+		}
+
+		if (this->m_HasIndices)
+		{
+			uint32_t indexCount = static_cast<uint32_t>(mesh->m_Indices.size());
+
+			// The element array buffer binding is part of the vao state.
+			glBindVertexArray(this->m_VAO);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->m_VBOs[this->m_NumVBOs - 1]);
+			if (mesh->IsDirty())
+			{
+				UploadIndices(0, indexCount);
+			}
+			else
+			{
+				for (const renderer::mesh::DirtyRange& range : mesh->GetDirtyIndices().GetRanges())
+					UploadIndices(range.m_Begin, range.m_End < indexCount ? range.m_End : indexCount);
+			}
+			glBindVertexArray(0);
+			this->m_BufferSize = indexCount;
+		}
+		else
+		{
+			this->m_BufferSize = vertexCount;
+		}
+
+		if (!mesh->IsEditable() || !mesh->IsDynamic())
+		{
+			ClearCustomData();
+			mesh->m_Indices.clear();
+		}
+		mesh->ClearDirty();
+	}
+
 	void OpenGLMeshData::CleanUp()
 	{
 		if (this->m_VAO)
@@ -113,8 +202,14 @@ namespace gp1::renderer::apis::opengl::mesh
 			this->m_NumAttribs     = 0;
 			this->m_CurrentAttrib  = 0;
 		}
-		this->m_BufferSize = 0;
-		this->m_HasIndices = false;
+		this->m_BufferSize     = 0;
+		this->m_HasIndices     = false;
+		this->m_VertexCapacity = 0;
+		this->m_IndexCapacity  = 0;
+		this->m_IndexType      = GL_UNSIGNED_INT;
+		this->m_PackedVertices = false;
+		this->m_Compressed     = false;
+		this->m_PositionBounds = {};
 	}
 
 	void OpenGLMeshData::CreateVBOs(uint8_t count)
@@ -153,6 +248,114 @@ namespace gp1::renderer::apis::opengl::mesh
 		glBindBuffer(bufferType, 0);
 	}
 
+	void OpenGLMeshData::UploadVertices(const void* data, uint64_t vertexSize, uint32_t count, uint32_t begin, uint32_t end)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_VBOs[0]);
+		UploadBufferData(GL_ARRAY_BUFFER, data, vertexSize, count, this->m_VertexCapacity, begin, end);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLMeshData::UploadBufferData(GLenum target, const void* data, uint64_t elementSize, uint32_t count, uint32_t& capacity, uint32_t begin, uint32_t end)
+	{
+		if (EnsureBufferCapacity(target, elementSize, count, capacity))
+		{
+			begin = 0;
+			end   = count;
+		}
+		if (end > begin)
+			UploadBufferRange(target, reinterpret_cast<const uint8_t*>(data) + begin * elementSize, elementSize, begin, end);
+	}
+
+	bool OpenGLMeshData::EnsureBufferCapacity(GLenum target, uint64_t elementSize, uint32_t count, uint32_t& capacity)
+	{
+		if (count <= capacity)
+			return false;
+
+		// The first allocation is exact as most meshes never change size, after that the buffer doubles.
+		uint32_t newCapacity = capacity == 0 ? count : capacity * 2;
+		if (newCapacity < count)
+			newCapacity = count;
+
+		GLenum usage = GetDataUnsafe<renderer::mesh::Mesh>()->IsDynamic() ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+		glBufferData(target, static_cast<GLsizeiptr>(newCapacity * elementSize), nullptr, usage);
+		capacity = newCapacity;
+		return true;
+	}
+
+	void OpenGLMeshData::UploadBufferRange(GLenum target, const void* rangeData, uint64_t elementSize, uint32_t begin, uint32_t end)
+	{
+		if (end <= begin)
+			return;
+
+		GLintptr   offset = static_cast<GLintptr>(begin * elementSize);
+		GLsizeiptr size   = static_cast<GLsizeiptr>((end - begin) * elementSize);
+		if (this->m_StreamBuffer)
+		{
+			// The copy is ordered on the gpu, so the driver doesn't have to wait for draws still reading the buffer.
+			// Changes that don't fit in the frame's section are uploaded directly instead.
+			buffer::RingBufferAllocation allocation = this->m_StreamBuffer->Allocate(static_cast<uint64_t>(size));
+			if (allocation.m_Data)
+			{
+				std::memcpy(allocation.m_Data, rangeData, static_cast<size_t>(size));
+				this->m_StreamBuffer->Flush(allocation);
+				glBindBuffer(GL_COPY_READ_BUFFER, this->m_StreamBuffer->GetBuffer());
+				glCopyBufferSubData(GL_COPY_READ_BUFFER, target, static_cast<GLintptr>(allocation.m_Offset), offset, size);
+				glBindBuffer(GL_COPY_READ_BUFFER, 0);
+				return;
+			}
+		}
+		if (static_cast<uint64_t>(size) >= OpenGLMeshData::s_MapRangeThreshold)
+		{
+			void* mapped = glMapBufferRange(target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+			if (mapped)
+			{
+				std::memcpy(mapped, rangeData, static_cast<size_t>(size));
+				if (glUnmapBuffer(target))
+					return;
+			}
+		}
+		glBufferSubData(target, offset, size, rangeData);
+	}
+
+	void OpenGLMeshData::UploadIndices(uint32_t begin, uint32_t end)
+	{
+		renderer::mesh::Mesh* mesh       = GetDataUnsafe<renderer::mesh::Mesh>();
+		uint32_t              indexCount = static_cast<uint32_t>(mesh->m_Indices.size());
+
+		if (this->m_IndexType == GL_UNSIGNED_INT)
+		{
+			UploadBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->m_Indices.data(), sizeof(uint32_t), indexCount, this->m_IndexCapacity, begin, end);
+			return;
+		}
+
+		if (EnsureBufferCapacity(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t), indexCount, this->m_IndexCapacity))
+		{
+			begin = 0;
+			end   = indexCount;
+		}
+		if (end <= begin)
+			return;
+
+		std::vector<uint16_t> shortIndices(end - begin);
+		for (uint32_t i = begin; i < end; i++)
+			shortIndices[i - begin] = static_cast<uint16_t>(mesh->m_Indices[i]);
+		UploadBufferRange(GL_ELEMENT_ARRAY_BUFFER, shortIndices.data(), sizeof(uint16_t), begin, end);
+	}
+
+	GLenum OpenGLMeshData::ChooseIndexType()
+	{
+		if (GetDataUnsafe<renderer::mesh::Mesh>()->m_CompressVertices && GetCustomDataSize() <= 65536)
+			return GL_UNSIGNED_SHORT;
+		return GL_UNSIGNED_INT;
+	}
+
+	void OpenGLMeshData::SetPackedVertexAttribPointers(uint64_t stride)
+	{
+		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_UNSIGNED_SHORT, true, stride, offsetof(renderer::mesh::PackedVertex, m_Position));
+		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 2, GL_SHORT, true, stride, offsetof(renderer::mesh::PackedVertex, m_Normal));
+		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::UV), 2, GL_HALF_FLOAT, false, stride, offsetof(renderer::mesh::PackedVertex, m_UV));
+	}
+
 	void OpenGLMeshData::SetVertexAttribPointer(uint32_t index, uint32_t size, GLenum type, bool normalized, uint64_t stride, uint64_t offset)
 	{
 		if (this->m_CurrentAttrib > this->m_NumAttribs)
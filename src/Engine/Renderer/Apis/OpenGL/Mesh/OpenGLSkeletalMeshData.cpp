@@ -24,7 +24,8 @@ namespace gp1::renderer::apis::opengl::mesh
 		renderer::mesh::SkeletalMesh* mesh = GetDataUnsafe<renderer::mesh::SkeletalMesh>();
 		CreateVBOs(this->m_NumVBOs + 1);
 		BindNextVBO(GL_ARRAY_BUFFER);
-		glBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.size() * sizeof(renderer::mesh::SkeletalMeshVertex), mesh->m_Vertices.data(), GL_STATIC_DRAW);
+		uint32_t vertexCount = static_cast<uint32_t>(mesh->m_Vertices.size());
+		UploadBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.data(), sizeof(renderer::mesh::SkeletalMeshVertex), vertexCount, this->m_VertexCapacity, 0, vertexCount);
 		CreateVertexAttribArrays(5);
 		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_FLOAT, false, sizeof(renderer::mesh::SkeletalMeshVertex), offsetof(renderer::mesh::SkeletalMeshVertex, position));
 		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 3, GL_FLOAT, false, sizeof(renderer::mesh::SkeletalMeshVertex), offsetof(renderer::mesh::SkeletalMeshVertex, normal));
@@ -34,6 +35,12 @@ namespace gp1::renderer::apis::opengl::mesh
 		UnbindVBO(GL_ARRAY_BUFFER);
 	}
 
+	void OpenGLSkeletalMeshData::UpdateCustomGLData(uint32_t begin, uint32_t end)
+	{
+		renderer::mesh::SkeletalMesh* mesh = GetDataUnsafe<renderer::mesh::SkeletalMesh>();
+		UploadVertices(mesh->m_Vertices.data(), sizeof(renderer::mesh::SkeletalMeshVertex), static_cast<uint32_t>(mesh->m_Vertices.size()), begin, end);
+	}
+
 	void OpenGLSkeletalMeshData::ClearCustomData()
 	{
 		GetDataUnsafe<renderer::mesh::SkeletalMesh>()->m_Vertices.clear();
@@ -4,6 +4,8 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLStaticMeshData.h"
 
+#include <vector>
+
 namespace gp1::renderer::apis::opengl::mesh
 {
 	OpenGLStaticMeshData::OpenGLStaticMeshData(renderer::mesh::StaticMesh* staticMesh)
@@ -24,17 +26,84 @@ namespace gp1::renderer::apis::opengl::mesh
 		renderer::mesh::StaticMesh* mesh = GetDataUnsafe<renderer::mesh::StaticMesh>();
 		CreateVBOs(this->m_NumVBOs + 1);
 		BindNextVBO(GL_ARRAY_BUFFER);
-		glBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.size() * sizeof(renderer::mesh::StaticMeshVertex), mesh->m_Vertices.data(), GL_STATIC_DRAW);
-		CreateVertexAttribArrays(3);
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, position));
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, normal));
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::UV), 2, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, uv));
+		uint32_t vertexCount = static_cast<uint32_t>(mesh->m_Vertices.size());
+		if (mesh->m_CompressVertices)
+		{
+			this->m_PackedVertices = true;
+			CalculatePositionBounds();
+			EnsureBufferCapacity(GL_ARRAY_BUFFER, sizeof(renderer::mesh::PackedVertex), vertexCount, this->m_VertexCapacity);
+			UploadPackedVertices(0, vertexCount);
+			CreateVertexAttribArrays(3);
+			SetPackedVertexAttribPointers(sizeof(renderer::mesh::PackedVertex));
+		}
+		else
+		{
+			UploadBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.data(), sizeof(renderer::mesh::StaticMeshVertex), vertexCount, this->m_VertexCapacity, 0, vertexCount);
+			CreateVertexAttribArrays(3);
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, position));
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, normal));
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::UV), 2, GL_FLOAT, false, sizeof(renderer::mesh::StaticMeshVertex), offsetof(renderer::mesh::StaticMeshVertex, uv));
+		}
 		UnbindVBO(GL_ARRAY_BUFFER);
 	}
 
+	void OpenGLStaticMeshData::UpdateCustomGLData(uint32_t begin, uint32_t end)
+	{
+		renderer::mesh::StaticMesh* mesh        = GetDataUnsafe<renderer::mesh::StaticMesh>();
+		uint32_t                    vertexCount = static_cast<uint32_t>(mesh->m_Vertices.size());
+		if (!this->m_PackedVertices)
+		{
+			UploadVertices(mesh->m_Vertices.data(), sizeof(renderer::mesh::StaticMeshVertex), vertexCount, begin, end);
+			return;
+		}
+
+		// Positions outside the bounds the buffer was quantized with require every vertex to be quantized again.
+		for (uint32_t i = begin; i < end; i++)
+		{
+			if (!this->m_PositionBounds.Contains(mesh->m_Vertices[i].position))
+			{
+				CalculatePositionBounds();
+				begin = 0;
+				end   = vertexCount;
+				break;
+			}
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_VBOs[0]);
+		if (EnsureBufferCapacity(GL_ARRAY_BUFFER, sizeof(renderer::mesh::PackedVertex), vertexCount, this->m_VertexCapacity))
+		{
+			begin = 0;
+			end   = vertexCount;
+		}
+		UploadPackedVertices(begin, end);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
 	void OpenGLStaticMeshData::ClearCustomData()
 	{
 		GetDataUnsafe<renderer::mesh::StaticMesh>()->m_Vertices.clear();
 	}
 
+	void OpenGLStaticMeshData::CalculatePositionBounds()
+	{
+		this->m_PositionBounds = {};
+		for (auto& vertex : GetDataUnsafe<renderer::mesh::StaticMesh>()->m_Vertices)
+			this->m_PositionBounds.Expand(vertex.position);
+	}
+
+	void OpenGLStaticMeshData::UploadPackedVertices(uint32_t begin, uint32_t end)
+	{
+		if (end <= begin)
+			return;
+
+		renderer::mesh::StaticMesh* mesh = GetDataUnsafe<renderer::mesh::StaticMesh>();
+		std::vector<renderer::mesh::PackedVertex> packed(end - begin);
+		for (uint32_t i = begin; i < end; i++)
+		{
+			const renderer::mesh::StaticMeshVertex& vertex = mesh->m_Vertices[i];
+			renderer::mesh::PackVertex(vertex.position, vertex.normal, vertex.uv, this->m_PositionBounds, packed[i - begin]);
+		}
+		UploadBufferRange(GL_ARRAY_BUFFER, packed.data(), sizeof(renderer::mesh::PackedVertex), begin, end);
+	}
+
 } // namespace gp1::renderer::apis::opengl::mesh
@@ -4,6 +4,8 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLStaticVoxelMeshData.h"
 
+#include <vector>
+
 namespace gp1::renderer::apis::opengl::mesh
 {
 	OpenGLStaticVoxelMeshData::OpenGLStaticVoxelMeshData(renderer::mesh::StaticVoxelMesh* staticVoxelMesh)
@@ -24,18 +26,87 @@ namespace gp1::renderer::apis::opengl::mesh
 		renderer::mesh::StaticVoxelMesh* mesh = GetDataUnsafe<renderer::mesh::StaticVoxelMesh>();
 		CreateVBOs(this->m_NumVBOs + 1);
 		BindNextVBO(GL_ARRAY_BUFFER);
-		glBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.size() * sizeof(renderer::mesh::StaticVoxelMeshVertex), mesh->m_Vertices.data(), GL_STATIC_DRAW);
-		CreateVertexAttribArrays(4);
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, position));
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, normal));
-		SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::UV), 2, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, uv));
-		SetVertexAttribIPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::SSBO_INDEX), 1, GL_UNSIGNED_INT, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, SSBOIndex));
+		uint32_t vertexCount = static_cast<uint32_t>(mesh->m_Vertices.size());
+		if (mesh->m_CompressVertices)
+		{
+			this->m_PackedVertices = true;
+			CalculatePositionBounds();
+			EnsureBufferCapacity(GL_ARRAY_BUFFER, sizeof(renderer::mesh::PackedVoxelVertex), vertexCount, this->m_VertexCapacity);
+			UploadPackedVertices(0, vertexCount);
+			CreateVertexAttribArrays(4);
+			SetPackedVertexAttribPointers(sizeof(renderer::mesh::PackedVoxelVertex));
+			SetVertexAttribIPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::SSBO_INDEX), 1, GL_UNSIGNED_INT, sizeof(renderer::mesh::PackedVoxelVertex), offsetof(renderer::mesh::PackedVoxelVertex, m_SSBOIndex));
+		}
+		else
+		{
+			UploadBufferData(GL_ARRAY_BUFFER, mesh->m_Vertices.data(), sizeof(renderer::mesh::StaticVoxelMeshVertex), vertexCount, this->m_VertexCapacity, 0, vertexCount);
+			CreateVertexAttribArrays(4);
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::POSITION), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, position));
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::NORMAL), 3, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, normal));
+			SetVertexAttribPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::UV), 2, GL_FLOAT, false, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, uv));
+			SetVertexAttribIPointer(static_cast<uint32_t>(renderer::mesh::VertexAttribIndex::SSBO_INDEX), 1, GL_UNSIGNED_INT, sizeof(renderer::mesh::StaticVoxelMeshVertex), offsetof(renderer::mesh::StaticVoxelMeshVertex, SSBOIndex));
+		}
 		UnbindVBO(GL_ARRAY_BUFFER);
 	}
 
+	void OpenGLStaticVoxelMeshData::UpdateCustomGLData(uint32_t begin, uint32_t end)
+	{
+		renderer::mesh::StaticVoxelMesh* mesh        = GetDataUnsafe<renderer::mesh::StaticVoxelMesh>();
+		uint32_t                         vertexCount = static_cast<uint32_t>(mesh->m_Vertices.size());
+		if (!this->m_PackedVertices)
+		{
+			UploadVertices(mesh->m_Vertices.data(), sizeof(renderer::mesh::StaticVoxelMeshVertex), vertexCount, begin, end);
+			return;
+		}
+
+		// Positions outside the bounds the buffer was quantized with require every vertex to be quantized again.
+		for (uint32_t i = begin; i < end; i++)
+		{
+			if (!this->m_PositionBounds.Contains(mesh->m_Vertices[i].position))
+			{
+				CalculatePositionBounds();
+				begin = 0;
+				end   = vertexCount;
+				break;
+			}
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, this->m_VBOs[0]);
+		if (EnsureBufferCapacity(GL_ARRAY_BUFFER, sizeof(renderer::mesh::PackedVoxelVertex), vertexCount, this->m_VertexCapacity))
+		{
+			begin = 0;
+			end   = vertexCount;
+		}
+		UploadPackedVertices(begin, end);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
 	void OpenGLStaticVoxelMeshData::ClearCustomData()
 	{
 		GetDataUnsafe<renderer::mesh::StaticVoxelMesh>()->m_Vertices.clear();
 	}
 
+	void OpenGLStaticVoxelMeshData::CalculatePositionBounds()
+	{
+		this->m_PositionBounds = {};
+		for (auto& vertex : GetDataUnsafe<renderer::mesh::StaticVoxelMesh>()->m_Vertices)
+			this->m_PositionBounds.Expand(vertex.position);
+	}
+
+	void OpenGLStaticVoxelMeshData::UploadPackedVertices(uint32_t begin, uint32_t end)
+	{
+		if (end <= begin)
+			return;
+
+		renderer::mesh::StaticVoxelMesh* mesh = GetDataUnsafe<renderer::mesh::StaticVoxelMesh>();
+		std::vector<renderer::mesh::PackedVoxelVertex> packed(end - begin);
+		for (uint32_t i = begin; i < end; i++)
+		{
+			const renderer::mesh::StaticVoxelMeshVertex& vertex = mesh->m_Vertices[i];
+			renderer::mesh::PackVertex(vertex.position, vertex.normal, vertex.uv, this->m_PositionBounds, packed[i - begin].m_Vertex);
+			packed[i - begin].m_SSBOIndex = vertex.SSBOIndex;
+		}
+		UploadBufferRange(GL_ARRAY_BUFFER, packed.data(), sizeof(renderer::mesh::PackedVoxelVertex), begin, end);
+	}
+
 } // namespace gp1::renderer::apis::opengl::mesh
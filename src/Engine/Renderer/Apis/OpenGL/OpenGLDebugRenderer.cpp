@@ -3,7 +3,7 @@
 //
 
 #include "Engine/Renderer/Apis/OpenGL/OpenGLDebugRenderer.h"
-#include "Engine/Renderer/Mesh/Generators/Icosphere.h"
+#include "Engine/Renderer/Mesh/Generators/MeshCache.h"
 #include "Engine/Renderer/Shader/Material.h"
 #include "Engine/Renderer/Shader/Shader.h"
 #include "Engine/Renderer/Shader/Uniform.h"
@@ -113,8 +113,7 @@ namespace gp1::renderer::apis::opengl::debug
 		OpenGLDebugPoint::s_PointMesh->m_Indices.push_back(0);
 		OpenGLDebugPoint::s_PointMesh->m_LineWidth = 3.0f;
 
-		OpenGLDebugSphere::s_SphereMesh = new renderer::mesh::StaticMesh();
-		renderer::meshGenerators::GenerateIcosphere(*OpenGLDebugSphere::s_SphereMesh, 3);
+		OpenGLDebugSphere::s_SphereMesh = renderer::meshGenerators::GetIcosphere(3);
 
 		OpenGLDebugBox::s_BoxMesh               = new renderer::mesh::StaticMesh();
 		OpenGLDebugBox::s_BoxMesh->m_RenderMode = renderer::mesh::RenderMode::LINES;
@@ -175,11 +174,8 @@ namespace gp1::renderer::apis::opengl::debug
 			OpenGLDebugPoint::s_PointMesh = nullptr;
 		}
 
-		if (OpenGLDebugSphere::s_SphereMesh)
-		{
-			delete OpenGLDebugSphere::s_SphereMesh;
-			OpenGLDebugSphere::s_SphereMesh = nullptr;
-		}
+		// The sphere mesh is owned by the mesh cache.
+		OpenGLDebugSphere::s_SphereMesh = nullptr;
 
 		if (OpenGLDebugBox::s_BoxMesh)
 		{
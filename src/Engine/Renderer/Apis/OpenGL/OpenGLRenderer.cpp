@@ -3,6 +3,9 @@
 //
 
 #include "Engine/Renderer/Apis/OpenGL/OpenGLRenderer.h"
+#include "Engine/Animation/Pose.h"
+#include "Engine/Renderer/Apis/OpenGL/Buffer/OpenGLRingBuffer.h"
+#include "Engine/Renderer/Apis/OpenGL/Culling/OpenGLStaticInstanceGroupData.h"
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLMeshData.h"
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLSkeletalMeshData.h"
 #include "Engine/Renderer/Apis/OpenGL/Mesh/OpenGLStaticMeshData.h"
@@ -14,10 +17,17 @@
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTexture2DData.h"
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTexture3DData.h"
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCubeMapData.h"
+#include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureUploader.h"
+#include "Engine/Renderer/Apis/OpenGL/Voxel/OpenGLVoxelMaterialTableData.h"
+#include "Engine/Renderer/Culling/StaticInstanceGroup.h"
+#include "Engine/Renderer/Texture/TextureStreamer.h"
+#include "Engine/Renderer/Voxel/VoxelMaterialTable.h"
 #include "Engine/Scene/Camera.h"
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Scene.h"
 
+#include <algorithm>
+#include <cmath>
 #include <stdint.h>
 
 #define GLFW_INCLUDE_NONE
@@ -82,6 +92,14 @@ namespace gp1::renderer::apis::opengl
 		{
 			return new texture::OpenGLTextureCubeMapData(reinterpret_cast<renderer::texture::TextureCubeMap*>(data));
 		}
+		else if (type == typeid(renderer::culling::StaticInstanceGroup))
+		{
+			return new culling::OpenGLStaticInstanceGroupData(reinterpret_cast<renderer::culling::StaticInstanceGroup*>(data));
+		}
+		else if (type == typeid(renderer::voxel::VoxelMaterialTable))
+		{
+			return new voxel::OpenGLVoxelMaterialTableData(reinterpret_cast<renderer::voxel::VoxelMaterialTable*>(data));
+		}
 
 		return nullptr;
 	}
@@ -91,6 +109,46 @@ namespace gp1::renderer::apis::opengl
 		return this->m_MaxTextureUnits;
 	}
 
+	buffer::OpenGLRingBuffer* OpenGLRenderer::GetStreamBuffer() const
+	{
+		return this->m_StreamBuffer;
+	}
+
+	texture::OpenGLTextureUploader* OpenGLRenderer::GetTextureUploader() const
+	{
+		return this->m_TextureUploader;
+	}
+
+	const renderer::mesh::MeshletCullingStats& OpenGLRenderer::GetMeshletCullingStats() const
+	{
+		return this->m_LastMeshletCullingStats;
+	}
+
+	float OpenGLRenderer::GetTextureScreenSize() const
+	{
+		return this->m_TextureScreenSize;
+	}
+
+	bool OpenGLRenderer::SupportsCompute() const
+	{
+		return this->m_SupportsCompute;
+	}
+
+	void OpenGLRenderer::DispatchCompute(renderer::shader::Material* material, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ)
+	{
+		if (!this->m_SupportsCompute || !material || !material->GetShader()) return;
+
+		shader::OpenGLMaterialData* materialData = material->GetRendererData<shader::OpenGLMaterialData>(this);
+		shader::OpenGLShaderData*   shaderData   = material->GetShader()->GetRendererData<shader::OpenGLShaderData>(this);
+		if (!materialData || !shaderData || !shaderData->GetProgramID()) return;
+
+		shaderData->Start();
+		materialData->SetAllUniforms(this);
+		glDispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+		shaderData->Stop();
+	}
+
 	void OpenGLRenderer::InitRenderer()
 	{
 		int32_t maxTextureUnits;
@@ -98,10 +156,71 @@ namespace gp1::renderer::apis::opengl
 		this->m_MaxTextureUnits = static_cast<uint32_t>(maxTextureUnits);
 
 		glDebugMessageCallback(&OpenGLRenderer::ErrorMessageCallback, this);
+
+		// Filter across cube map faces, the rough levels of prefiltered environment maps show seams otherwise.
+		glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+		this->m_SupportsCompute = GLAD_GL_VERSION_4_3;
+		if (this->m_SupportsCompute)
+		{
+			int32_t storageBufferAlignment;
+			glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageBufferAlignment);
+			this->m_StorageBufferAlignment = static_cast<uint32_t>(storageBufferAlignment);
+
+			this->m_CullingMaterial = new renderer::shader::Material();
+			this->m_CullingMaterial->SetShader(renderer::shader::Shader::GetShader("gpuCulling"));
+			this->m_HiZMaterial = new renderer::shader::Material();
+			this->m_HiZMaterial->SetShader(renderer::shader::Shader::GetShader("hiZBuild"));
+		}
+		else
+		{
+			OpenGLRenderer::s_Logger.LogWarning("OpenGL 4.3 isn't supported, static instance groups and skinned meshes won't be drawn as they read shader storage buffers");
+		}
+
+		this->m_StreamBuffer = new buffer::OpenGLRingBuffer(GL_COPY_WRITE_BUFFER, 4 << 20);
+		this->m_StreamBuffer->Init();
+		if (!this->m_StreamBuffer->GetStats().m_Persistent)
+			OpenGLRenderer::s_Logger.LogWarning("Buffer storage isn't supported, per frame data is streamed by orphaning");
+
+		this->m_TextureUploader = new texture::OpenGLTextureUploader();
+		if (!GLAD_GL_VERSION_4_2)
+			OpenGLRenderer::s_Logger.LogWarning("Texture storage isn't supported, textures are allocated as mutable textures");
 	}
 
 	void OpenGLRenderer::DeInitRenderer()
 	{
+		CleanUpHiZ();
+
+		if (this->m_StreamBuffer)
+		{
+			const buffer::RingBufferStats& stats = this->m_StreamBuffer->GetStats();
+			if (stats.m_Stalls > 0)
+				OpenGLRenderer::s_Logger.LogDebug("Stream buffer stalled %llu times in %llu frames for a total of %.3f ms", static_cast<unsigned long long>(stats.m_Stalls), static_cast<unsigned long long>(stats.m_Frames), stats.m_StallTime);
+			this->m_StreamBuffer->CleanUp();
+			delete this->m_StreamBuffer;
+			this->m_StreamBuffer = nullptr;
+		}
+
+		if (this->m_TextureUploader)
+		{
+			const texture::TextureUploaderStats& stats = this->m_TextureUploader->GetStats();
+			if (stats.m_Stalls > 0)
+				OpenGLRenderer::s_Logger.LogDebug("Texture uploader stalled %llu times in %llu chunks for a total of %.3f ms", static_cast<unsigned long long>(stats.m_Stalls), static_cast<unsigned long long>(stats.m_Chunks), stats.m_StallTime);
+			this->m_TextureUploader->CleanUp();
+			delete this->m_TextureUploader;
+			this->m_TextureUploader = nullptr;
+		}
+
+		if (this->m_CullingMaterial)
+		{
+			delete this->m_CullingMaterial;
+			this->m_CullingMaterial = nullptr;
+		}
+		if (this->m_HiZMaterial)
+		{
+			delete this->m_HiZMaterial;
+			this->m_HiZMaterial = nullptr;
+		}
 	}
 
 	void OpenGLRenderer::RenderScene(scene::Scene* scene, uint32_t width, uint32_t height)
@@ -109,10 +228,31 @@ namespace gp1::renderer::apis::opengl
 		scene::Camera* mainCamera = scene->GetMainCamera();
 		if (mainCamera)
 		{
+			this->m_StreamBuffer->BeginFrame();
+			this->m_MeshletCullingStats.Reset();
+			this->m_ViewportHeight    = height;
+			this->m_TextureScreenSize = 0.0f;
+
 			glViewport(0, 0, width, height);
 			glClearColor(mainCamera->m_ClearColor.r, mainCamera->m_ClearColor.g, mainCamera->m_ClearColor.b, mainCamera->m_ClearColor.a);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+			// The voxel material table is shared by every chunk, so it is bound once for the whole frame.
+			renderer::voxel::VoxelMaterialTable* voxelMaterialTable = scene->GetVoxelMaterialTable();
+			if (voxelMaterialTable && this->m_SupportsCompute)
+			{
+				voxel::OpenGLVoxelMaterialTableData* tableData = voxelMaterialTable->GetRendererData<voxel::OpenGLVoxelMaterialTableData>(this);
+				tableData->UpdateGLData();
+				tableData->BindBuffer();
+			}
+
+			PrepareJointPalettes(scene);
+
+			for (auto group : scene->GetStaticInstanceGroups())
+			{
+				RenderStaticInstanceGroup(group, mainCamera);
+			}
+
 			for (auto entity : scene->GetEntities())
 			{
 				RenderEntity(entity);
@@ -149,6 +289,14 @@ namespace gp1::renderer::apis::opengl
 				}
 			}
 
+			if (this->m_UseHiZOcclusion)
+				BuildHiZ(width, height, mainCamera->GetProjectionViewMatrix());
+			else if (this->m_HiZTexture)
+				CleanUpHiZ();
+
+			this->m_LastMeshletCullingStats = this->m_MeshletCullingStats;
+			this->m_StreamBuffer->EndFrame();
+			this->m_TextureUploader->EndFrame();
 			glfwSwapBuffers(GetNativeWindowHandle());
 		}
 	}
@@ -173,8 +321,30 @@ namespace gp1::renderer::apis::opengl
 				if (projectionViewMatrix) projectionViewMatrix->m_Value = cam->GetProjectionViewMatrix();
 				renderer::shader::Uniform<glm::fvec3>* lightDirection = material->GetUniform<glm::fvec3>("lightDirection");
 				if (lightDirection) lightDirection->m_Value = { 0, 0, 1 };
+				// Skinned materials read the entity's joint palette, which only exists if the entity has a pose and every palette fit in the stream buffer.
+				// Without one the draw would read another entity's joints, so it is skipped.
+				renderer::shader::Uniform<uint32_t>* jointOffset = material->GetUniform<uint32_t>("jointOffset");
+				if (jointOffset)
+				{
+					auto jointPaletteOffset = this->m_JointPaletteOffsets.find(entity);
+					if (jointPaletteOffset == this->m_JointPaletteOffsets.end()) return;
+					jointOffset->m_Value = jointPaletteOffset->second;
+				}
+				SetMeshUniforms(mesh, material);
+
+				// SetMeshUniforms uploaded the mesh, so its bounds are up to date.
+				this->m_TextureScreenSize = EstimateScreenSize(mesh->m_BoundingSphere, entity->GetTransformationMatrix(), cam);
 
-				RenderMeshWithMaterial(mesh, material);
+				if (this->m_CullMeshlets && !mesh->m_Meshlets.empty())
+				{
+					PreMaterial(material);
+					RenderMeshlets(mesh, entity->GetTransformationMatrix(), cam);
+					PostMaterial(material);
+				}
+				else
+				{
+					RenderMeshWithMaterial(mesh, material);
+				}
 			}
 		}
 		else if (mesh)
@@ -183,6 +353,20 @@ namespace gp1::renderer::apis::opengl
 		}
 	}
 
+	void OpenGLRenderer::SetMeshUniforms(renderer::mesh::Mesh* mesh, renderer::shader::Material* material)
+	{
+		mesh::OpenGLMeshData* meshData = mesh->GetRendererData<mesh::OpenGLMeshData>(this);
+		if (!meshData) return;
+
+		// Update the mesh first, as uploading decides whether the vertices are packed.
+		meshData->GetVAO(this->m_StreamBuffer);
+
+		renderer::shader::Uniform<glm::fmat4>* dequantizationMatrix = material->GetUniform<glm::fmat4>("dequantizationMatrix");
+		if (dequantizationMatrix) dequantizationMatrix->m_Value = meshData->GetDequantizationMatrix();
+		renderer::shader::Uniform<int32_t>* packedNormals = material->GetUniform<int32_t>("packedNormals");
+		if (packedNormals) packedNormals->m_Value = meshData->HasPackedVertices() ? 1 : 0;
+	}
+
 	void OpenGLRenderer::RenderMeshWithMaterial(renderer::mesh::Mesh* mesh, renderer::shader::Material* material)
 	{
 		PreMaterial(material);
@@ -200,10 +384,10 @@ namespace gp1::renderer::apis::opengl
 		else
 			glLineWidth(mesh->m_LineWidth);
 
-		glBindVertexArray(meshData->GetVAO());
+		glBindVertexArray(meshData->GetVAO(this->m_StreamBuffer));
 
 		if (meshData->HasIndices())
-			glDrawElements(meshData->GetRenderMode(), meshData->m_BufferSize, GL_UNSIGNED_INT, 0);
+			glDrawElements(meshData->GetRenderMode(), meshData->m_BufferSize, meshData->GetIndexType(), 0);
 		else
 			glDrawArrays(meshData->GetRenderMode(), 0, meshData->m_BufferSize);
 
@@ -213,6 +397,239 @@ namespace gp1::renderer::apis::opengl
 		glLineWidth(1);
 	}
 
+	void OpenGLRenderer::RenderMeshlets(renderer::mesh::Mesh* mesh, const glm::fmat4& transformationMatrix, scene::Camera* camera)
+	{
+		mesh::OpenGLMeshData* meshData = mesh->GetRendererData<mesh::OpenGLMeshData>(this);
+		if (!meshData) return;
+
+		uint32_t vao = meshData->GetVAO(this->m_StreamBuffer);
+		if (!meshData->HasIndices())
+		{
+			RenderMesh(mesh);
+			return;
+		}
+
+		renderer::mesh::CullMeshlets(mesh->m_Meshlets, transformationMatrix, camera->GetProjectionViewMatrix(), camera->m_Position, this->m_MeshletRanges, this->m_MeshletCullingStats);
+		if (this->m_MeshletRanges.empty()) return;
+
+		// The visible meshlets are merged into contiguous ranges, so each range is one draw.
+		size_t indexSize = meshData->GetIndexType() == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+		this->m_MultiDrawCounts.resize(this->m_MeshletRanges.size());
+		this->m_MultiDrawOffsets.resize(this->m_MeshletRanges.size());
+		for (size_t i = 0; i < this->m_MeshletRanges.size(); i++)
+		{
+			this->m_MultiDrawCounts[i]  = static_cast<int32_t>(this->m_MeshletRanges[i].m_IndexCount);
+			this->m_MultiDrawOffsets[i] = reinterpret_cast<const void*>(this->m_MeshletRanges[i].m_FirstIndex * indexSize);
+		}
+
+		glBindVertexArray(vao);
+		glMultiDrawElements(meshData->GetRenderMode(), this->m_MultiDrawCounts.data(), meshData->GetIndexType(), this->m_MultiDrawOffsets.data(), static_cast<int32_t>(this->m_MultiDrawCounts.size()));
+		glBindVertexArray(0);
+	}
+
+	void OpenGLRenderer::RenderStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group, scene::Camera* camera)
+	{
+		// The instanced shaders read the transforms from shader storage buffers, which need OpenGL 4.3.
+		if (!this->m_SupportsCompute || !group->m_Mesh || !group->m_Material) return;
+
+		culling::OpenGLStaticInstanceGroupData* groupData = group->GetRendererData<culling::OpenGLStaticInstanceGroupData>(this);
+		if (!groupData) return;
+
+		// Upload the mesh before the instances, as the group's bounds are built from the mesh's bounds.
+		mesh::OpenGLMeshData* meshData = group->m_Mesh->GetRendererData<mesh::OpenGLMeshData>(this);
+		if (!meshData) return;
+		uint32_t vao = meshData->GetVAO(this->m_StreamBuffer);
+		if (!vao) return;
+
+		groupData->UpdateGLData(this->m_StreamBuffer, this->m_StorageBufferAlignment);
+		if (groupData->GetInstanceCount() == 0) return;
+
+		bool cullOnGPU = this->m_SupportsCompute && this->m_CullingMaterial;
+		groupData->ResetDrawCommand(meshData->m_BufferSize, cullOnGPU);
+		groupData->BindBuffers();
+
+		if (cullOnGPU)
+		{
+			renderer::shader::Uniform<glm::fmat4>* projectionViewMatrix = this->m_CullingMaterial->GetUniform<glm::fmat4>("projectionViewMatrix");
+			if (projectionViewMatrix) projectionViewMatrix->m_Value = camera->GetProjectionViewMatrix();
+			renderer::shader::Uniform<glm::fmat4>* previousProjectionViewMatrix = this->m_CullingMaterial->GetUniform<glm::fmat4>("previousProjectionViewMatrix");
+			if (previousProjectionViewMatrix) previousProjectionViewMatrix->m_Value = this->m_PreviousProjectionViewMatrix;
+			renderer::shader::Uniform<glm::fvec4>* boundingSphere = this->m_CullingMaterial->GetUniform<glm::fvec4>("boundingSphere");
+			if (boundingSphere) boundingSphere->m_Value = group->m_BoundingSphere;
+			renderer::shader::Uniform<uint32_t>* numInstances = this->m_CullingMaterial->GetUniform<uint32_t>("numInstances");
+			if (numInstances) numInstances->m_Value = groupData->GetInstanceCount();
+
+			bool                                   useHiZ        = this->m_UseHiZOcclusion && this->m_HiZValid;
+			renderer::shader::Uniform<int32_t>*    useHiZUniform = this->m_CullingMaterial->GetUniform<int32_t>("useHiZ");
+			renderer::shader::Uniform<glm::fvec2>* hiZSize       = this->m_CullingMaterial->GetUniform<glm::fvec2>("hiZSize");
+			if (useHiZUniform) useHiZUniform->m_Value = useHiZ ? 1 : 0;
+			if (hiZSize) hiZSize->m_Value = { static_cast<float>(this->m_HiZWidth), static_cast<float>(this->m_HiZHeight) };
+
+			// The culling shader samples the hierarchical depth buffer from texture unit 0.
+			renderer::shader::Uniform<int32_t>* hiZ = this->m_CullingMaterial->GetUniform<int32_t>("hiZ");
+			if (hiZ) hiZ->m_Value = 0;
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, useHiZ ? this->m_HiZTexture : 0);
+			DispatchCompute(this->m_CullingMaterial, (groupData->GetInstanceCount() + 63) / 64);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
+
+		renderer::shader::Uniform<glm::fmat4>* projectionViewMatrix = group->m_Material->GetUniform<glm::fmat4>("projectionViewMatrix");
+		if (projectionViewMatrix) projectionViewMatrix->m_Value = camera->GetProjectionViewMatrix();
+		renderer::shader::Uniform<glm::fvec3>* lightDirection = group->m_Material->GetUniform<glm::fvec3>("lightDirection");
+		if (lightDirection) lightDirection->m_Value = { 0, 0, 1 };
+		SetMeshUniforms(group->m_Mesh, group->m_Material);
+
+		// The instances are culled on the gpu, so the textures are requested at the size of the largest instance as close as the group's bounds allow.
+		float distance            = glm::length(glm::fvec3(group->m_WorldBoundingSphere) - camera->m_Position) - group->m_WorldBoundingSphere.w + group->m_MaxInstanceRadius;
+		this->m_TextureScreenSize = renderer::texture::EstimateScreenSize(group->m_MaxInstanceRadius, distance, camera->GetProjectionMatrix()[1][1], this->m_ViewportHeight);
+
+		PreMaterial(group->m_Material);
+		glBindVertexArray(vao);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, groupData->GetDrawCommandBuffer());
+		if (meshData->HasIndices())
+			glDrawElementsIndirect(meshData->GetRenderMode(), meshData->GetIndexType(), nullptr);
+		else
+			glDrawArraysIndirect(meshData->GetRenderMode(), nullptr);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		glBindVertexArray(0);
+		PostMaterial(group->m_Material);
+	}
+
+	void OpenGLRenderer::PrepareJointPalettes(scene::Scene* scene)
+	{
+		this->m_JointPaletteOffsets.clear();
+		if (!this->m_SupportsCompute) return;
+
+		uint32_t jointCount = 0;
+		for (auto entity : scene->GetEntities())
+		{
+			const animation::Pose* pose = entity->GetPose();
+			if (pose && pose->GetSkeleton())
+				jointCount += pose->GetJointCount();
+		}
+		if (jointCount == 0) return;
+
+		// Every palette goes into one allocation, so the shaders index a single binding and instanced draws can reach the palettes of many entities.
+		buffer::RingBufferAllocation allocation = this->m_StreamBuffer->Allocate(jointCount * sizeof(glm::fmat4), this->m_StorageBufferAlignment);
+		if (!allocation.m_Data)
+		{
+			s_Logger.LogWarning("%u joint matrices don't fit in the stream buffer, skinned meshes aren't drawn this frame", jointCount);
+			return;
+		}
+
+		glm::fmat4* matrices = reinterpret_cast<glm::fmat4*>(allocation.m_Data);
+		uint32_t    offset   = 0;
+		for (auto entity : scene->GetEntities())
+		{
+			const animation::Pose* pose = entity->GetPose();
+			if (!pose || !pose->GetSkeleton())
+				continue;
+
+			pose->CalculateSkinningMatrices(matrices + offset);
+			this->m_JointPaletteOffsets[entity] = offset;
+			offset += pose->GetJointCount();
+		}
+		this->m_StreamBuffer->Flush(allocation);
+
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, mesh::SkinningBufferBinding::JOINT_PALETTES, this->m_StreamBuffer->GetBuffer(), static_cast<GLintptr>(allocation.m_Offset), static_cast<GLsizeiptr>(allocation.m_Size));
+	}
+
+	float OpenGLRenderer::EstimateScreenSize(const glm::fvec4& boundingSphere, const glm::fmat4& transformationMatrix, scene::Camera* camera) const
+	{
+		float scaleX = glm::dot(glm::fvec3(transformationMatrix[0]), glm::fvec3(transformationMatrix[0]));
+		float scaleY = glm::dot(glm::fvec3(transformationMatrix[1]), glm::fvec3(transformationMatrix[1]));
+		float scaleZ = glm::dot(glm::fvec3(transformationMatrix[2]), glm::fvec3(transformationMatrix[2]));
+		float scale  = std::sqrt(glm::max(glm::max(scaleX, scaleY), scaleZ));
+
+		glm::fvec3 center = glm::fvec3(transformationMatrix * glm::fvec4(glm::fvec3(boundingSphere), 1.0f));
+		return renderer::texture::EstimateScreenSize(boundingSphere.w * scale, glm::length(center - camera->m_Position), camera->GetProjectionMatrix()[1][1], this->m_ViewportHeight);
+	}
+
+	void OpenGLRenderer::BuildHiZ(uint32_t width, uint32_t height, const glm::fmat4& projectionViewMatrix)
+	{
+		if (!this->m_SupportsCompute || !this->m_HiZMaterial || width == 0 || height == 0) return;
+
+		if (width != this->m_HiZWidth || height != this->m_HiZHeight || !this->m_HiZTexture)
+		{
+			CleanUpHiZ();
+
+			this->m_HiZWidth  = width;
+			this->m_HiZHeight = height;
+			this->m_HiZLevels = static_cast<uint32_t>(std::floor(std::log2(static_cast<float>(width > height ? width : height)))) + 1;
+
+			glGenTextures(1, &this->m_DepthTexture);
+			glBindTexture(GL_TEXTURE_2D, this->m_DepthTexture);
+			glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT24, width, height);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+			glGenTextures(1, &this->m_HiZTexture);
+			glBindTexture(GL_TEXTURE_2D, this->m_HiZTexture);
+			glTexStorage2D(GL_TEXTURE_2D, this->m_HiZLevels, GL_R32F, width, height);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		// Copy this frame's depth buffer so the first level can be built from it.
+		glBindTexture(GL_TEXTURE_2D, this->m_DepthTexture);
+		glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, width, height);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		renderer::shader::Uniform<uint32_t>*   level      = this->m_HiZMaterial->GetUniform<uint32_t>("level");
+		renderer::shader::Uniform<glm::uvec2>* sourceSize = this->m_HiZMaterial->GetUniform<glm::uvec2>("sourceSize");
+		// The first level is built from the depth texture bound to texture unit 0.
+		renderer::shader::Uniform<int32_t>* depth = this->m_HiZMaterial->GetUniform<int32_t>("depth");
+		if (depth) depth->m_Value = 0;
+
+		uint32_t levelWidth  = width;
+		uint32_t levelHeight = height;
+		for (uint32_t i = 0; i < this->m_HiZLevels; i++)
+		{
+			if (level) level->m_Value = i;
+			if (sourceSize) sourceSize->m_Value = { levelWidth, levelHeight };
+
+			if (i == 0)
+			{
+				glActiveTexture(GL_TEXTURE0);
+				glBindTexture(GL_TEXTURE_2D, this->m_DepthTexture);
+			}
+			else
+			{
+				glBindImageTexture(0, this->m_HiZTexture, i - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+				levelWidth  = levelWidth > 1 ? levelWidth / 2 : 1;
+				levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+			}
+			glBindImageTexture(1, this->m_HiZTexture, i, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+
+			DispatchCompute(this->m_HiZMaterial, (levelWidth + 7) / 8, (levelHeight + 7) / 8);
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		this->m_PreviousProjectionViewMatrix = projectionViewMatrix;
+		this->m_HiZValid                     = true;
+	}
+
+	void OpenGLRenderer::CleanUpHiZ()
+	{
+		if (this->m_DepthTexture)
+		{
+			glDeleteTextures(1, &this->m_DepthTexture);
+			this->m_DepthTexture = 0;
+		}
+		if (this->m_HiZTexture)
+		{
+			glDeleteTextures(1, &this->m_HiZTexture);
+			this->m_HiZTexture = 0;
+		}
+		this->m_HiZWidth  = 0;
+		this->m_HiZHeight = 0;
+		this->m_HiZLevels = 0;
+		this->m_HiZValid  = false;
+	}
+
 	void OpenGLRenderer::PreMaterial(renderer::shader::Material* material)
 	{
 		shader::OpenGLMaterialData* materialData = material->GetRendererData<shader::OpenGLMaterialData>(this);
@@ -10,6 +10,7 @@
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCubeMapData.h"
 #include "Engine/Renderer/Shader/Shader.h"
 #include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Renderer/Texture/TextureStreamer.h"
 
 #include <glm.hpp>
 
@@ -143,7 +144,8 @@ namespace gp1::renderer::apis::opengl::shader
 						glUniform1i(location, texIndex);
 						glActiveTexture(GL_TEXTURE0 + texIndex);
 						texture::OpenGLTexture2DData* texture2DData = reinterpret_cast<texture::OpenGLTexture2DData*>(uniformTexture2D->m_Value->GetRendererData<texture::OpenGLTexture2DData>(renderer));
-						glBindTexture(GL_TEXTURE_2D, texture2DData->GetTextureID());
+						glBindTexture(GL_TEXTURE_2D, texture2DData->GetTextureID(renderer->GetTextureUploader()));
+						renderer::texture::TextureStreamer::GetInstance()->Request(uniformTexture2D->m_Value, renderer->GetTextureScreenSize());
 						texIndex++;
 					}
 					else
@@ -165,7 +167,7 @@ namespace gp1::renderer::apis::opengl::shader
 						glUniform1i(location, texIndex);
 						glActiveTexture(GL_TEXTURE0 + texIndex);
 						texture::OpenGLTexture2DArrayData* texture2DArrayData = reinterpret_cast<texture::OpenGLTexture2DArrayData*>(uniformTexture2DArray->m_Value->GetRendererData<texture::OpenGLTexture2DArrayData>(renderer));
-						glBindTexture(GL_TEXTURE_2D_ARRAY, texture2DArrayData->GetTextureID());
+						glBindTexture(GL_TEXTURE_2D_ARRAY, texture2DArrayData->GetTextureID(renderer->GetTextureUploader()));
 						texIndex++;
 					}
 					else
@@ -187,7 +189,7 @@ namespace gp1::renderer::apis::opengl::shader
 						glUniform1i(location, texIndex);
 						glActiveTexture(GL_TEXTURE0 + texIndex);
 						texture::OpenGLTexture3DData* texture3DData = reinterpret_cast<texture::OpenGLTexture3DData*>(uniformTexture3D->m_Value->GetRendererData<texture::OpenGLTexture3DData>(renderer));
-						glBindTexture(GL_TEXTURE_3D, texture3DData->GetTextureID());
+						glBindTexture(GL_TEXTURE_3D, texture3DData->GetTextureID(renderer->GetTextureUploader()));
 						texIndex++;
 					}
 					else
@@ -209,7 +211,7 @@ namespace gp1::renderer::apis::opengl::shader
 						glUniform1i(location, texIndex);
 						glActiveTexture(GL_TEXTURE0 + texIndex);
 						texture::OpenGLTextureCubeMapData* textureCubeMapData = reinterpret_cast<texture::OpenGLTextureCubeMapData*>(uniformTextureCubeMap->m_Value->GetRendererData<texture::OpenGLTextureCubeMapData>(renderer));
-						glBindTexture(GL_TEXTURE_CUBE_MAP, textureCubeMapData->GetTextureID());
+						glBindTexture(GL_TEXTURE_CUBE_MAP, textureCubeMapData->GetTextureID(renderer->GetTextureUploader()));
 						texIndex++;
 					}
 					else
@@ -103,7 +103,7 @@ namespace gp1::renderer::apis::opengl::shader
 			char    name[128];
 
 			glGetActiveUniform(this->m_ProgramID, static_cast<GLuint>(i), 128, &length, &size, &type, name);
-			shader->SetUniformTypeAndLocation(name, GetUniformType(type), i);
+			shader->SetUniformTypeAndLocation(name, GetUniformType(type), static_cast<uint32_t>(glGetUniformLocation(this->m_ProgramID, name)));
 		}
 		shader->ClearDirty();
 	}
@@ -4,8 +4,10 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTexture2DArrayData.h"
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCommon.h"
+#include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureUploader.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
 
-#include <cstring>
+#include <algorithm>
 
 namespace gp1::renderer::apis::opengl::texture
 {
@@ -14,16 +16,20 @@ namespace gp1::renderer::apis::opengl::texture
 
 	void OpenGLTexture2DArrayData::CleanUp()
 	{
-		if (this->m_TextureID) glDeleteTextures(1, &this->m_TextureID);
+		if (this->m_TextureID)
+		{
+			glDeleteTextures(1, &this->m_TextureID);
+			this->m_TextureID = 0;
+		}
 	}
 
-	uint32_t OpenGLTexture2DArrayData::GetTextureID()
+	uint32_t OpenGLTexture2DArrayData::GetTextureID(OpenGLTextureUploader* uploader)
 	{
-		if (GetDataUnsafe<renderer::texture::Texture2D>()->IsDirty()) InitGLData();
+		if (GetDataUnsafe<renderer::texture::Texture2DArray>()->IsDirty()) InitGLData(uploader);
 		return this->m_TextureID;
 	}
 
-	void OpenGLTexture2DArrayData::InitGLData()
+	void OpenGLTexture2DArrayData::InitGLData(OpenGLTextureUploader* uploader)
 	{
 		if (this->m_TextureID) CleanUp();
 
@@ -46,148 +52,43 @@ namespace gp1::renderer::apis::opengl::texture
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, texture->m_BaseLevel);
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, texture->m_MaxLevel);
 
-		uint8_t dataSize;
-		uint8_t components;
-		switch (texture->m_Type)
-		{
-		case renderer::texture::TextureDataType::BYTE:
-		case renderer::texture::TextureDataType::UNSIGNED_BYTE:
-		case renderer::texture::TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
-		case renderer::texture::TextureDataType::UNSIGNED_BYTE_3_3_2:
-			dataSize = 1;
-			break;
-		case renderer::texture::TextureDataType::SHORT:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_5_5_1:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5:
-		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
-			dataSize = 2;
-			break;
-		case renderer::texture::TextureDataType::INT:
-		case renderer::texture::TextureDataType::UNSIGNED_INT:
-		case renderer::texture::TextureDataType::UNSIGNED_INT_10_10_10_2:
-		case renderer::texture::TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
-		case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8:
-		case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
-			dataSize = 4;
-			break;
-		case renderer::texture::TextureDataType::HALF_FLOAT:
-			dataSize = 2;
-			break;
-		case renderer::texture::TextureDataType::FLOAT:
-			dataSize = 4;
-			break;
-		default:
-			dataSize = 1;
-		}
-		switch (texture->m_Format)
-		{
-		case renderer::texture::TextureFormat::RED:
-		case renderer::texture::TextureFormat::RED_INTEGER:
-			components = 1;
-			break;
-		case renderer::texture::TextureFormat::RG:
-		case renderer::texture::TextureFormat::RG_INTEGER:
-			components = 2;
-			break;
-		case renderer::texture::TextureFormat::RGB:
-		case renderer::texture::TextureFormat::RGB_INTEGER:
-		case renderer::texture::TextureFormat::BGR:
-		case renderer::texture::TextureFormat::BGR_INTEGER:
-			components = 3;
-			break;
-		case renderer::texture::TextureFormat::RGBA:
-		case renderer::texture::TextureFormat::RGBA_INTEGER:
-		case renderer::texture::TextureFormat::BGRA:
-		case renderer::texture::TextureFormat::BGRA_INTEGER:
-			components = 4;
-			break;
-		case renderer::texture::TextureFormat::STENCIL_INDEX:
-		case renderer::texture::TextureFormat::DEPTH_COMPONENT:
-			components = 1;
-			break;
-		case renderer::texture::TextureFormat::DEPTH_STENCIL:
-			components = 2;
-			break;
-		default:
-			components = 4;
-		}
-
-		uint64_t skip     = static_cast<uint64_t>(texture->m_Width) * static_cast<uint64_t>(texture->m_Height) * static_cast<uint64_t>(components) * static_cast<uint64_t>(dataSize);
-		uint64_t numBytes = skip * texture->m_Textures.size();
-		uint8_t* data     = new uint8_t[numBytes];
-
-		uint64_t i = 0;
-		for (renderer::texture::Texture2D& tex : texture->m_Textures)
+		GLenum   format = textureCommon::GetTextureFormat(texture->m_Format);
+		GLenum   type   = textureCommon::GetTextureType(texture->m_Type);
+		uint32_t levels = textureCommon::GetLevelCount(texture->m_Filter.minimize, texture->m_MaxLevel, texture->m_Width, texture->m_Height);
+		// Stored mipmaps are uploaded as they are, the driver only generates the levels of textures without them.
+		// The levels of compressed textures can't be generated, so they only get the levels they store.
+		bool     compressed   = renderer::texture::IsCompressedFormat(texture->m_Format);
+		uint32_t storedLevels = std::min(levels, renderer::texture::GetStoredLevelCount(*texture));
+		if (compressed)
+			levels = std::max(storedLevels, 1U);
+		else if (storedLevels > 1)
+			levels = storedLevels;
+		GLenum internalFormat = textureCommon::GetTextureInternalFormat(texture->m_Format, texture->m_Type);
+		textureCommon::AllocateTextureStorage(GL_TEXTURE_2D_ARRAY, levels, internalFormat, texture->m_Width, texture->m_Height, static_cast<uint32_t>(texture->m_Textures.size()), format, type);
+
+		TextureUpload upload;
+		upload.m_Target    = GL_TEXTURE_2D_ARRAY;
+		upload.m_Format    = compressed ? internalFormat : format;
+		upload.m_Type      = type;
+		upload.m_PixelSize = renderer::texture::GetPixelSize(texture->m_Format, texture->m_Type);
+		upload.m_BlockSize = renderer::texture::GetBlockSize(texture->m_Format);
+		// Every layer is uploaded straight from its own data, so the layers don't have to be gathered into one block first.
+		for (uint32_t level = 0; level < storedLevels; level++)
 		{
-			memcpy(data + skip * i, tex.m_Data.data(), skip);
-			i++;
-		}
-
-		renderer::texture::TextureFormat format = texture->m_Format;
-		switch (format)
-		{
-		case renderer::texture::TextureFormat::DEPTH_COMPONENT:
-			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT, texture->m_Width, texture->m_Height, static_cast<uint32_t>(texture->m_Textures.size()), 0, GL_DEPTH_COMPONENT, textureCommon::GetTextureType(texture->m_Type), data);
-			break;
-		case renderer::texture::TextureFormat::DEPTH_STENCIL:
-			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_STENCIL, texture->m_Width, texture->m_Height, static_cast<uint32_t>(texture->m_Textures.size()), 0, GL_DEPTH_STENCIL, textureCommon::GetTextureType(texture->m_Type), data);
-			break;
-		default:
-			GLenum internalFormat;
-			switch (texture->m_Type)
+			upload.m_Level  = level;
+			upload.m_Width  = std::max(texture->m_Width >> level, 1U);
+			upload.m_Height = std::max(texture->m_Height >> level, 1U);
+			for (uint32_t layer = 0; layer < texture->m_Textures.size(); layer++)
 			{
-			case renderer::texture::TextureDataType::BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_3_3_2:
-				internalFormat = GL_RGBA8;
-				break;
-			case renderer::texture::TextureDataType::SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_5_5_1:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
-				internalFormat = GL_RGBA16;
-				break;
-			case renderer::texture::TextureDataType::INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_10_10_10_2:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
-				internalFormat = GL_RGBA32UI;
-				break;
-			case renderer::texture::TextureDataType::HALF_FLOAT:
-				internalFormat = GL_RGBA16F;
-				break;
-			case renderer::texture::TextureDataType::FLOAT:
-				internalFormat = GL_RGBA32F;
-				break;
-			default:
-				internalFormat = GL_RGBA;
+				renderer::texture::Texture2D& tex = texture->m_Textures[layer];
+				upload.m_Layer                    = layer;
+				upload.m_Data                     = level == 0 ? tex.m_Data.data() : tex.m_Mips[level - 1].data();
+				uploader->Upload(upload);
 			}
-			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, texture->m_Width, texture->m_Height, static_cast<uint32_t>(texture->m_Textures.size()), 0, textureCommon::GetTextureFormat(format), textureCommon::GetTextureType(texture->m_Type), data);
-			break;
 		}
 
-		switch (texture->m_Filter.minimize)
-		{
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_LINEAR:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_LINEAR:
+		if (storedLevels < levels)
 			glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-			break;
-		default:
-			break;
-		}
 
 		glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 
@@ -196,7 +97,6 @@ namespace gp1::renderer::apis::opengl::texture
 			texture->m_Textures.clear();
 		}
 		texture->ClearDirty();
-		delete[] data;
 	}
 
 } // namespace gp1::renderer::apis::opengl::texture
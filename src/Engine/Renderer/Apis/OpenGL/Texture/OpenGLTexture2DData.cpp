@@ -4,8 +4,10 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTexture2DData.h"
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCommon.h"
+#include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureUploader.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
 
-#include <cstring>
+#include <algorithm>
 
 namespace gp1::renderer::apis::opengl::texture
 {
@@ -14,104 +16,104 @@ namespace gp1::renderer::apis::opengl::texture
 
 	void OpenGLTexture2DData::CleanUp()
 	{
-		if (this->m_TextureID) glDeleteTextures(1, &this->m_TextureID);
+		if (this->m_TextureID)
+		{
+			glDeleteTextures(1, &this->m_TextureID);
+			this->m_TextureID = 0;
+		}
 	}
 
-	uint32_t OpenGLTexture2DData::GetTextureID()
+	uint32_t OpenGLTexture2DData::GetTextureID(OpenGLTextureUploader* uploader)
 	{
-		if (GetDataUnsafe<renderer::texture::Texture2D>()->IsDirty()) InitGLData();
+		renderer::texture::Texture2D* texture = GetDataUnsafe<renderer::texture::Texture2D>();
+		if (texture->IsDirty())
+		{
+			InitGLData(uploader);
+		}
+		else if (texture->IsSamplerDirty() && this->m_TextureID)
+		{
+			glBindTexture(GL_TEXTURE_2D, this->m_TextureID);
+			SetSamplerParameters(texture);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
 		return this->m_TextureID;
 	}
 
-	void OpenGLTexture2DData::InitGLData()
+	void OpenGLTexture2DData::InitGLData(OpenGLTextureUploader* uploader)
 	{
 		if (this->m_TextureID) CleanUp();
 
 		renderer::texture::Texture2D* texture = GetDataUnsafe<renderer::texture::Texture2D>();
-		if (!texture || texture->m_Data.size() == 0 || texture->m_Width == 0 || texture->m_Height == 0) return;
+		if (!texture || texture->m_Width == 0 || texture->m_Height == 0) return;
+
+		// Only the levels from the base level on are allocated, which samples the same as the whole chain with that base level
+		// without spending memory on the levels that can't be sampled. Streamed textures don't hold the levels before it.
+		uint32_t maxLevels = textureCommon::GetLevelCount(texture->m_Filter.minimize, texture->m_MaxLevel, texture->m_Width, texture->m_Height);
+		this->m_BaseLevel  = std::min(texture->m_BaseLevel, maxLevels - 1);
+		uint32_t width     = std::max(texture->m_Width >> this->m_BaseLevel, 1U);
+		uint32_t height    = std::max(texture->m_Height >> this->m_BaseLevel, 1U);
+
+		GLenum   format = textureCommon::GetTextureFormat(texture->m_Format);
+		GLenum   type   = textureCommon::GetTextureType(texture->m_Type);
+		uint32_t levels = maxLevels - this->m_BaseLevel;
+		// Stored mipmaps are uploaded as they are, the driver only generates the levels of textures without them.
+		// The levels of compressed textures can't be generated, so they only get the levels they store.
+		bool     compressed   = renderer::texture::IsCompressedFormat(texture->m_Format);
+		uint32_t storedLevels = std::min(levels, renderer::texture::GetStoredLevelCount(*texture, this->m_BaseLevel));
+		if (storedLevels == 0) return;
+		if (compressed || storedLevels > 1)
+			levels = storedLevels;
 
 		glGenTextures(1, &this->m_TextureID);
 		glBindTexture(GL_TEXTURE_2D, this->m_TextureID);
+		SetSamplerParameters(texture);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureCommon::GetTextureWrapping(texture->m_Wrapping.s));
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureCommon::GetTextureWrapping(texture->m_Wrapping.t));
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.minimize));
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.magnify));
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_LOD_BIAS, texture->m_LodBias);
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, texture->m_MinLod);
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_LOD, texture->m_MaxLod);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, texture->m_BaseLevel);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture->m_MaxLevel);
+		GLenum internalFormat = textureCommon::GetTextureInternalFormat(texture->m_Format, texture->m_Type);
+		textureCommon::AllocateTextureStorage(GL_TEXTURE_2D, levels, internalFormat, width, height, 1, format, type);
 
-		renderer::texture::TextureFormat format = texture->m_Format;
-		switch (format)
+		TextureUpload upload;
+		upload.m_Target    = GL_TEXTURE_2D;
+		upload.m_Format    = compressed ? internalFormat : format;
+		upload.m_Type      = type;
+		upload.m_PixelSize = renderer::texture::GetPixelSize(texture->m_Format, texture->m_Type);
+		upload.m_BlockSize = renderer::texture::GetBlockSize(texture->m_Format);
+		for (uint32_t level = 0; level < storedLevels; level++)
 		{
-		case renderer::texture::TextureFormat::DEPTH_COMPONENT:
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, texture->m_Width, texture->m_Height, 0, GL_DEPTH_COMPONENT, textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
-		case renderer::texture::TextureFormat::DEPTH_STENCIL:
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_STENCIL, texture->m_Width, texture->m_Height, 0, GL_DEPTH_STENCIL, textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
-		default:
-			GLenum internalFormat;
-			switch (texture->m_Type)
-			{
-			case renderer::texture::TextureDataType::BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_3_3_2:
-				internalFormat = GL_RGBA8;
-				break;
-			case renderer::texture::TextureDataType::SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_5_5_1:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
-				internalFormat = GL_RGBA16;
-				break;
-			case renderer::texture::TextureDataType::INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_10_10_10_2:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
-				internalFormat = GL_RGBA32UI;
-				break;
-			case renderer::texture::TextureDataType::HALF_FLOAT:
-				internalFormat = GL_RGBA16F;
-				break;
-			case renderer::texture::TextureDataType::FLOAT:
-				internalFormat = GL_RGBA32F;
-				break;
-			default:
-				internalFormat = GL_RGBA;
-			}
-			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, texture->m_Width, texture->m_Height, 0, textureCommon::GetTextureFormat(format), textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
+			uint32_t textureLevel = this->m_BaseLevel + level;
+			upload.m_Level        = level;
+			upload.m_Width        = std::max(width >> level, 1U);
+			upload.m_Height       = std::max(height >> level, 1U);
+			upload.m_Data         = textureLevel == 0 ? texture->m_Data.data() : texture->m_Mips[textureLevel - 1].data();
+			uploader->Upload(upload);
 		}
 
-		switch (texture->m_Filter.minimize)
-		{
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_LINEAR:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_LINEAR:
+		if (storedLevels < levels)
 			glGenerateMipmap(GL_TEXTURE_2D);
-			break;
-		default:
-			break;
-		}
 
 		glBindTexture(GL_TEXTURE_2D, 0);
 
 		if (!texture->IsEditable() || !texture->IsDynamic())
 		{
 			texture->m_Data.clear();
+			texture->m_Mips.clear();
 		}
 		texture->ClearDirty();
 	}
 
+	void OpenGLTexture2DData::SetSamplerParameters(renderer::texture::Texture2D* texture)
+	{
+		// The allocated levels start at the base level, so the max level is moved along with it.
+		uint32_t maxLevel = texture->m_MaxLevel > this->m_BaseLevel ? texture->m_MaxLevel - this->m_BaseLevel : 0;
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureCommon::GetTextureWrapping(texture->m_Wrapping.s));
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureCommon::GetTextureWrapping(texture->m_Wrapping.t));
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.minimize));
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.magnify));
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_LOD_BIAS, texture->m_LodBias);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, texture->m_MinLod);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_LOD, texture->m_MaxLod);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+		texture->ClearSamplerDirty();
+	}
+
 } // namespace gp1::renderer::apis::opengl::texture
@@ -4,8 +4,10 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTexture3DData.h"
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCommon.h"
+#include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureUploader.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
 
-#include <cstring>
+#include <algorithm>
 
 namespace gp1::renderer::apis::opengl::texture
 {
@@ -14,27 +16,43 @@ namespace gp1::renderer::apis::opengl::texture
 
 	void OpenGLTexture3DData::CleanUp()
 	{
-		if (this->m_TextureID) glDeleteTextures(1, &this->m_TextureID);
+		if (this->m_TextureID)
+		{
+			glDeleteTextures(1, &this->m_TextureID);
+			this->m_TextureID = 0;
+		}
 	}
 
-	uint32_t OpenGLTexture3DData::GetTextureID()
+	uint32_t OpenGLTexture3DData::GetTextureID(OpenGLTextureUploader* uploader)
 	{
-		if (GetDataUnsafe<renderer::texture::Texture3D>()->IsDirty()) InitGLData();
+		renderer::texture::Texture3D* texture = GetDataUnsafe<renderer::texture::Texture3D>();
+		if (texture->IsDirty())
+		{
+			InitGLData(uploader);
+		}
+		else if (this->m_TextureID && !texture->m_Updates.empty())
+		{
+			glBindTexture(GL_TEXTURE_3D, this->m_TextureID);
+			WriteUpdates(uploader);
+			glBindTexture(GL_TEXTURE_3D, 0);
+		}
 		return this->m_TextureID;
 	}
 
-	void OpenGLTexture3DData::InitGLData()
+	void OpenGLTexture3DData::InitGLData(OpenGLTextureUploader* uploader)
 	{
 		if (this->m_TextureID) CleanUp();
 
 		renderer::texture::Texture3D* texture = GetDataUnsafe<renderer::texture::Texture3D>();
-		if (!texture || texture->m_Data.size() == 0 || texture->m_Width == 0 || texture->m_Height == 0 || texture->m_Depth == 0) return;
+		// Textures without data are still created if they are written by updates.
+		if (!texture || (texture->m_Data.size() == 0 && texture->m_Updates.empty()) || texture->m_Width == 0 || texture->m_Height == 0 || texture->m_Depth == 0) return;
 
 		glGenTextures(1, &this->m_TextureID);
 		glBindTexture(GL_TEXTURE_3D, this->m_TextureID);
 
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, textureCommon::GetTextureWrapping(texture->m_Wrapping.s));
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, textureCommon::GetTextureWrapping(texture->m_Wrapping.t));
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, textureCommon::GetTextureWrapping(texture->m_Wrapping.r));
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.minimize));
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, textureCommon::GetTextureFilter(texture->m_Filter.magnify));
 		glTexParameterf(GL_TEXTURE_3D, GL_TEXTURE_LOD_BIAS, texture->m_LodBias);
@@ -43,75 +61,82 @@ namespace gp1::renderer::apis::opengl::texture
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, texture->m_BaseLevel);
 		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, texture->m_MaxLevel);
 
-		renderer::texture::TextureFormat format = texture->m_Format;
-		switch (format)
+		GLenum   format = textureCommon::GetTextureFormat(texture->m_Format);
+		GLenum   type   = textureCommon::GetTextureType(texture->m_Type);
+		uint32_t levels = textureCommon::GetLevelCount(texture->m_Filter.minimize, texture->m_MaxLevel, texture->m_Width, texture->m_Height, texture->m_Depth);
+		// Stored mipmaps are uploaded as they are, the driver only generates the levels of textures without them.
+		// The levels of compressed textures can't be generated, so they only get the levels they store.
+		bool     compressed   = renderer::texture::IsCompressedFormat(texture->m_Format);
+		uint32_t storedLevels = texture->m_Data.empty() ? 0 : std::min(levels, renderer::texture::GetStoredLevelCount(*texture));
+		if (compressed)
+			levels = std::max(storedLevels, 1U);
+		else if (storedLevels > 1)
+			levels = storedLevels;
+		GLenum internalFormat = textureCommon::GetTextureInternalFormat(texture->m_Format, texture->m_Type);
+		textureCommon::AllocateTextureStorage(GL_TEXTURE_3D, levels, internalFormat, texture->m_Width, texture->m_Height, texture->m_Depth, format, type);
+
+		TextureUpload upload;
+		upload.m_Target    = GL_TEXTURE_3D;
+		upload.m_Format    = compressed ? internalFormat : format;
+		upload.m_Type      = type;
+		upload.m_PixelSize = renderer::texture::GetPixelSize(texture->m_Format, texture->m_Type);
+		upload.m_BlockSize = renderer::texture::GetBlockSize(texture->m_Format);
+		for (uint32_t level = 0; level < storedLevels; level++)
 		{
-		case renderer::texture::TextureFormat::DEPTH_COMPONENT:
-			glTexImage3D(GL_TEXTURE_3D, 0, GL_DEPTH_COMPONENT, texture->m_Width, texture->m_Height, texture->m_Depth, 0, GL_DEPTH_COMPONENT, textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
-		case renderer::texture::TextureFormat::DEPTH_STENCIL:
-			glTexImage3D(GL_TEXTURE_3D, 0, GL_DEPTH_STENCIL, texture->m_Width, texture->m_Height, texture->m_Depth, 0, GL_DEPTH_STENCIL, textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
-		default:
-			GLenum internalFormat;
-			switch (texture->m_Type)
-			{
-			case renderer::texture::TextureDataType::BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_BYTE_3_3_2:
-				internalFormat = GL_RGBA8;
-				break;
-			case renderer::texture::TextureDataType::SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_5_5_1:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5:
-			case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
-				internalFormat = GL_RGBA16;
-				break;
-			case renderer::texture::TextureDataType::INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_10_10_10_2:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8:
-			case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
-				internalFormat = GL_RGBA32UI;
-				break;
-			case renderer::texture::TextureDataType::HALF_FLOAT:
-				internalFormat = GL_RGBA16F;
-				break;
-			case renderer::texture::TextureDataType::FLOAT:
-				internalFormat = GL_RGBA32F;
-				break;
-			default:
-				internalFormat = GL_RGBA;
-			}
-			glTexImage3D(GL_TEXTURE_3D, 0, internalFormat, texture->m_Width, texture->m_Height, texture->m_Depth, 0, textureCommon::GetTextureFormat(format), textureCommon::GetTextureType(texture->m_Type), texture->m_Data.data());
-			break;
+			upload.m_Level  = level;
+			upload.m_Width  = std::max(texture->m_Width >> level, 1U);
+			upload.m_Height = std::max(texture->m_Height >> level, 1U);
+			upload.m_Depth  = std::max(texture->m_Depth >> level, 1U);
+			upload.m_Data   = level == 0 ? texture->m_Data.data() : texture->m_Mips[level - 1].data();
+			uploader->Upload(upload);
 		}
 
-		switch (texture->m_Filter.minimize)
-		{
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::NEAREST_MIPMAP_LINEAR:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_NEAREST:
-		case renderer::texture::TextureFilter::LINEAR_MIPMAP_LINEAR:
+		WriteUpdates(uploader);
+
+		if (storedLevels < levels)
 			glGenerateMipmap(GL_TEXTURE_3D);
-			break;
-		default:
-			break;
-		}
 
 		glBindTexture(GL_TEXTURE_3D, 0);
 
 		if (!texture->IsEditable() || !texture->IsDynamic())
 		{
 			texture->m_Data.clear();
+			texture->m_Mips.clear();
 		}
 		texture->ClearDirty();
 	}
 
+	void OpenGLTexture3DData::WriteUpdates(OpenGLTextureUploader* uploader)
+	{
+		renderer::texture::Texture3D* texture = GetDataUnsafe<renderer::texture::Texture3D>();
+		if (renderer::texture::IsCompressedFormat(texture->m_Format))
+		{
+			texture->m_Updates.clear();
+			return;
+		}
+
+		TextureUpload upload;
+		upload.m_Target    = GL_TEXTURE_3D;
+		upload.m_Format    = textureCommon::GetTextureFormat(texture->m_Format);
+		upload.m_Type      = textureCommon::GetTextureType(texture->m_Type);
+		upload.m_PixelSize = renderer::texture::GetPixelSize(texture->m_Format, texture->m_Type);
+		for (const renderer::texture::Texture3DUpdate& update : texture->m_Updates)
+		{
+			// Regions reaching outside the texture would fail as a whole, so they are dropped.
+			if (update.m_X + update.m_Width > texture->m_Width || update.m_Y + update.m_Height > texture->m_Height || update.m_Z + update.m_Depth > texture->m_Depth ||
+			    update.m_Data.size() < static_cast<uint64_t>(update.m_Width) * update.m_Height * update.m_Depth * upload.m_PixelSize)
+				continue;
+
+			upload.m_X      = update.m_X;
+			upload.m_Y      = update.m_Y;
+			upload.m_Layer  = update.m_Z;
+			upload.m_Width  = update.m_Width;
+			upload.m_Height = update.m_Height;
+			upload.m_Depth  = update.m_Depth;
+			upload.m_Data   = update.m_Data.data();
+			uploader->Upload(upload);
+		}
+		texture->m_Updates.clear();
+	}
+
 } // namespace gp1::renderer::apis::opengl::texture
@@ -4,6 +4,7 @@
 
 #include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureCommon.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace gp1::renderer::apis::opengl::textureCommon
@@ -136,4 +137,191 @@ namespace gp1::renderer::apis::opengl::textureCommon
 		}
 	}
 
+	GLenum GetTextureInternalFormat(renderer::texture::TextureFormat format, renderer::texture::TextureDataType type)
+	{
+		switch (format)
+		{
+		case renderer::texture::TextureFormat::DEPTH_COMPONENT:
+			return type == renderer::texture::TextureDataType::FLOAT ? GL_DEPTH_COMPONENT32F : GL_DEPTH_COMPONENT24;
+		case renderer::texture::TextureFormat::DEPTH_STENCIL:
+			return GL_DEPTH24_STENCIL8;
+		case renderer::texture::TextureFormat::BC1_RGB:
+			return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		case renderer::texture::TextureFormat::BC1_RGBA:
+			return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+		case renderer::texture::TextureFormat::BC1_SRGB:
+			return GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+		case renderer::texture::TextureFormat::BC1_SRGB_ALPHA:
+			return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+		case renderer::texture::TextureFormat::BC2:
+			return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+		case renderer::texture::TextureFormat::BC2_SRGB:
+			return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+		case renderer::texture::TextureFormat::BC3:
+			return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		case renderer::texture::TextureFormat::BC3_SRGB:
+			return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+		case renderer::texture::TextureFormat::BC4:
+			return GL_COMPRESSED_RED_RGTC1;
+		case renderer::texture::TextureFormat::BC4_SIGNED:
+			return GL_COMPRESSED_SIGNED_RED_RGTC1;
+		case renderer::texture::TextureFormat::BC5:
+			return GL_COMPRESSED_RG_RGTC2;
+		case renderer::texture::TextureFormat::BC5_SIGNED:
+			return GL_COMPRESSED_SIGNED_RG_RGTC2;
+		case renderer::texture::TextureFormat::BC6H:
+			return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+		case renderer::texture::TextureFormat::BC6H_SIGNED:
+			return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+		case renderer::texture::TextureFormat::BC7:
+			return GL_COMPRESSED_RGBA_BPTC_UNORM;
+		case renderer::texture::TextureFormat::BC7_SRGB:
+			return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+		default:
+			break;
+		}
+
+		switch (type)
+		{
+		case renderer::texture::TextureDataType::BYTE:
+		case renderer::texture::TextureDataType::UNSIGNED_BYTE:
+		case renderer::texture::TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
+		case renderer::texture::TextureDataType::UNSIGNED_BYTE_3_3_2:
+			return GL_RGBA8;
+		case renderer::texture::TextureDataType::SHORT:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_5_5_1:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5:
+		case renderer::texture::TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
+			return GL_RGBA16;
+		case renderer::texture::TextureDataType::INT:
+		case renderer::texture::TextureDataType::UNSIGNED_INT:
+		case renderer::texture::TextureDataType::UNSIGNED_INT_10_10_10_2:
+		case renderer::texture::TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
+		case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8:
+		case renderer::texture::TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
+			return GL_RGBA32UI;
+		case renderer::texture::TextureDataType::HALF_FLOAT:
+			return GL_RGBA16F;
+		case renderer::texture::TextureDataType::FLOAT:
+			return GL_RGBA32F;
+		default:
+			return GL_RGBA8;
+		}
+	}
+
+	bool UsesMipmaps(renderer::texture::TextureFilter filter)
+	{
+		switch (filter)
+		{
+		case renderer::texture::TextureFilter::NEAREST_MIPMAP_NEAREST:
+		case renderer::texture::TextureFilter::NEAREST_MIPMAP_LINEAR:
+		case renderer::texture::TextureFilter::LINEAR_MIPMAP_NEAREST:
+		case renderer::texture::TextureFilter::LINEAR_MIPMAP_LINEAR:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	uint32_t GetLevelCount(renderer::texture::TextureFilter filter, uint32_t maxLevel, uint32_t width, uint32_t height, uint32_t depth)
+	{
+		if (!UsesMipmaps(filter))
+			return 1;
+
+		uint32_t size   = std::max({ width, height, depth });
+		uint32_t levels = 1;
+		while (size > 1 && levels <= maxLevel)
+		{
+			size >>= 1;
+			levels++;
+		}
+		return levels;
+	}
+
+	// Get the bytes of one 4x4 block of the compressed internal format, 0 for uncompressed internal formats.
+	static uint32_t GetCompressedBlockSize(GLenum internalFormat)
+	{
+		switch (internalFormat)
+		{
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RED_RGTC1:
+		case GL_COMPRESSED_SIGNED_RED_RGTC1:
+			return 8;
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+		case GL_COMPRESSED_RG_RGTC2:
+		case GL_COMPRESSED_SIGNED_RG_RGTC2:
+		case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+		case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+		case GL_COMPRESSED_RGBA_BPTC_UNORM:
+		case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+			return 16;
+		default:
+			return 0;
+		}
+	}
+
+	void AllocateTextureStorage(GLenum target, uint32_t levels, GLenum internalFormat, uint32_t width, uint32_t height, uint32_t depth, GLenum format, GLenum type)
+	{
+		bool is3D = target == GL_TEXTURE_3D || target == GL_TEXTURE_2D_ARRAY;
+		if (GLAD_GL_VERSION_4_2)
+		{
+			if (is3D)
+				glTexStorage3D(target, static_cast<GLsizei>(levels), internalFormat, width, height, depth);
+			else
+				glTexStorage2D(target, static_cast<GLsizei>(levels), internalFormat, width, height);
+			return;
+		}
+
+		// Compressed levels have to be allocated with glCompressedTexImage*, which wants the size of the level's blocks.
+		uint32_t blockSize = GetCompressedBlockSize(internalFormat);
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			GLsizei imageSize = static_cast<GLsizei>(((width + 3) / 4) * ((height + 3) / 4) * blockSize);
+			if (blockSize > 0 && is3D)
+			{
+				glCompressedTexImage3D(target, level, internalFormat, width, height, depth, 0, imageSize * depth, nullptr);
+			}
+			else if (blockSize > 0)
+			{
+				if (target == GL_TEXTURE_CUBE_MAP)
+				{
+					for (uint32_t face = 0; face < 6; face++)
+						glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internalFormat, width, height, 0, imageSize, nullptr);
+				}
+				else
+				{
+					glCompressedTexImage2D(target, level, internalFormat, width, height, 0, imageSize, nullptr);
+				}
+			}
+			else if (is3D)
+			{
+				glTexImage3D(target, level, internalFormat, width, height, depth, 0, format, type, nullptr);
+			}
+			else if (target == GL_TEXTURE_CUBE_MAP)
+			{
+				for (uint32_t face = 0; face < 6; face++)
+					glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internalFormat, width, height, 0, format, type, nullptr);
+			}
+			else
+			{
+				glTexImage2D(target, level, internalFormat, width, height, 0, format, type, nullptr);
+			}
+
+			width  = std::max(width / 2, 1U);
+			height = std::max(height / 2, 1U);
+			if (target == GL_TEXTURE_3D)
+				depth = std::max(depth / 2, 1U);
+		}
+	}
+
 } // namespace gp1::renderer::apis::opengl::textureCommon
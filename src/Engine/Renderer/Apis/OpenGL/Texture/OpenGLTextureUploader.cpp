@@ -0,0 +1,200 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Apis/OpenGL/Texture/OpenGLTextureUploader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace gp1::renderer::apis::opengl::texture
+{
+	Logger OpenGLTextureUploader::s_Logger("OpenGL Texture Uploader");
+
+	OpenGLTextureUploader::OpenGLTextureUploader(uint64_t bufferSize, uint32_t maxBuffers)
+	    : m_BufferSize(bufferSize > 0 ? bufferSize : 1), m_MaxBuffers(maxBuffers > 0 ? maxBuffers : 1) {}
+
+	OpenGLTextureUploader::~OpenGLTextureUploader()
+	{
+		CleanUp();
+	}
+
+	void OpenGLTextureUploader::CleanUp()
+	{
+		for (PixelBuffer& buffer : this->m_Buffers)
+		{
+			if (buffer.m_Fence)
+				glDeleteSync(buffer.m_Fence);
+			glDeleteBuffers(1, &buffer.m_Buffer);
+		}
+		this->m_Buffers.clear();
+		this->m_NextBuffer      = 0;
+		this->m_Stats.m_Buffers = 0;
+	}
+
+	void OpenGLTextureUploader::Upload(const TextureUpload& upload)
+	{
+		if (!upload.m_Data || upload.m_Width == 0 || upload.m_Height == 0 || upload.m_Depth == 0)
+			return;
+
+		// Compressed images are split along rows of blocks, each covering four rows of pixels.
+		uint32_t rowHeight = upload.m_BlockSize > 0 ? 4 : 1;
+		uint32_t rows      = (upload.m_Height + rowHeight - 1) / rowHeight;
+		uint64_t rowSize   = upload.m_BlockSize > 0 ? static_cast<uint64_t>((upload.m_Width + 3) / 4) * upload.m_BlockSize : static_cast<uint64_t>(upload.m_Width) * upload.m_PixelSize;
+		uint64_t sliceSize = rowSize * rows;
+		this->m_Stats.m_Uploads++;
+		this->m_Stats.m_BytesUploaded += sliceSize * upload.m_Depth;
+
+		// The rows are tightly packed, which the default unpack alignment of 4 doesn't allow for odd widths of 3 byte pixels.
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		const uint8_t* pixels = reinterpret_cast<const uint8_t*>(upload.m_Data);
+		if (sliceSize <= this->m_BufferSize)
+		{
+			// Whole slices fit in a buffer, so as many as fit are copied at once.
+			uint32_t slicesPerChunk = static_cast<uint32_t>(std::min<uint64_t>(this->m_BufferSize / sliceSize, upload.m_Depth));
+			for (uint32_t layer = 0; layer < upload.m_Depth; layer += slicesPerChunk)
+			{
+				uint32_t depth = std::min(slicesPerChunk, upload.m_Depth - layer);
+				CopyChunk(upload, 0, upload.m_Height, layer, depth, pixels + layer * sliceSize, depth * sliceSize);
+			}
+		}
+		else
+		{
+			uint32_t rowsPerChunk = static_cast<uint32_t>(std::clamp<uint64_t>(this->m_BufferSize / rowSize, 1, rows));
+			for (uint32_t layer = 0; layer < upload.m_Depth; layer++)
+			{
+				for (uint32_t row = 0; row < rows; row += rowsPerChunk)
+				{
+					uint32_t chunkRows = std::min(rowsPerChunk, rows - row);
+					uint32_t y         = row * rowHeight;
+					uint32_t height    = std::min(chunkRows * rowHeight, upload.m_Height - y);
+					CopyChunk(upload, y, height, layer, 1, pixels + layer * sliceSize + row * rowSize, chunkRows * rowSize);
+				}
+			}
+		}
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	void OpenGLTextureUploader::EndFrame()
+	{
+		if (this->m_FrameStalls > 0)
+			OpenGLTextureUploader::s_Logger.LogDebug("Stalled %.3f ms in %u waits for the gpu to release a pixel buffer this frame", this->m_FrameStallTime, this->m_FrameStalls);
+		this->m_FrameStalls    = 0;
+		this->m_FrameStallTime = 0.0;
+	}
+
+	const TextureUploaderStats& OpenGLTextureUploader::GetStats() const
+	{
+		return this->m_Stats;
+	}
+
+	OpenGLTextureUploader::PixelBuffer& OpenGLTextureUploader::AcquireBuffer(uint64_t size)
+	{
+		PixelBuffer* buffer = nullptr;
+		if (!this->m_Buffers.empty())
+		{
+			PixelBuffer& next = this->m_Buffers[this->m_NextBuffer];
+			if (!next.m_Fence || glClientWaitSync(next.m_Fence, 0, 0) != GL_TIMEOUT_EXPIRED)
+			{
+				buffer = &next;
+			}
+			else if (this->m_Buffers.size() >= this->m_MaxBuffers)
+			{
+				// Every buffer is still being read, there is nothing to do but wait for the oldest one.
+				// Only waits that actually block count as stalls, the fence may have signaled since it was polled.
+				auto   start   = std::chrono::high_resolution_clock::now();
+				GLenum result  = glClientWaitSync(next.m_Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+				bool   blocked = result == GL_TIMEOUT_EXPIRED;
+				while (result == GL_TIMEOUT_EXPIRED)
+					result = glClientWaitSync(next.m_Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+				if (blocked)
+				{
+					double stallTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+					this->m_Stats.m_Stalls++;
+					this->m_Stats.m_StallTime += stallTime;
+					this->m_FrameStalls++;
+					this->m_FrameStallTime += stallTime;
+				}
+				if (result == GL_WAIT_FAILED)
+					OpenGLTextureUploader::s_Logger.LogError("Waiting for a pixel buffer failed");
+				buffer = &next;
+			}
+		}
+
+		if (!buffer)
+		{
+			// The new buffer takes the place of the busy one, which stays the oldest and is tried again next.
+			auto itr = this->m_Buffers.insert(this->m_Buffers.begin() + this->m_NextBuffer, PixelBuffer {});
+			buffer   = &*itr;
+			glGenBuffers(1, &buffer->m_Buffer);
+			this->m_Stats.m_Buffers = static_cast<uint32_t>(this->m_Buffers.size());
+		}
+		this->m_NextBuffer = (this->m_NextBuffer + 1) % static_cast<uint32_t>(this->m_Buffers.size());
+
+		if (buffer->m_Fence)
+		{
+			glDeleteSync(buffer->m_Fence);
+			buffer->m_Fence = nullptr;
+		}
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->m_Buffer);
+		if (buffer->m_Size < size)
+		{
+			buffer->m_Size = std::max(size, this->m_BufferSize);
+			glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(buffer->m_Size), nullptr, GL_STREAM_DRAW);
+		}
+		return *buffer;
+	}
+
+	void OpenGLTextureUploader::CopyChunk(const TextureUpload& upload, uint32_t y, uint32_t height, uint32_t layer, uint32_t depth, const uint8_t* pixels, uint64_t size)
+	{
+		this->m_Stats.m_Chunks++;
+
+		PixelBuffer& buffer = AcquireBuffer(size);
+		// The fence guarantees the gpu is done with the buffer, so the driver doesn't have to synchronize the mapping.
+		void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (mapped)
+		{
+			std::memcpy(mapped, pixels, size);
+			if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+			{
+				TexSubImage(upload, y, height, upload.m_Layer + layer, depth, nullptr, size);
+				// The fence is flushed so it reaches the gpu and can signal before the buffer is polled again.
+				buffer.m_Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				glFlush();
+				return;
+			}
+		}
+
+		// The buffer couldn't be mapped or its contents were lost, so the pixels are read from client memory instead.
+		OpenGLTextureUploader::s_Logger.LogWarning("Failed to write %llu bytes to a pixel buffer, uploading from client memory", static_cast<unsigned long long>(size));
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		TexSubImage(upload, y, height, upload.m_Layer + layer, depth, pixels, size);
+	}
+
+	void OpenGLTextureUploader::TexSubImage(const TextureUpload& upload, uint32_t y, uint32_t height, uint32_t layer, uint32_t depth, const void* pixels, uint64_t size)
+	{
+		bool is3D = upload.m_Target == GL_TEXTURE_3D || upload.m_Target == GL_TEXTURE_2D_ARRAY;
+		if (upload.m_BlockSize > 0)
+		{
+			if (is3D)
+				glCompressedTexSubImage3D(upload.m_Target, upload.m_Level, upload.m_X, upload.m_Y + y, layer, upload.m_Width, height, depth, upload.m_Format, static_cast<GLsizei>(size), pixels);
+			else
+				glCompressedTexSubImage2D(upload.m_Target, upload.m_Level, upload.m_X, upload.m_Y + y, upload.m_Width, height, upload.m_Format, static_cast<GLsizei>(size), pixels);
+		}
+		else if (is3D)
+		{
+			glTexSubImage3D(upload.m_Target, upload.m_Level, upload.m_X, upload.m_Y + y, layer, upload.m_Width, height, depth, upload.m_Format, upload.m_Type, pixels);
+		}
+		else
+		{
+			glTexSubImage2D(upload.m_Target, upload.m_Level, upload.m_X, upload.m_Y + y, upload.m_Width, height, upload.m_Format, upload.m_Type, pixels);
+		}
+	}
+
+} // namespace gp1::renderer::apis::opengl::texture
@@ -0,0 +1,75 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Apis/OpenGL/Voxel/OpenGLVoxelMaterialTableData.h"
+
+#include <glad/glad.h>
+
+#include <vector>
+
+namespace gp1::renderer::apis::opengl::voxel
+{
+	static_assert(sizeof(GPUVoxelMaterial) == 48, "GPUVoxelMaterial has to match the std430 layout of the voxel shader");
+
+	OpenGLVoxelMaterialTableData::OpenGLVoxelMaterialTableData(renderer::voxel::VoxelMaterialTable* table)
+	    : OpenGLRendererData(table) {}
+
+	void OpenGLVoxelMaterialTableData::CleanUp()
+	{
+		if (this->m_Buffer)
+		{
+			glDeleteBuffers(1, &this->m_Buffer);
+			this->m_Buffer = 0;
+		}
+		this->m_Capacity = 0;
+	}
+
+	void OpenGLVoxelMaterialTableData::UpdateGLData()
+	{
+		renderer::voxel::VoxelMaterialTable* table = GetDataUnsafe<renderer::voxel::VoxelMaterialTable>();
+		if (this->m_Buffer && !table->IsDirty())
+			return;
+
+		if (!this->m_Buffer)
+			glGenBuffers(1, &this->m_Buffer);
+
+		// An empty table still gets one default material so the binding is never empty.
+		uint32_t count = table->GetMaterialCount();
+		if (count == 0)
+			count = 1;
+
+		uint32_t begin = table->GetDirtyMaterials().m_Begin;
+		uint32_t end   = table->GetDirtyMaterials().m_End;
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->m_Buffer);
+		if (count > this->m_Capacity)
+		{
+			// Growing reallocates the buffer, so the whole table is uploaded again.
+			this->m_Capacity = count;
+			glBufferData(GL_SHADER_STORAGE_BUFFER, this->m_Capacity * sizeof(GPUVoxelMaterial), nullptr, GL_STATIC_DRAW);
+			begin = 0;
+			end   = count;
+		}
+
+		std::vector<GPUVoxelMaterial> materials(end - begin);
+		for (uint32_t i = begin; i < end; i++)
+		{
+			const renderer::voxel::VoxelMaterial& material = table->GetMaterial(i);
+			GPUVoxelMaterial&                     packed   = materials[i - begin];
+			packed.m_Tint                                  = material.m_Tint;
+			packed.m_Emissive                              = { material.m_Emissive, 0.0f };
+			packed.m_TextureLayer                          = material.m_TextureLayer;
+			packed.m_Flags                                 = material.m_Flags;
+		}
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, begin * sizeof(GPUVoxelMaterial), materials.size() * sizeof(GPUVoxelMaterial), materials.data());
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		table->ClearDirty();
+	}
+
+	void OpenGLVoxelMaterialTableData::BindBuffer()
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VoxelBufferBinding::MATERIALS, this->m_Buffer);
+	}
+
+} // namespace gp1::renderer::apis::opengl::voxel
@@ -75,6 +75,15 @@ namespace gp1::renderer::apis::vulkan
 		return nullptr;
 	}
 
+	bool VulkanRenderer::SupportsCompute() const
+	{
+		return false;
+	}
+
+	void VulkanRenderer::DispatchCompute([[maybe_unused]] renderer::shader::Material* material, [[maybe_unused]] uint32_t numGroupsX, [[maybe_unused]] uint32_t numGroupsY, [[maybe_unused]] uint32_t numGroupsZ)
+	{
+	}
+
 	void VulkanRenderer::InitRenderer()
 	{
 	}
@@ -0,0 +1,132 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Culling/StaticInstanceGroup.h"
+#include "Engine/Renderer/Mesh/StaticMesh.h"
+
+#include <cmath>
+#include <limits>
+
+namespace gp1::renderer::culling
+{
+	// Get the world space bounding sphere of an instance, scaled by the largest scale of its transform.
+	static glm::fvec4 GetInstanceSphere(const glm::fvec4& boundingSphere, const glm::fmat4& transformationMatrix)
+	{
+		float scaleX = glm::dot(glm::fvec3(transformationMatrix[0]), glm::fvec3(transformationMatrix[0]));
+		float scaleY = glm::dot(glm::fvec3(transformationMatrix[1]), glm::fvec3(transformationMatrix[1]));
+		float scaleZ = glm::dot(glm::fvec3(transformationMatrix[2]), glm::fvec3(transformationMatrix[2]));
+		float scale  = std::sqrt(glm::max(glm::max(scaleX, scaleY), scaleZ));
+		return { glm::fvec3(transformationMatrix * glm::fvec4(glm::fvec3(boundingSphere), 1.0f)), boundingSphere.w * scale };
+	}
+
+	StaticInstanceGroup::StaticInstanceGroup(mesh::StaticMesh* mesh, shader::Material* material)
+	    : Data(this), m_Mesh(mesh), m_Material(material) {}
+
+	void StaticInstanceGroup::AddInstance(const glm::fmat4& transformationMatrix)
+	{
+		this->m_Transforms.push_back(transformationMatrix);
+		ExpandBounds(transformationMatrix);
+		this->m_Dirty = true;
+	}
+
+	void StaticInstanceGroup::SetInstanceTransform(uint32_t index, const glm::fmat4& transformationMatrix)
+	{
+		this->m_Transforms[index] = transformationMatrix;
+		ExpandBounds(transformationMatrix);
+		this->m_Dirty = true;
+	}
+
+	void StaticInstanceGroup::MarkDirty()
+	{
+		this->m_Dirty       = true;
+		this->m_BoundsDirty = true;
+	}
+
+	void StaticInstanceGroup::ClearDirty()
+	{
+		this->m_Dirty = false;
+	}
+
+	bool StaticInstanceGroup::IsDirty()
+	{
+		return this->m_Dirty;
+	}
+
+	void StaticInstanceGroup::UpdateBounds()
+	{
+		if (this->m_BoundsDirty || (this->m_Mesh && this->m_BoundingSphere != this->m_Mesh->m_BoundingSphere))
+			RecalculateBounds();
+	}
+
+	void StaticInstanceGroup::RecalculateBounds()
+	{
+		if (this->m_Mesh)
+			this->m_BoundingSphere = this->m_Mesh->m_BoundingSphere;
+
+		this->m_WorldBoundingSphere = { 0.0f, 0.0f, 0.0f, 0.0f };
+		this->m_MaxInstanceRadius   = 0.0f;
+		this->m_RecalculatedRadius  = 0.0f;
+		this->m_BoundsDirty         = false;
+		if (this->m_Transforms.empty())
+			return;
+
+		// The group's sphere is centered on the box around every instance's sphere.
+		glm::fvec3 min { std::numeric_limits<float>::max() };
+		glm::fvec3 max { -std::numeric_limits<float>::max() };
+		for (const glm::fmat4& transformationMatrix : this->m_Transforms)
+		{
+			glm::fvec4 sphere         = GetInstanceSphere(this->m_BoundingSphere, transformationMatrix);
+			min                       = glm::min(min, glm::fvec3(sphere) - sphere.w);
+			max                       = glm::max(max, glm::fvec3(sphere) + sphere.w);
+			this->m_MaxInstanceRadius = glm::max(this->m_MaxInstanceRadius, sphere.w);
+		}
+
+		glm::fvec3 center = (min + max) * 0.5f;
+		float      radius = 0.0f;
+		for (const glm::fmat4& transformationMatrix : this->m_Transforms)
+		{
+			glm::fvec4 sphere = GetInstanceSphere(this->m_BoundingSphere, transformationMatrix);
+			radius            = glm::max(radius, glm::length(glm::fvec3(sphere) - center) + sphere.w);
+		}
+		this->m_WorldBoundingSphere = { center, radius };
+		this->m_RecalculatedRadius  = radius;
+	}
+
+	void StaticInstanceGroup::ExpandBounds(const glm::fmat4& transformationMatrix)
+	{
+		if (this->m_BoundsDirty)
+			return;
+
+		glm::fvec4 sphere         = GetInstanceSphere(this->m_BoundingSphere, transformationMatrix);
+		this->m_MaxInstanceRadius = glm::max(this->m_MaxInstanceRadius, sphere.w);
+		if (this->m_Transforms.size() == 1)
+		{
+			this->m_WorldBoundingSphere = sphere;
+			this->m_RecalculatedRadius  = sphere.w;
+			return;
+		}
+
+		// Merge the spheres into the smallest sphere around both.
+		glm::fvec3 center   = glm::fvec3(this->m_WorldBoundingSphere);
+		glm::fvec3 offset   = glm::fvec3(sphere) - center;
+		float      distance = glm::length(offset);
+		if (distance + sphere.w <= this->m_WorldBoundingSphere.w)
+			return;
+
+		if (distance + this->m_WorldBoundingSphere.w <= sphere.w)
+		{
+			this->m_WorldBoundingSphere = sphere;
+		}
+		else
+		{
+			float radius                = (distance + this->m_WorldBoundingSphere.w + sphere.w) * 0.5f;
+			this->m_WorldBoundingSphere = { center + offset * ((radius - this->m_WorldBoundingSphere.w) / distance), radius };
+		}
+
+		// Moving instances keep growing the sphere, so it's recalculated once it has become too loose.
+		if (this->m_WorldBoundingSphere.w > this->m_RecalculatedRadius * 2.0f)
+			this->m_BoundsDirty = true;
+	}
+
+} // namespace gp1::renderer::culling
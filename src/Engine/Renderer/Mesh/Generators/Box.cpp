@@ -0,0 +1,45 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/Box.h"
+
+namespace gp1::renderer::meshGenerators
+{
+	// The normal, u and v axis of every face, u cross v is the normal so the quads are counter clockwise.
+	const glm::fvec3 s_BoxFaces[6][3] = {
+		{ { 1, 0, 0 }, { 0, 0, -1 }, { 0, 1, 0 } },
+		{ { -1, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 } },
+		{ { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, -1 } },
+		{ { 0, -1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } },
+		{ { 0, 0, 1 }, { 1, 0, 0 }, { 0, 1, 0 } },
+		{ { 0, 0, -1 }, { -1, 0, 0 }, { 0, 1, 0 } }
+	};
+
+	void GenerateBox(mesh::StaticMesh& mesh, const glm::fvec3& halfExtents)
+	{
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		mesh.m_Vertices.reserve(24);
+		mesh.m_Indices.reserve(36);
+
+		for (const auto& face : s_BoxFaces)
+		{
+			uint32_t first = static_cast<uint32_t>(mesh.m_Vertices.size());
+			for (uint32_t corner = 0; corner < 4; corner++)
+			{
+				glm::fvec2 uv { static_cast<float>(corner & 1), static_cast<float>(corner >> 1) };
+				glm::fvec3 p = face[0] + face[1] * (uv.x * 2.0f - 1.0f) + face[2] * (uv.y * 2.0f - 1.0f);
+				mesh.m_Vertices.push_back({ p * halfExtents, face[0], uv });
+			}
+
+			mesh.m_Indices.push_back(first);
+			mesh.m_Indices.push_back(first + 1);
+			mesh.m_Indices.push_back(first + 3);
+			mesh.m_Indices.push_back(first);
+			mesh.m_Indices.push_back(first + 3);
+			mesh.m_Indices.push_back(first + 2);
+		}
+	}
+
+} // namespace gp1::renderer::meshGenerators
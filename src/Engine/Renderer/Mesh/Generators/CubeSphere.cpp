@@ -0,0 +1,72 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/CubeSphere.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gp1::renderer::meshGenerators
+{
+	// The normal, u and v axis of every cube face, u cross v is the normal so the quads are counter clockwise.
+	const glm::fvec3 s_CubeSphereFaces[6][3] = {
+		{ { 1, 0, 0 }, { 0, 0, -1 }, { 0, 1, 0 } },
+		{ { -1, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 } },
+		{ { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, -1 } },
+		{ { 0, -1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } },
+		{ { 0, 0, 1 }, { 1, 0, 0 }, { 0, 1, 0 } },
+		{ { 0, 0, -1 }, { -1, 0, 0 }, { 0, 1, 0 } }
+	};
+
+	void GenerateCubeSphere(mesh::StaticMesh& mesh, uint32_t resolution)
+	{
+		resolution = std::max(resolution, 1U);
+
+		uint32_t stride = resolution + 1;
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		mesh.m_Vertices.reserve(6ULL * stride * stride);
+		mesh.m_Indices.reserve(36ULL * resolution * resolution);
+
+		for (const auto& face : s_CubeSphereFaces)
+		{
+			uint32_t first = static_cast<uint32_t>(mesh.m_Vertices.size());
+			for (uint32_t j = 0; j <= resolution; j++)
+			{
+				for (uint32_t i = 0; i <= resolution; i++)
+				{
+					glm::fvec2 uv { static_cast<float>(i) / resolution, static_cast<float>(j) / resolution };
+					glm::fvec3 p = face[0] + face[1] * (uv.x * 2.0f - 1.0f) + face[2] * (uv.y * 2.0f - 1.0f);
+
+					// Spreads the vertices more evenly than normalizing the cube point.
+					glm::fvec3 p2 = p * p;
+					glm::fvec3 position {
+						p.x * std::sqrt(1.0f - p2.y * 0.5f - p2.z * 0.5f + p2.y * p2.z / 3.0f),
+						p.y * std::sqrt(1.0f - p2.z * 0.5f - p2.x * 0.5f + p2.z * p2.x / 3.0f),
+						p.z * std::sqrt(1.0f - p2.x * 0.5f - p2.y * 0.5f + p2.x * p2.y / 3.0f)
+					};
+					mesh.m_Vertices.push_back({ position, position, uv });
+				}
+			}
+
+			for (uint32_t j = 0; j < resolution; j++)
+			{
+				for (uint32_t i = 0; i < resolution; i++)
+				{
+					uint32_t v00 = first + j * stride + i;
+					uint32_t v10 = v00 + 1;
+					uint32_t v01 = v00 + stride;
+					uint32_t v11 = v01 + 1;
+					mesh.m_Indices.push_back(v00);
+					mesh.m_Indices.push_back(v10);
+					mesh.m_Indices.push_back(v11);
+					mesh.m_Indices.push_back(v00);
+					mesh.m_Indices.push_back(v11);
+					mesh.m_Indices.push_back(v01);
+				}
+			}
+		}
+	}
+
+} // namespace gp1::renderer::meshGenerators
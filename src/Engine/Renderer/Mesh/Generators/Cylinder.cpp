@@ -0,0 +1,75 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/Cylinder.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gp1::renderer::meshGenerators
+{
+	void GenerateCylinder(mesh::StaticMesh& mesh, uint32_t segments, float radius, float height, bool caps)
+	{
+		segments = std::max(segments, 3U);
+
+		// The side has a seam column for the uvs, the caps have a center vertex and their own ring for the flat normals.
+		size_t sideVertices = 2ULL * (segments + 1);
+		size_t capVertices  = caps ? 2ULL * (segments + 2) : 0;
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		mesh.m_Vertices.reserve(sideVertices + capVertices);
+		mesh.m_Indices.reserve(6ULL * segments + (caps ? 6ULL * segments : 0));
+
+		const float pi  = 3.14159265358979323846f;
+		float       top = height * 0.5f;
+		for (uint32_t segment = 0; segment <= segments; segment++)
+		{
+			float      u   = static_cast<float>(segment) / segments;
+			float      phi = u * 2.0f * pi;
+			glm::fvec3 normal { std::cos(phi), 0.0f, -std::sin(phi) };
+			mesh.m_Vertices.push_back({ { normal.x * radius, -top, normal.z * radius }, normal, { u, 0.0f } });
+			mesh.m_Vertices.push_back({ { normal.x * radius, top, normal.z * radius }, normal, { u, 1.0f } });
+		}
+		for (uint32_t segment = 0; segment < segments; segment++)
+		{
+			uint32_t bottom0 = segment * 2;
+			uint32_t top0    = bottom0 + 1;
+			uint32_t bottom1 = bottom0 + 2;
+			uint32_t top1    = bottom0 + 3;
+			mesh.m_Indices.push_back(bottom0);
+			mesh.m_Indices.push_back(bottom1);
+			mesh.m_Indices.push_back(top1);
+			mesh.m_Indices.push_back(bottom0);
+			mesh.m_Indices.push_back(top1);
+			mesh.m_Indices.push_back(top0);
+		}
+
+		if (!caps)
+			return;
+
+		for (float side : { 1.0f, -1.0f })
+		{
+			uint32_t   center = static_cast<uint32_t>(mesh.m_Vertices.size());
+			glm::fvec3 normal { 0.0f, side, 0.0f };
+			mesh.m_Vertices.push_back({ { 0.0f, top * side, 0.0f }, normal, { 0.5f, 0.5f } });
+			for (uint32_t segment = 0; segment <= segments; segment++)
+			{
+				float phi = static_cast<float>(segment) / segments * 2.0f * pi;
+				float x   = std::cos(phi);
+				float z   = -std::sin(phi);
+				mesh.m_Vertices.push_back({ { x * radius, top * side, z * radius }, normal, { x * 0.5f + 0.5f, z * 0.5f + 0.5f } });
+			}
+			for (uint32_t segment = 0; segment < segments; segment++)
+			{
+				// The bottom cap is seen from below, so its winding is reversed.
+				uint32_t a = center + 1 + segment;
+				uint32_t b = a + 1;
+				mesh.m_Indices.push_back(center);
+				mesh.m_Indices.push_back(side > 0.0f ? a : b);
+				mesh.m_Indices.push_back(side > 0.0f ? b : a);
+			}
+		}
+	}
+
+} // namespace gp1::renderer::meshGenerators
@@ -4,8 +4,6 @@
 
 #include "Engine/Renderer/Mesh/Generators/Icosphere.h"
 
-#include <array>
-#include <map>
 #include <vector>
 
 namespace gp1::renderer::meshGenerators
@@ -14,140 +12,112 @@ namespace gp1::renderer::meshGenerators
 	const float Z = 0.850650808352039932f;
 	const float N = 0.0f;
 
-	using Lookup = std::map<std::pair<uint32_t, uint32_t>, uint32_t>;
-
-	uint32_t VertexForEdge(Lookup& lookup, mesh::StaticMesh& mesh, uint32_t first, uint32_t second)
+	// The 12 vertices and 20 counter clockwise triangles of an icosahedron.
+	const glm::fvec3 s_IcosahedronVertices[12] = {
+		{ -X, N, Z }, { X, N, Z }, { -X, N, -Z }, { X, N, -Z }, { N, Z, X }, { N, Z, -X }, { N, -Z, X }, { N, -Z, -X }, { Z, X, N }, { -Z, X, N }, { Z, -X, N }, { -Z, -X, N }
+	};
+	const uint32_t s_IcosahedronIndices[60] = {
+		0, 1, 4, 0, 4, 9, 9, 4, 5, 4, 8, 5, 4, 1, 8, 8, 1, 10, 8, 10, 3, 5, 8, 3, 5, 3, 2, 2, 3, 7,
+		7, 3, 10, 7, 10, 6, 7, 6, 11, 11, 6, 0, 0, 6, 1, 6, 10, 1, 9, 11, 0, 9, 2, 11, 9, 5, 2, 7, 11, 2
+	};
+
+	// An open addressing hash table from edges to the vertex at their midpoint.
+	// The table is sized up front for the edges of one subdivision, so inserting never allocates.
+	class EdgeTable
 	{
-		std::pair<uint32_t, uint32_t> key(first, second);
-		if (key.first > key.second)
-			std::swap(key.first, key.second);
-
-		auto inserted = lookup.insert({ key, (uint32_t) mesh.m_Vertices.size() });
-		if (inserted.second)
+	public:
+		// Clear the table and make room for the given number of edges.
+		void Reset(size_t edgeCount)
 		{
-			auto& edge0 = mesh.m_Vertices[first];
-			auto& edge1 = mesh.m_Vertices[second];
-			auto  point = glm::normalize(edge0.position + edge1.position);
-			mesh.m_Vertices.push_back({ point });
+			size_t capacity = 16;
+			while (capacity < edgeCount * 2)
+				capacity <<= 1;
+			this->m_Mask = capacity - 1;
+			this->m_Keys.assign(capacity, s_EmptyKey);
+			this->m_Values.resize(capacity);
 		}
 
-		return inserted.first->second;
-	}
-
-	void subdivide(mesh::StaticMesh& mesh)
-	{
-		Lookup                lookup;
-		std::vector<uint32_t> result;
-
-		for (uint32_t i = 0; i < mesh.m_Indices.size() - 2; i += 3)
+		// Get the vertex at the midpoint of the edge, creating it if it doesn't exist yet.
+		uint32_t VertexForEdge(std::vector<mesh::StaticMeshVertex>& vertices, uint32_t first, uint32_t second)
 		{
-			uint32_t                each[3] = { mesh.m_Indices[i], mesh.m_Indices[i + 1ULL], mesh.m_Indices[i + 2ULL] };
-			std::array<uint32_t, 3> mid;
-			for (uint32_t edge = 0; edge < 3; edge++)
+			uint64_t key  = first < second ? (static_cast<uint64_t>(first) << 32) | second : (static_cast<uint64_t>(second) << 32) | first;
+			size_t   slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & this->m_Mask;
+			while (this->m_Keys[slot] != s_EmptyKey)
 			{
-				mid[edge] = VertexForEdge(lookup, mesh, each[edge], each[(edge + 1) % 3]);
+				if (this->m_Keys[slot] == key)
+					return this->m_Values[slot];
+				slot = (slot + 1) & this->m_Mask;
 			}
 
-			result.push_back(each[0]);
-			result.push_back(mid[0]);
-			result.push_back(mid[2]);
-			result.push_back(each[1]);
-			result.push_back(mid[1]);
-			result.push_back(mid[0]);
-			result.push_back(each[2]);
-			result.push_back(mid[2]);
-			result.push_back(mid[1]);
-			result.push_back(mid[0]);
-			result.push_back(mid[1]);
-			result.push_back(mid[2]);
+			uint32_t   index = static_cast<uint32_t>(vertices.size());
+			glm::fvec3 point = glm::normalize(vertices[first].position + vertices[second].position);
+			vertices.push_back({ point, point });
+
+			this->m_Keys[slot]   = key;
+			this->m_Values[slot] = index;
+			return index;
 		}
 
-		mesh.m_Indices = result;
+	private:
+		static constexpr uint64_t s_EmptyKey = ~0ULL;
+
+		std::vector<uint64_t> m_Keys;     // The edges, s_EmptyKey for empty slots.
+		std::vector<uint32_t> m_Values;   // The midpoint vertex of each edge.
+		size_t                m_Mask = 0; // The capacity minus one.
+	};
+
+	static void Subdivide(EdgeTable& edges, std::vector<mesh::StaticMeshVertex>& vertices, const std::vector<uint32_t>& indices, std::vector<uint32_t>& result)
+	{
+		// Every edge is shared by two triangles.
+		edges.Reset(indices.size() / 2);
+		result.resize(indices.size() * 4);
+
+		uint32_t* out = result.data();
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			uint32_t a  = indices[i];
+			uint32_t b  = indices[i + 1];
+			uint32_t c  = indices[i + 2];
+			uint32_t ab = edges.VertexForEdge(vertices, a, b);
+			uint32_t bc = edges.VertexForEdge(vertices, b, c);
+			uint32_t ca = edges.VertexForEdge(vertices, c, a);
+
+			*out++ = a;
+			*out++ = ab;
+			*out++ = ca;
+			*out++ = b;
+			*out++ = bc;
+			*out++ = ab;
+			*out++ = c;
+			*out++ = ca;
+			*out++ = bc;
+			*out++ = ab;
+			*out++ = bc;
+			*out++ = ca;
+		}
 	}
 
 	void GenerateIcosphere(mesh::StaticMesh& mesh, uint32_t subdivisions)
 	{
+		// Every subdivision quadruples the triangles, a sphere with F triangles has F / 2 + 2 vertices.
+		size_t triangleCount = 20ULL << (2 * subdivisions);
+
 		mesh.m_Vertices.clear();
 		mesh.m_Indices.clear();
+		mesh.m_Vertices.reserve(triangleCount / 2 + 2);
+		mesh.m_Indices.reserve(triangleCount * 3);
 
-		// Start with precoded mesh.
-		mesh.m_Vertices.push_back({ { -X, N, Z } });
-		mesh.m_Vertices.push_back({ { X, N, Z } });
-		mesh.m_Vertices.push_back({ { -X, N, -Z } });
-		mesh.m_Vertices.push_back({ { X, N, -Z } });
-		mesh.m_Vertices.push_back({ { N, Z, X } });
-		mesh.m_Vertices.push_back({ { N, Z, -X } });
-		mesh.m_Vertices.push_back({ { N, -Z, X } });
-		mesh.m_Vertices.push_back({ { N, -Z, -X } });
-		mesh.m_Vertices.push_back({ { Z, X, N } });
-		mesh.m_Vertices.push_back({ { -Z, X, N } });
-		mesh.m_Vertices.push_back({ { Z, -X, N } });
-		mesh.m_Vertices.push_back({ { -Z, -X, N } });
-
-		mesh.m_Indices.push_back(0);
-		mesh.m_Indices.push_back(4);
-		mesh.m_Indices.push_back(1);
-		mesh.m_Indices.push_back(0);
-		mesh.m_Indices.push_back(9);
-		mesh.m_Indices.push_back(4);
-		mesh.m_Indices.push_back(9);
-		mesh.m_Indices.push_back(5);
-		mesh.m_Indices.push_back(4);
-		mesh.m_Indices.push_back(4);
-		mesh.m_Indices.push_back(5);
-		mesh.m_Indices.push_back(8);
-		mesh.m_Indices.push_back(4);
-		mesh.m_Indices.push_back(8);
-		mesh.m_Indices.push_back(1);
-		mesh.m_Indices.push_back(8);
-		mesh.m_Indices.push_back(10);
-		mesh.m_Indices.push_back(1);
-		mesh.m_Indices.push_back(8);
-		mesh.m_Indices.push_back(3);
-		mesh.m_Indices.push_back(10);
-		mesh.m_Indices.push_back(5);
-		mesh.m_Indices.push_back(3);
-		mesh.m_Indices.push_back(8);
-		mesh.m_Indices.push_back(5);
-		mesh.m_Indices.push_back(2);
-		mesh.m_Indices.push_back(3);
-		mesh.m_Indices.push_back(2);
-		mesh.m_Indices.push_back(7);
-		mesh.m_Indices.push_back(3);
-		mesh.m_Indices.push_back(7);
-		mesh.m_Indices.push_back(10);
-		mesh.m_Indices.push_back(3);
-		mesh.m_Indices.push_back(7);
-		mesh.m_Indices.push_back(6);
-		mesh.m_Indices.push_back(10);
-		mesh.m_Indices.push_back(7);
-		mesh.m_Indices.push_back(11);
-		mesh.m_Indices.push_back(6);
-		mesh.m_Indices.push_back(11);
-		mesh.m_Indices.push_back(0);
-		mesh.m_Indices.push_back(6);
-		mesh.m_Indices.push_back(0);
-		mesh.m_Indices.push_back(1);
-		mesh.m_Indices.push_back(6);
-		mesh.m_Indices.push_back(6);
-		mesh.m_Indices.push_back(1);
-		mesh.m_Indices.push_back(10);
-		mesh.m_Indices.push_back(9);
-		mesh.m_Indices.push_back(0);
-		mesh.m_Indices.push_back(11);
-		mesh.m_Indices.push_back(9);
-		mesh.m_Indices.push_back(11);
-		mesh.m_Indices.push_back(2);
-		mesh.m_Indices.push_back(9);
-		mesh.m_Indices.push_back(2);
-		mesh.m_Indices.push_back(5);
-		mesh.m_Indices.push_back(7);
-		mesh.m_Indices.push_back(2);
-		mesh.m_Indices.push_back(11);
+		for (const glm::fvec3& vertex : s_IcosahedronVertices)
+			mesh.m_Vertices.push_back({ vertex, vertex });
+		mesh.m_Indices.assign(s_IcosahedronIndices, s_IcosahedronIndices + 60);
 
+		EdgeTable             edges;
+		std::vector<uint32_t> result;
+		result.reserve(triangleCount * 3);
 		for (uint32_t i = 0; i < subdivisions; i++)
 		{
-			subdivide(mesh);
+			Subdivide(edges, mesh.m_Vertices, mesh.m_Indices, result);
+			mesh.m_Indices.swap(result);
 		}
 	}
 
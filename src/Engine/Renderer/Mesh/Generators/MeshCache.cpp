@@ -0,0 +1,89 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/MeshCache.h"
+#include "Engine/Renderer/Mesh/Generators/Box.h"
+#include "Engine/Renderer/Mesh/Generators/CubeSphere.h"
+#include "Engine/Renderer/Mesh/Generators/Cylinder.h"
+#include "Engine/Renderer/Mesh/Generators/Icosphere.h"
+#include "Engine/Renderer/Mesh/Generators/PlaneGrid.h"
+#include "Engine/Renderer/Mesh/Generators/UVSphere.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace gp1::renderer::meshGenerators
+{
+	enum class GeneratorType : uint32_t
+	{
+		ICOSPHERE,
+		UV_SPHERE,
+		CUBE_SPHERE,
+		PLANE_GRID,
+		BOX,
+		CYLINDER
+	};
+
+	// The generator and its parameters, unused parameters are 0.
+	using MeshCacheKey = std::tuple<GeneratorType, uint32_t, uint32_t, float, float, float>;
+
+	static std::map<MeshCacheKey, mesh::StaticMesh*> s_MeshCache;
+	static std::mutex                                s_MeshCacheMutex;
+
+	// Get the cached mesh with the given key, generating it on first use.
+	template <typename Generate>
+	static mesh::StaticMesh* GetCachedMesh(const MeshCacheKey& key, Generate generate)
+	{
+		std::lock_guard<std::mutex> lock(s_MeshCacheMutex);
+
+		auto itr = s_MeshCache.find(key);
+		if (itr != s_MeshCache.end())
+			return itr->second;
+
+		mesh::StaticMesh* mesh = new mesh::StaticMesh();
+		generate(*mesh);
+		s_MeshCache.insert({ key, mesh });
+		return mesh;
+	}
+
+	mesh::StaticMesh* GetIcosphere(uint32_t subdivisions)
+	{
+		return GetCachedMesh({ GeneratorType::ICOSPHERE, subdivisions, 0, 0.0f, 0.0f, 0.0f }, [=](mesh::StaticMesh& mesh) { GenerateIcosphere(mesh, subdivisions); });
+	}
+
+	mesh::StaticMesh* GetUVSphere(uint32_t segments, uint32_t rings)
+	{
+		return GetCachedMesh({ GeneratorType::UV_SPHERE, segments, rings, 0.0f, 0.0f, 0.0f }, [=](mesh::StaticMesh& mesh) { GenerateUVSphere(mesh, segments, rings); });
+	}
+
+	mesh::StaticMesh* GetCubeSphere(uint32_t resolution)
+	{
+		return GetCachedMesh({ GeneratorType::CUBE_SPHERE, resolution, 0, 0.0f, 0.0f, 0.0f }, [=](mesh::StaticMesh& mesh) { GenerateCubeSphere(mesh, resolution); });
+	}
+
+	mesh::StaticMesh* GetPlaneGrid(const glm::fvec2& size, uint32_t columns, uint32_t rows)
+	{
+		return GetCachedMesh({ GeneratorType::PLANE_GRID, columns, rows, size.x, size.y, 0.0f }, [=](mesh::StaticMesh& mesh) { GeneratePlaneGrid(mesh, size, columns, rows); });
+	}
+
+	mesh::StaticMesh* GetBox(const glm::fvec3& halfExtents)
+	{
+		return GetCachedMesh({ GeneratorType::BOX, 0, 0, halfExtents.x, halfExtents.y, halfExtents.z }, [=](mesh::StaticMesh& mesh) { GenerateBox(mesh, halfExtents); });
+	}
+
+	mesh::StaticMesh* GetCylinder(uint32_t segments, float radius, float height, bool caps)
+	{
+		return GetCachedMesh({ GeneratorType::CYLINDER, segments, caps ? 1U : 0U, radius, height, 0.0f }, [=](mesh::StaticMesh& mesh) { GenerateCylinder(mesh, segments, radius, height, caps); });
+	}
+
+	void ClearMeshCache()
+	{
+		std::lock_guard<std::mutex> lock(s_MeshCacheMutex);
+		for (auto& entry : s_MeshCache)
+			delete entry.second;
+		s_MeshCache.clear();
+	}
+
+} // namespace gp1::renderer::meshGenerators
@@ -0,0 +1,49 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/PlaneGrid.h"
+
+#include <algorithm>
+
+namespace gp1::renderer::meshGenerators
+{
+	void GeneratePlaneGrid(mesh::StaticMesh& mesh, const glm::fvec2& size, uint32_t columns, uint32_t rows)
+	{
+		columns = std::max(columns, 1U);
+		rows    = std::max(rows, 1U);
+
+		uint32_t stride = columns + 1;
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		mesh.m_Vertices.reserve(static_cast<size_t>(stride) * (rows + 1));
+		mesh.m_Indices.reserve(6ULL * columns * rows);
+
+		for (uint32_t j = 0; j <= rows; j++)
+		{
+			for (uint32_t i = 0; i <= columns; i++)
+			{
+				glm::fvec2 uv { static_cast<float>(i) / columns, static_cast<float>(j) / rows };
+				mesh.m_Vertices.push_back({ { (uv.x - 0.5f) * size.x, 0.0f, (0.5f - uv.y) * size.y }, { 0.0f, 1.0f, 0.0f }, uv });
+			}
+		}
+
+		for (uint32_t j = 0; j < rows; j++)
+		{
+			for (uint32_t i = 0; i < columns; i++)
+			{
+				uint32_t v00 = j * stride + i;
+				uint32_t v10 = v00 + 1;
+				uint32_t v01 = v00 + stride;
+				uint32_t v11 = v01 + 1;
+				mesh.m_Indices.push_back(v00);
+				mesh.m_Indices.push_back(v10);
+				mesh.m_Indices.push_back(v11);
+				mesh.m_Indices.push_back(v00);
+				mesh.m_Indices.push_back(v11);
+				mesh.m_Indices.push_back(v01);
+			}
+		}
+	}
+
+} // namespace gp1::renderer::meshGenerators
@@ -0,0 +1,64 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Generators/UVSphere.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gp1::renderer::meshGenerators
+{
+	void GenerateUVSphere(mesh::StaticMesh& mesh, uint32_t segments, uint32_t rings)
+	{
+		segments = std::max(segments, 3U);
+		rings    = std::max(rings, 2U);
+
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		// The seam and the poles get their own vertices so the uvs don't wrap, the pole rows only have one triangle per quad.
+		mesh.m_Vertices.reserve(static_cast<size_t>(segments + 1) * (rings + 1));
+		mesh.m_Indices.reserve(static_cast<size_t>(segments) * (rings - 1) * 6);
+
+		const float pi = 3.14159265358979323846f;
+		for (uint32_t ring = 0; ring <= rings; ring++)
+		{
+			float v     = static_cast<float>(ring) / rings;
+			float theta = v * pi;
+			float y     = std::cos(theta);
+			float r     = std::sin(theta);
+			for (uint32_t segment = 0; segment <= segments; segment++)
+			{
+				float      u   = static_cast<float>(segment) / segments;
+				float      phi = u * 2.0f * pi;
+				glm::fvec3 position { r * std::cos(phi), y, -r * std::sin(phi) };
+				mesh.m_Vertices.push_back({ position, position, { u, 1.0f - v } });
+			}
+		}
+
+		uint32_t stride = segments + 1;
+		for (uint32_t ring = 0; ring < rings; ring++)
+		{
+			for (uint32_t segment = 0; segment < segments; segment++)
+			{
+				uint32_t v00 = ring * stride + segment;
+				uint32_t v01 = v00 + 1;
+				uint32_t v10 = v00 + stride;
+				uint32_t v11 = v10 + 1;
+				if (ring != 0)
+				{
+					mesh.m_Indices.push_back(v00);
+					mesh.m_Indices.push_back(v10);
+					mesh.m_Indices.push_back(v01);
+				}
+				if (ring != rings - 1)
+				{
+					mesh.m_Indices.push_back(v01);
+					mesh.m_Indices.push_back(v10);
+					mesh.m_Indices.push_back(v11);
+				}
+			}
+		}
+	}
+
+} // namespace gp1::renderer::meshGenerators
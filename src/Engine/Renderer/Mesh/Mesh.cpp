@@ -4,16 +4,117 @@
 
 #include "Engine/Renderer/Mesh/Mesh.h"
 
+#include <algorithm>
+
 namespace gp1::renderer::mesh
 {
+	void DirtyRange::Expand(uint32_t first, uint32_t count)
+	{
+		if (count == 0)
+			return;
+
+		if (IsEmpty())
+		{
+			this->m_Begin = first;
+			this->m_End   = first + count;
+		}
+		else
+		{
+			this->m_Begin = first < this->m_Begin ? first : this->m_Begin;
+			this->m_End   = first + count > this->m_End ? first + count : this->m_End;
+		}
+	}
+
+	void DirtyRange::Clear()
+	{
+		this->m_Begin = 0;
+		this->m_End   = 0;
+	}
+
+	bool DirtyRange::IsEmpty() const
+	{
+		return this->m_End <= this->m_Begin;
+	}
+
+	void DirtyRanges::Expand(uint32_t first, uint32_t count)
+	{
+		if (count == 0)
+			return;
+
+		// Skip the ranges ending before the new one, then absorb the ranges it overlaps or touches.
+		DirtyRange range { first, first + count };
+		size_t     begin = 0;
+		while (begin < this->m_Ranges.size() && this->m_Ranges[begin].m_End < range.m_Begin)
+			begin++;
+		size_t end = begin;
+		while (end < this->m_Ranges.size() && this->m_Ranges[end].m_Begin <= range.m_End)
+		{
+			range.m_Begin = std::min(range.m_Begin, this->m_Ranges[end].m_Begin);
+			range.m_End   = std::max(range.m_End, this->m_Ranges[end].m_End);
+			end++;
+		}
+		this->m_Ranges.erase(this->m_Ranges.begin() + begin, this->m_Ranges.begin() + end);
+		this->m_Ranges.insert(this->m_Ranges.begin() + begin, range);
+
+		if (this->m_Ranges.size() <= s_MaxRanges)
+			return;
+
+		// Merge the two ranges with the smallest gap, as that uploads the fewest clean elements.
+		size_t closest = 0;
+		for (size_t i = 1; i + 1 < this->m_Ranges.size(); i++)
+			if (this->m_Ranges[i + 1].m_Begin - this->m_Ranges[i].m_End < this->m_Ranges[closest + 1].m_Begin - this->m_Ranges[closest].m_End)
+				closest = i;
+		this->m_Ranges[closest].m_End = this->m_Ranges[closest + 1].m_End;
+		this->m_Ranges.erase(this->m_Ranges.begin() + closest + 1);
+	}
+
+	void DirtyRanges::Clear()
+	{
+		this->m_Ranges.clear();
+	}
+
+	bool DirtyRanges::IsEmpty() const
+	{
+		return this->m_Ranges.empty();
+	}
+
+	const std::vector<DirtyRange>& DirtyRanges::GetRanges() const
+	{
+		return this->m_Ranges;
+	}
+
 	void Mesh::MarkDirty()
 	{
 		this->m_Dirty = this->m_Editable;
 	}
 
+	void Mesh::MarkVerticesDirty(uint32_t first, uint32_t count)
+	{
+		if (!this->m_Editable)
+			return;
+
+		if (this->m_IsDynamic)
+			this->m_DirtyVertices.Expand(first, count);
+		else
+			MarkDirty();
+	}
+
+	void Mesh::MarkIndicesDirty(uint32_t first, uint32_t count)
+	{
+		if (!this->m_Editable)
+			return;
+
+		if (this->m_IsDynamic)
+			this->m_DirtyIndices.Expand(first, count);
+		else
+			MarkDirty();
+	}
+
 	void Mesh::ClearDirty()
 	{
 		this->m_Dirty = false;
+		this->m_DirtyVertices.Clear();
+		this->m_DirtyIndices.Clear();
 	}
 
 	bool Mesh::IsDirty()
@@ -21,6 +122,21 @@ namespace gp1::renderer::mesh
 		return this->m_Dirty;
 	}
 
+	bool Mesh::HasDirtyRanges()
+	{
+		return !this->m_DirtyVertices.IsEmpty() || !this->m_DirtyIndices.IsEmpty();
+	}
+
+	const DirtyRanges& Mesh::GetDirtyVertices() const
+	{
+		return this->m_DirtyVertices;
+	}
+
+	const DirtyRanges& Mesh::GetDirtyIndices() const
+	{
+		return this->m_DirtyIndices;
+	}
+
 	bool Mesh::IsEditable()
 	{
 		return this->m_Editable;
@@ -31,4 +147,13 @@ namespace gp1::renderer::mesh
 		return this->m_IsDynamic;
 	}
 
+	void Mesh::SetDynamic(bool dynamic)
+	{
+		this->m_IsDynamic = dynamic;
+	}
+
+	void Mesh::RecalculateBounds() {}
+
+	void Mesh::ExpandBounds(uint32_t /*begin*/, uint32_t /*end*/) {}
+
 } // namespace gp1::renderer::mesh
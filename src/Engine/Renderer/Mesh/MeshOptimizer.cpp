@@ -0,0 +1,538 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/MeshOptimizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string_view>
+#include <unordered_map>
+
+namespace gp1::renderer::meshOptimizer
+{
+	constexpr uint32_t s_CacheSize = 32; // The cache size Forsyth's scoring assumes.
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	static double MillisecondsSince(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	constexpr uint32_t s_MaxValence = 64; // The number of live triangles the valence score is tabulated for.
+
+	struct ScoreTables
+	{
+	public:
+		ScoreTables()
+		{
+			for (uint32_t i = 0; i < s_CacheSize; i++)
+			{
+				// The vertices of the last triangle get a fixed score so the next triangle doesn't just reuse them.
+				if (i < 3)
+					m_CacheScores[i] = 0.75f;
+				else
+					m_CacheScores[i] = std::pow(1.0f - static_cast<float>(i - 3) / (s_CacheSize - 3), 1.5f);
+			}
+			// Vertices with few triangles left are preferred, so they can leave the cache sooner.
+			m_ValenceScores[0] = 0.0f;
+			for (uint32_t i = 1; i < s_MaxValence; i++)
+				m_ValenceScores[i] = 2.0f / std::sqrt(static_cast<float>(i));
+		}
+
+	public:
+		float m_CacheScores[s_CacheSize];    // The score of every cache position.
+		float m_ValenceScores[s_MaxValence]; // The score of every number of live triangles.
+	};
+
+	static float VertexScore(int32_t cachePosition, uint32_t liveTriangles)
+	{
+		static const ScoreTables s_Tables;
+
+		if (liveTriangles == 0)
+			return -1.0f;
+
+		float score = cachePosition >= 0 ? s_Tables.m_CacheScores[cachePosition] : 0.0f;
+		score += liveTriangles < s_MaxValence ? s_Tables.m_ValenceScores[liveTriangles] : 2.0f / std::sqrt(static_cast<float>(liveTriangles));
+		return score;
+	}
+
+	uint32_t WeldVertices(std::vector<uint32_t>& remap, const void* vertices, size_t vertexCount, size_t vertexSize)
+	{
+		const char* bytes = reinterpret_cast<const char*>(vertices);
+
+		std::unordered_map<std::string_view, uint32_t> unique;
+		unique.reserve(vertexCount);
+		remap.resize(vertexCount);
+
+		uint32_t uniqueCount = 0;
+		for (size_t i = 0; i < vertexCount; i++)
+		{
+			auto inserted = unique.insert({ std::string_view(bytes + i * vertexSize, vertexSize), uniqueCount });
+			if (inserted.second)
+				uniqueCount++;
+			remap[i] = inserted.first->second;
+		}
+		return uniqueCount;
+	}
+
+	void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount)
+	{
+		size_t triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		// Build the list of triangles using each vertex.
+		std::vector<uint32_t> liveTriangles(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			liveTriangles[indices[i]]++;
+
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (size_t i = 0; i < vertexCount; i++)
+			adjacencyOffsets[i + 1] = adjacencyOffsets[i] + liveTriangles[i];
+
+		std::vector<uint32_t> adjacency(triangleCount * 3);
+		std::vector<uint32_t> adjacencyCounts(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			for (size_t j = 0; j < 3; j++)
+			{
+				uint32_t vertex                                                   = indices[i * 3 + j];
+				adjacency[adjacencyOffsets[vertex] + adjacencyCounts[vertex]++] = static_cast<uint32_t>(i);
+			}
+		}
+
+		std::vector<int32_t> cachePositions(vertexCount, -1);
+		std::vector<float>   vertexScores(vertexCount);
+		for (size_t i = 0; i < vertexCount; i++)
+			vertexScores[i] = VertexScore(-1, liveTriangles[i]);
+
+		std::vector<float> triangleScores(triangleCount);
+		std::vector<bool>  emitted(triangleCount, false);
+		int64_t            bestTriangle = -1;
+		float              bestScore    = -1.0f;
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			triangleScores[i] = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+			if (triangleScores[i] > bestScore)
+			{
+				bestScore    = triangleScores[i];
+				bestTriangle = static_cast<int64_t>(i);
+			}
+		}
+
+		std::vector<uint32_t> output(triangleCount * 3);
+		uint32_t              cache[s_CacheSize + 3];
+		uint32_t              newCache[s_CacheSize + 3];
+		uint32_t              cacheCount = 0;
+		size_t                cursor     = 0;
+
+		for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++)
+		{
+			if (bestTriangle < 0)
+			{
+				// Dead end, none of the cached vertices have triangles left, so continue with the next unemitted triangle.
+				while (emitted[cursor])
+					cursor++;
+				bestTriangle = static_cast<int64_t>(cursor);
+			}
+
+			size_t          triangle = static_cast<size_t>(bestTriangle);
+			const uint32_t* tri      = indices + triangle * 3;
+			output[emittedCount * 3]     = tri[0];
+			output[emittedCount * 3 + 1] = tri[1];
+			output[emittedCount * 3 + 2] = tri[2];
+			emitted[triangle]            = true;
+
+			// Remove the triangle from its vertices' live triangles.
+			for (size_t j = 0; j < 3; j++)
+			{
+				uint32_t  vertex = tri[j];
+				uint32_t* begin  = adjacency.data() + adjacencyOffsets[vertex];
+				uint32_t* end    = begin + liveTriangles[vertex];
+				uint32_t* found  = std::find(begin, end, static_cast<uint32_t>(triangle));
+				if (found != end)
+				{
+					*found = *(end - 1);
+					liveTriangles[vertex]--;
+				}
+			}
+
+			// Push the triangle's vertices to the front of the cache, the vertices pushed past the end fall out.
+			uint32_t newCacheCount = 0;
+			for (size_t j = 0; j < 3; j++)
+				newCache[newCacheCount++] = tri[j];
+			for (uint32_t j = 0; j < cacheCount; j++)
+			{
+				uint32_t vertex = cache[j];
+				if (vertex != tri[0] && vertex != tri[1] && vertex != tri[2])
+					newCache[newCacheCount++] = vertex;
+			}
+
+			for (uint32_t j = 0; j < newCacheCount; j++)
+			{
+				uint32_t vertex        = newCache[j];
+				cachePositions[vertex] = j < s_CacheSize ? static_cast<int32_t>(j) : -1;
+				vertexScores[vertex]   = VertexScore(cachePositions[vertex], liveTriangles[vertex]);
+			}
+
+			// Only the triangles of vertices whose score changed have to be rescored.
+			bestTriangle = -1;
+			bestScore    = -1.0f;
+			for (uint32_t j = 0; j < newCacheCount; j++)
+			{
+				uint32_t vertex = newCache[j];
+				for (uint32_t k = 0; k < liveTriangles[vertex]; k++)
+				{
+					uint32_t        adjacent    = adjacency[adjacencyOffsets[vertex] + k];
+					const uint32_t* adjacentTri = indices + static_cast<size_t>(adjacent) * 3;
+					float           score       = vertexScores[adjacentTri[0]] + vertexScores[adjacentTri[1]] + vertexScores[adjacentTri[2]];
+					triangleScores[adjacent]    = score;
+					if (score > bestScore)
+					{
+						bestScore    = score;
+						bestTriangle = adjacent;
+					}
+				}
+			}
+
+			cacheCount = newCacheCount < s_CacheSize ? newCacheCount : s_CacheSize;
+			std::copy(newCache, newCache + cacheCount, cache);
+		}
+
+		std::copy(output.begin(), output.end(), indices);
+	}
+
+	// Count the cache misses of a triangle in a simulated fifo cache, timestamps hold when each vertex was last transformed.
+	static uint32_t SimulateTriangle(const uint32_t* triangle, std::vector<uint32_t>& timestamps, uint32_t& time, uint32_t cacheSize)
+	{
+		uint32_t misses = 0;
+		for (size_t j = 0; j < 3; j++)
+		{
+			uint32_t vertex = triangle[j];
+			if (time - timestamps[vertex] > cacheSize)
+			{
+				timestamps[vertex] = time++;
+				misses++;
+			}
+		}
+		return misses;
+	}
+
+	void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const void* vertices, size_t vertexCount, size_t vertexStride, float threshold)
+	{
+		size_t triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		const uint8_t* vertexBytes = reinterpret_cast<const uint8_t*>(vertices);
+		auto           position    = [&](uint32_t vertex) -> const glm::fvec3& {
+			return *reinterpret_cast<const glm::fvec3*>(vertexBytes + vertex * vertexStride);
+		};
+
+		// Hard boundaries are where the cache restarts, i.e. a triangle that shares no vertex with the cache.
+		constexpr uint32_t    cacheSize = 16;
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		uint32_t              time = cacheSize + 1;
+		std::vector<size_t>   hardBoundaries;
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			if (SimulateTriangle(indices + i * 3, timestamps, time, cacheSize) == 3)
+				hardBoundaries.push_back(i);
+		}
+		hardBoundaries.push_back(triangleCount);
+
+		// Split the hard clusters further wherever the partial cluster is about as cache friendly as the whole cluster.
+		std::vector<size_t> clusters;
+		for (size_t c = 0; c + 1 < hardBoundaries.size(); c++)
+		{
+			size_t start = hardBoundaries[c];
+			size_t end   = hardBoundaries[c + 1];
+
+			time += cacheSize + 1;
+			uint32_t clusterMisses = 0;
+			for (size_t i = start; i < end; i++)
+				clusterMisses += SimulateTriangle(indices + i * 3, timestamps, time, cacheSize);
+			float clusterACMR = static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+			time += cacheSize + 1;
+			clusters.push_back(start);
+			size_t   softStart = start;
+			uint32_t misses    = 0;
+			for (size_t i = start; i < end; i++)
+			{
+				misses += SimulateTriangle(indices + i * 3, timestamps, time, cacheSize);
+				float partialACMR = static_cast<float>(misses) / static_cast<float>(i + 1 - softStart);
+				if (i + 1 < end && partialACMR <= clusterACMR * threshold)
+				{
+					clusters.push_back(i + 1);
+					softStart = i + 1;
+					misses    = 0;
+					time += cacheSize + 1;
+				}
+			}
+		}
+		clusters.push_back(triangleCount);
+
+		// Outwards facing clusters far from the center are the most likely to occlude the rest, so they are drawn first.
+		size_t                  clusterCount = clusters.size() - 1;
+		std::vector<glm::fvec3> centroids(clusterCount, glm::fvec3(0.0f));
+		std::vector<glm::fvec3> normals(clusterCount, glm::fvec3(0.0f));
+		glm::fvec3              meshCentroid(0.0f);
+		float                   meshArea = 0.0f;
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			float area = 0.0f;
+			for (size_t i = clusters[c]; i < clusters[c + 1]; i++)
+			{
+				const glm::fvec3& p0 = position(indices[i * 3]);
+				const glm::fvec3& p1 = position(indices[i * 3 + 1]);
+				const glm::fvec3& p2 = position(indices[i * 3 + 2]);
+
+				glm::fvec3 normal       = glm::cross(p1 - p0, p2 - p0);
+				float      triangleArea = std::sqrt(glm::dot(normal, normal));
+				centroids[c] += (p0 + p1 + p2) * (triangleArea / 3.0f);
+				normals[c] += normal;
+				area += triangleArea;
+			}
+			meshCentroid += centroids[c];
+			meshArea += area;
+			centroids[c] = area > 0.0f ? centroids[c] / area : position(indices[clusters[c] * 3]);
+		}
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		std::vector<float>  sortKeys(clusterCount);
+		std::vector<size_t> order(clusterCount);
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			float length = std::sqrt(glm::dot(normals[c], normals[c]));
+			sortKeys[c]  = length > 0.0f ? glm::dot(centroids[c] - meshCentroid, normals[c] / length) : 0.0f;
+			order[c]     = c;
+		}
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<uint32_t> output;
+		output.reserve(triangleCount * 3);
+		for (size_t c : order)
+			output.insert(output.end(), indices + clusters[c] * 3, indices + clusters[c + 1] * 3);
+		std::copy(output.begin(), output.end(), indices);
+	}
+
+	uint32_t OptimizeVertexFetchRemap(std::vector<uint32_t>& remap, const uint32_t* indices, size_t indexCount, size_t vertexCount)
+	{
+		remap.assign(vertexCount, ~0U);
+
+		uint32_t nextVertex = 0;
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			uint32_t& newIndex = remap[indices[i]];
+			if (newIndex == ~0U)
+				newIndex = nextVertex++;
+		}
+		return nextVertex;
+	}
+
+	VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+	{
+		VertexCacheStats stats;
+		size_t           triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return stats;
+
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		std::vector<bool>     referenced(vertexCount, false);
+		uint32_t              time            = cacheSize + 1;
+		uint32_t              referencedCount = 0;
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			stats.m_TransformedVertices += SimulateTriangle(indices + i * 3, timestamps, time, cacheSize);
+			for (size_t j = 0; j < 3; j++)
+			{
+				if (!referenced[indices[i * 3 + j]])
+				{
+					referenced[indices[i * 3 + j]] = true;
+					referencedCount++;
+				}
+			}
+		}
+
+		stats.m_ACMR = static_cast<float>(stats.m_TransformedVertices) / static_cast<float>(triangleCount);
+		stats.m_ATVR = referencedCount > 0 ? static_cast<float>(stats.m_TransformedVertices) / static_cast<float>(referencedCount) : 0.0f;
+		return stats;
+	}
+
+	template <typename Vertex>
+	static OptimizeStats OptimizeMeshData(mesh::Mesh& mesh, std::vector<Vertex>& vertices)
+	{
+		OptimizeStats stats;
+		if (mesh.m_RenderMode != mesh::RenderMode::TRIANGLES || vertices.empty())
+			return stats;
+
+		std::vector<uint32_t>& indices = mesh.m_Indices;
+		if (indices.empty())
+		{
+			indices.resize(vertices.size());
+			for (size_t i = 0; i < indices.size(); i++)
+				indices[i] = static_cast<uint32_t>(i);
+		}
+		indices.resize(indices.size() / 3 * 3);
+
+		stats.m_VerticesBefore = static_cast<uint32_t>(vertices.size());
+		stats.m_Before         = AnalyzeVertexCache(indices.data(), indices.size(), vertices.size());
+
+		// Weld the vertices, welding compares bytes so the vertex types must not have padding.
+		auto                  start = Clock::now();
+		std::vector<uint32_t> remap;
+		uint32_t              uniqueCount = WeldVertices(remap, vertices.data(), vertices.size(), sizeof(Vertex));
+		if (uniqueCount < vertices.size())
+		{
+			std::vector<Vertex> welded(uniqueCount);
+			for (size_t i = 0; i < vertices.size(); i++)
+				welded[remap[i]] = vertices[i];
+			vertices.swap(welded);
+			for (uint32_t& index : indices)
+				index = remap[index];
+		}
+		stats.m_WeldTime = MillisecondsSince(start);
+
+		start = Clock::now();
+		OptimizeVertexCache(indices.data(), indices.size(), vertices.size());
+		stats.m_CacheTime = MillisecondsSince(start);
+
+		start = Clock::now();
+		OptimizeOverdraw(indices.data(), indices.size(), vertices.data(), vertices.size(), sizeof(Vertex));
+		stats.m_OverdrawTime = MillisecondsSince(start);
+
+		start                  = Clock::now();
+		uint32_t referenced    = OptimizeVertexFetchRemap(remap, indices.data(), indices.size(), vertices.size());
+		std::vector<Vertex> fetchOrdered(referenced);
+		for (size_t i = 0; i < vertices.size(); i++)
+			if (remap[i] != ~0U)
+				fetchOrdered[remap[i]] = vertices[i];
+		vertices.swap(fetchOrdered);
+		for (uint32_t& index : indices)
+			index = remap[index];
+		stats.m_FetchTime = MillisecondsSince(start);
+
+		stats.m_VerticesAfter = static_cast<uint32_t>(vertices.size());
+		stats.m_After         = AnalyzeVertexCache(indices.data(), indices.size(), vertices.size());
+
+		// The old meshlets reference the old triangle order.
+		mesh.m_Meshlets.clear();
+		mesh.MarkDirty();
+		return stats;
+	}
+
+	OptimizeStats OptimizeMesh(mesh::StaticMesh& mesh)
+	{
+		return OptimizeMeshData(mesh, mesh.m_Vertices);
+	}
+
+	OptimizeStats OptimizeMesh(mesh::SkeletalMesh& mesh)
+	{
+		return OptimizeMeshData(mesh, mesh.m_Vertices);
+	}
+
+	// Calculate the bounding sphere and normal cone of the triangles in the meshlet.
+	static void CalculateMeshletBounds(mesh::Meshlet& meshlet, const std::vector<mesh::StaticMeshVertex>& vertices, const uint32_t* indices)
+	{
+		glm::fvec3 min = vertices[indices[0]].position;
+		glm::fvec3 max = min;
+		for (uint32_t i = 1; i < meshlet.m_IndexCount; i++)
+		{
+			const glm::fvec3& position = vertices[indices[i]].position;
+			min                        = glm::min(min, position);
+			max                        = glm::max(max, position);
+		}
+		glm::fvec3 center = (min + max) * 0.5f;
+		float      radius = 0.0f;
+		for (uint32_t i = 0; i < meshlet.m_IndexCount; i++)
+		{
+			glm::fvec3 offset = vertices[indices[i]].position - center;
+			radius            = std::max(radius, glm::dot(offset, offset));
+		}
+		meshlet.m_BoundingSphere = { center, std::sqrt(radius) };
+
+		// The cone axis is the average triangle normal, degenerate triangles don't contribute.
+		std::vector<glm::fvec3> normals;
+		normals.reserve(meshlet.m_IndexCount / 3);
+		glm::fvec3 axis { 0.0f, 0.0f, 0.0f };
+		for (uint32_t i = 0; i + 2 < meshlet.m_IndexCount; i += 3)
+		{
+			const glm::fvec3& a      = vertices[indices[i]].position;
+			glm::fvec3        normal = glm::cross(vertices[indices[i + 1]].position - a, vertices[indices[i + 2]].position - a);
+			float             length = std::sqrt(glm::dot(normal, normal));
+			if (length <= 0.0f)
+				continue;
+			normal /= length;
+			normals.push_back(normal);
+			axis += normal;
+		}
+
+		meshlet.m_ConeAxis   = { 0.0f, 0.0f, 1.0f };
+		meshlet.m_ConeCutoff = 1.0f;
+		float axisLength     = std::sqrt(glm::dot(axis, axis));
+		if (normals.empty() || axisLength <= 0.0f)
+			return;
+		axis /= axisLength;
+
+		float minDot = 1.0f;
+		for (const glm::fvec3& normal : normals)
+			minDot = std::min(minDot, glm::dot(axis, normal));
+
+		// Cones wider than ~84 degrees almost never get culled, so they're left at a cutoff of 1.
+		meshlet.m_ConeAxis = axis;
+		if (minDot > 0.1f)
+			meshlet.m_ConeCutoff = std::sqrt(1.0f - minDot * minDot);
+	}
+
+	void BuildMeshlets(mesh::StaticMesh& mesh, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		mesh.m_Meshlets.clear();
+		if (mesh.m_RenderMode != mesh::RenderMode::TRIANGLES || mesh.m_Vertices.empty() || mesh.m_Indices.size() < 3 || maxVertices < 3 || maxTriangles < 1)
+			return;
+
+		const std::vector<uint32_t>& indices    = mesh.m_Indices;
+		size_t                       indexCount = indices.size() / 3 * 3;
+
+		// The meshlet a vertex was last counted in, so unique vertices can be counted without clearing a set per meshlet.
+		std::vector<uint32_t> vertexMeshlet(mesh.m_Vertices.size(), ~0U);
+
+		mesh::Meshlet meshlet;
+		for (size_t i = 0; i < indexCount; i += 3)
+		{
+			uint32_t meshletIndex = static_cast<uint32_t>(mesh.m_Meshlets.size());
+			uint32_t newVertices  = 0;
+			for (size_t j = 0; j < 3; j++)
+				if (vertexMeshlet[indices[i + j]] != meshletIndex)
+					newVertices++;
+
+			if (meshlet.m_IndexCount > 0 && (meshlet.m_VertexCount + newVertices > maxVertices || meshlet.m_IndexCount / 3 >= maxTriangles))
+			{
+				CalculateMeshletBounds(meshlet, mesh.m_Vertices, indices.data() + meshlet.m_FirstIndex);
+				mesh.m_Meshlets.push_back(meshlet);
+				meshlet              = {};
+				meshlet.m_FirstIndex = static_cast<uint32_t>(i);
+				meshletIndex++;
+			}
+
+			for (size_t j = 0; j < 3; j++)
+			{
+				uint32_t& owner = vertexMeshlet[indices[i + j]];
+				if (owner != meshletIndex)
+				{
+					owner = meshletIndex;
+					meshlet.m_VertexCount++;
+				}
+			}
+			meshlet.m_IndexCount += 3;
+		}
+
+		CalculateMeshletBounds(meshlet, mesh.m_Vertices, indices.data() + meshlet.m_FirstIndex);
+		mesh.m_Meshlets.push_back(meshlet);
+	}
+
+} // namespace gp1::renderer::meshOptimizer
@@ -0,0 +1,86 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/Meshlet.h"
+
+#include <cmath>
+
+namespace gp1::renderer::mesh
+{
+	void MeshletCullingStats::Reset()
+	{
+		*this = {};
+	}
+
+	float MeshletCullingStats::GetRejectedFraction() const
+	{
+		return this->m_Triangles > 0 ? static_cast<float>(this->m_RejectedTriangles) / static_cast<float>(this->m_Triangles) : 0.0f;
+	}
+
+	void CullMeshlets(const std::vector<Meshlet>& meshlets, const glm::fmat4& transformationMatrix, const glm::fmat4& projectionViewMatrix, const glm::fvec3& cameraPosition, std::vector<MeshletRange>& ranges, MeshletCullingStats& stats)
+	{
+		ranges.clear();
+
+		// Extract the world space frustum planes.
+		glm::fvec4 planes[6];
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			glm::fvec4 row(projectionViewMatrix[0][i], projectionViewMatrix[1][i], projectionViewMatrix[2][i], projectionViewMatrix[3][i]);
+			glm::fvec4 w(projectionViewMatrix[0][3], projectionViewMatrix[1][3], projectionViewMatrix[2][3], projectionViewMatrix[3][3]);
+			planes[i * 2]     = w + row;
+			planes[i * 2 + 1] = w - row;
+		}
+		for (glm::fvec4& plane : planes)
+			plane /= std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+		float scaleX = glm::dot(glm::fvec3(transformationMatrix[0]), glm::fvec3(transformationMatrix[0]));
+		float scaleY = glm::dot(glm::fvec3(transformationMatrix[1]), glm::fvec3(transformationMatrix[1]));
+		float scaleZ = glm::dot(glm::fvec3(transformationMatrix[2]), glm::fvec3(transformationMatrix[2]));
+		float scale  = std::sqrt(glm::max(glm::max(scaleX, scaleY), scaleZ));
+
+		// The cones are tested in mesh space, so the camera is moved there instead of moving every cone.
+		glm::fvec3 localCamera = glm::fvec3(glm::inverse(transformationMatrix) * glm::fvec4(cameraPosition, 1.0f));
+
+		for (const Meshlet& meshlet : meshlets)
+		{
+			uint64_t triangles = meshlet.m_IndexCount / 3;
+			stats.m_Meshlets++;
+			stats.m_Triangles += triangles;
+
+			glm::fvec3 center(meshlet.m_BoundingSphere);
+			glm::fvec3 offset   = center - localCamera;
+			float      distance = std::sqrt(glm::dot(offset, offset));
+			if (glm::dot(offset, meshlet.m_ConeAxis) >= meshlet.m_ConeCutoff * distance + meshlet.m_BoundingSphere.w)
+			{
+				stats.m_BackfaceCulled++;
+				stats.m_RejectedTriangles += triangles;
+				continue;
+			}
+
+			glm::fvec3 worldCenter = glm::fvec3(transformationMatrix * glm::fvec4(center, 1.0f));
+			float      radius      = meshlet.m_BoundingSphere.w * scale;
+			bool       inside      = true;
+			for (const glm::fvec4& plane : planes)
+			{
+				if (plane.x * worldCenter.x + plane.y * worldCenter.y + plane.z * worldCenter.z + plane.w < -radius)
+				{
+					inside = false;
+					break;
+				}
+			}
+			if (!inside)
+			{
+				stats.m_FrustumCulled++;
+				stats.m_RejectedTriangles += triangles;
+				continue;
+			}
+
+			if (!ranges.empty() && ranges.back().m_FirstIndex + ranges.back().m_IndexCount == meshlet.m_FirstIndex)
+				ranges.back().m_IndexCount += meshlet.m_IndexCount;
+			else
+				ranges.push_back({ meshlet.m_FirstIndex, meshlet.m_IndexCount });
+		}
+	}
+
+} // namespace gp1::renderer::mesh
@@ -9,4 +9,14 @@ namespace gp1::renderer::mesh
 	SkeletalMesh::SkeletalMesh()
 	    : Mesh(this) {}
 
+	void SkeletalMesh::RecalculateBounds()
+	{
+		CalculateBoundingSphere(this->m_Vertices);
+	}
+
+	void SkeletalMesh::ExpandBounds(uint32_t begin, uint32_t end)
+	{
+		ExpandBoundingSphere(this->m_Vertices, begin, end);
+	}
+
 } // namespace gp1::renderer::mesh
@@ -9,4 +9,14 @@ namespace gp1::renderer::mesh
 	StaticMesh::StaticMesh()
 	    : Mesh(this) {}
 
+	void StaticMesh::RecalculateBounds()
+	{
+		CalculateBoundingSphere(this->m_Vertices);
+	}
+
+	void StaticMesh::ExpandBounds(uint32_t begin, uint32_t end)
+	{
+		ExpandBoundingSphere(this->m_Vertices, begin, end);
+	}
+
 } // namespace gp1::renderer::mesh
@@ -9,4 +9,14 @@ namespace gp1::renderer::mesh
 	StaticVoxelMesh::StaticVoxelMesh()
 	    : Mesh(this) {}
 
+	void StaticVoxelMesh::RecalculateBounds()
+	{
+		CalculateBoundingSphere(this->m_Vertices);
+	}
+
+	void StaticVoxelMesh::ExpandBounds(uint32_t begin, uint32_t end)
+	{
+		ExpandBoundingSphere(this->m_Vertices, begin, end);
+	}
+
 } // namespace gp1::renderer::mesh
@@ -0,0 +1,121 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Mesh/VertexPacking.h"
+
+#include <gtx/transform.hpp>
+
+#include <cmath>
+#include <cstring>
+
+namespace gp1::renderer::mesh
+{
+	void PositionBounds::Expand(const glm::fvec3& position)
+	{
+		if (this->m_Empty)
+		{
+			this->m_Min   = position;
+			this->m_Max   = position;
+			this->m_Empty = false;
+		}
+		else
+		{
+			this->m_Min = glm::min(this->m_Min, position);
+			this->m_Max = glm::max(this->m_Max, position);
+		}
+	}
+
+	bool PositionBounds::Contains(const glm::fvec3& position) const
+	{
+		return !this->m_Empty &&
+		       position.x >= this->m_Min.x && position.y >= this->m_Min.y && position.z >= this->m_Min.z &&
+		       position.x <= this->m_Max.x && position.y <= this->m_Max.y && position.z <= this->m_Max.z;
+	}
+
+	glm::fmat4 PositionBounds::GetDequantizationMatrix() const
+	{
+		return glm::translate(this->m_Min) * glm::scale(this->m_Max - this->m_Min);
+	}
+
+	uint16_t PackHalf(float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		uint32_t sign     = (bits >> 16) & 0x8000;
+		uint32_t floatExp = (bits >> 23) & 0xFF;
+		uint32_t mantissa = bits & 0x7FFFFF;
+		int32_t  halfExp  = static_cast<int32_t>(floatExp) - 127 + 15;
+
+		if (floatExp == 0xFF)
+			return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+		if (halfExp >= 31)
+			return static_cast<uint16_t>(sign | 0x7C00);
+
+		if (halfExp <= 0)
+		{
+			// Too small for a normal half, so it becomes a subnormal or zero.
+			if (halfExp < -10)
+				return static_cast<uint16_t>(sign);
+
+			mantissa |= 0x800000;
+			uint32_t shift     = static_cast<uint32_t>(14 - halfExp);
+			uint32_t half      = mantissa >> shift;
+			uint32_t remainder = mantissa & ((1u << shift) - 1);
+			uint32_t halfway   = 1u << (shift - 1);
+			if (remainder > halfway || (remainder == halfway && (half & 1)))
+				half++;
+			return static_cast<uint16_t>(sign | half);
+		}
+
+		uint32_t half      = sign | (static_cast<uint32_t>(halfExp) << 10) | (mantissa >> 13);
+		uint32_t remainder = mantissa & 0x1FFF;
+		// A carry out of the mantissa correctly bumps the exponent, up to infinity.
+		if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+			half++;
+		return static_cast<uint16_t>(half);
+	}
+
+	void PackOctahedral(const glm::fvec3& normal, int16_t (&packed)[2])
+	{
+		float length = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+		if (length <= 0.0f)
+		{
+			packed[0] = 0;
+			packed[1] = 0;
+			return;
+		}
+
+		float x = normal.x / length;
+		float y = normal.y / length;
+		if (normal.z < 0.0f)
+		{
+			// Fold the lower hemisphere over the diagonals.
+			float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			float foldedY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+			x             = foldedX;
+			y             = foldedY;
+		}
+
+		packed[0] = static_cast<int16_t>(std::lround(glm::clamp(x, -1.0f, 1.0f) * 32767.0f));
+		packed[1] = static_cast<int16_t>(std::lround(glm::clamp(y, -1.0f, 1.0f) * 32767.0f));
+	}
+
+	void PackVertex(const glm::fvec3& position, const glm::fvec3& normal, const glm::fvec2& uv, const PositionBounds& bounds, PackedVertex& packed)
+	{
+		glm::fvec3 extent = bounds.m_Max - bounds.m_Min;
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			float normalized     = extent[i] > 0.0f ? (position[i] - bounds.m_Min[i]) / extent[i] : 0.0f;
+			packed.m_Position[i] = static_cast<uint16_t>(std::lround(glm::clamp(normalized, 0.0f, 1.0f) * 65535.0f));
+		}
+		packed.m_Position[3] = 0;
+
+		PackOctahedral(normal, packed.m_Normal);
+
+		packed.m_UV[0] = PackHalf(uv.x);
+		packed.m_UV[1] = PackHalf(uv.y);
+	}
+
+} // namespace gp1::renderer::mesh
@@ -6,6 +6,7 @@
 #include "Engine/Renderer/Apis/OpenGL/OpenGLRenderer.h"
 #include "Engine/Renderer/Apis/Vulkan/VulkanRenderer.h"
 #include "Engine/Renderer/DebugRenderer.h"
+#include "Engine/Renderer/Mesh/Generators/MeshCache.h"
 #include "Engine/Renderer/RendererData.h"
 #include "Engine/Scene/Camera.h"
 #include "Engine/Scene/Scene.h"
@@ -25,6 +26,7 @@ namespace gp1::renderer
 	void Renderer::DeInit()
 	{
 		debug::DebugRenderer::CleanUp();
+		meshGenerators::ClearMeshCache();
 		DeInitRenderer();
 	}
 
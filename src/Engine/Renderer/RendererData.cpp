@@ -16,6 +16,11 @@ namespace gp1::renderer
 		return this->m_Type;
 	}
 
+	bool Data::HasRendererData() const
+	{
+		return this->m_RendererData;
+	}
+
 	RendererData::~RendererData()
 	{
 		if (this->m_Data) this->m_Data->m_RendererData = nullptr;
@@ -4,7 +4,9 @@
 
 #include "Engine/Renderer/Shader/Material.h"
 #include "Engine/Renderer/Shader/Shader.h"
+#include "Engine/Renderer/Texture/BrickedVolume.h"
 #include "Engine/Renderer/Texture/Texture2DArray.h"
+#include "Engine/Renderer/Texture/TextureAtlas.h"
 #include "Engine/Renderer/Texture/Texture3D.h"
 #include "Engine/Renderer/Texture/TextureCubeMap.h"
 
@@ -150,6 +152,43 @@ namespace gp1::renderer::shader
 		return this->m_Shader;
 	}
 
+	void Material::SetTexture(const std::string& id, texture::Texture2D* texture)
+	{
+		auto textureUniform = GetUniform<texture::Texture2D*>(id);
+		if (textureUniform)
+			textureUniform->m_Value = texture;
+
+		auto transformUniform = GetUniform<glm::fvec4>(id + "Transform");
+		if (transformUniform)
+			transformUniform->m_Value = { 1.0f, 1.0f, 0.0f, 0.0f };
+	}
+
+	void Material::SetTexture(const std::string& id, const texture::TextureAtlasRegion& region)
+	{
+		auto textureUniform = GetUniform<texture::Texture2D*>(id);
+		if (textureUniform)
+			textureUniform->m_Value = region.m_Texture;
+
+		auto transformUniform = GetUniform<glm::fvec4>(id + "Transform");
+		if (transformUniform)
+			transformUniform->m_Value = region.m_UVTransform;
+	}
+
+	void Material::SetTexture(const std::string& id, const texture::BrickedVolume& volume)
+	{
+		auto poolUniform = GetUniform<texture::Texture3D*>(id);
+		if (poolUniform)
+			poolUniform->m_Value = volume.GetPool();
+
+		auto indirectionUniform = GetUniform<texture::Texture3D*>(id + "Indirection");
+		if (indirectionUniform)
+			indirectionUniform->m_Value = volume.GetIndirection();
+
+		auto volumeUniform = GetUniform<glm::fvec4>(id + "Volume");
+		if (volumeUniform)
+			volumeUniform->m_Value = glm::fvec4(volume.GetWidth(), volume.GetHeight(), volume.GetDepth(), volume.GetSettings().m_BrickSize);
+	}
+
 	const std::unordered_map<std::string, std::any>& Material::GetUniforms() const
 	{
 		return this->m_Uniforms;
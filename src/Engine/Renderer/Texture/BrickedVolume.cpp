@@ -0,0 +1,620 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/BrickedVolume.h"
+#include "Engine/Renderer/Texture/Texture3D.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_BrickedVolumeLogger("Bricked Volume");
+
+	constexpr const uint32_t MaxPoolSize    = 2048; // The largest 3D texture every OpenGL 4 implementation supports.
+	constexpr const uint32_t UploadBatch    = 1024; // The most bricks decoded for uploading at once, which bounds the memory an update takes.
+	constexpr const uint8_t  ResidentMarker = 255;  // The alpha of indirection texels of bricks with a slot.
+
+	// Is every byte zero.
+	static bool IsZero(const uint8_t* data, size_t size)
+	{
+		size_t i = 0;
+		for (; i + 8 <= size; i += 8)
+		{
+			uint64_t word;
+			std::memcpy(&word, data + i, 8);
+			if (word)
+				return false;
+		}
+		for (; i < size; i++)
+			if (data[i])
+				return false;
+		return true;
+	}
+
+	BrickedVolume::BrickedVolume(uint32_t width, uint32_t height, uint32_t depth, const BrickedVolumeSettings& settings)
+	    : m_Width(width), m_Height(height), m_Depth(depth), m_Settings(settings)
+	{
+		if (this->m_Settings.m_BrickSize != 8 && this->m_Settings.m_BrickSize != 16)
+		{
+			s_BrickedVolumeLogger.LogWarning("Brick size %u isn't 8 or 16, using 8", this->m_Settings.m_BrickSize);
+			this->m_Settings.m_BrickSize = 8;
+		}
+		if (IsCompressedFormat(this->m_Settings.m_Format))
+		{
+			s_BrickedVolumeLogger.LogWarning("Bricked volumes can't be block compressed, using red unsigned bytes");
+			this->m_Settings.m_Format = TextureFormat::RED;
+			this->m_Settings.m_Type   = TextureDataType::UNSIGNED_BYTE;
+		}
+		uint32_t brickSize           = this->m_Settings.m_BrickSize;
+		uint32_t slotSize            = brickSize + 2;
+		this->m_Settings.m_PoolWidth = std::clamp(this->m_Settings.m_PoolWidth, 1U, MaxPoolSize / slotSize);
+		this->m_PixelSize            = GetPixelSize(this->m_Settings.m_Format, this->m_Settings.m_Type);
+
+		this->m_BricksX   = (width + brickSize - 1) / brickSize;
+		this->m_BricksY   = (height + brickSize - 1) / brickSize;
+		this->m_BricksZ   = (depth + brickSize - 1) / brickSize;
+		size_t brickCount = static_cast<size_t>(this->m_BricksX) * this->m_BricksY * this->m_BricksZ;
+		this->m_BrickTable.assign(brickCount, ~0U);
+		this->m_Dirty.assign(brickCount, false);
+
+		// The pool only gets a depth once bricks are stored, it is created by the updates written to it.
+		this->m_Pool                    = std::make_unique<Texture3D>();
+		this->m_Pool->m_Width           = this->m_Settings.m_PoolWidth * slotSize;
+		this->m_Pool->m_Height          = this->m_Settings.m_PoolWidth * slotSize;
+		this->m_Pool->m_Format          = this->m_Settings.m_Format;
+		this->m_Pool->m_Type            = this->m_Settings.m_Type;
+		this->m_Pool->m_Wrapping.s      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Pool->m_Wrapping.t      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Pool->m_Wrapping.r      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Pool->m_Filter.minimize = TextureFilter::LINEAR;
+		this->m_Pool->m_MaxLevel        = 0;
+
+		this->m_Indirection                    = std::make_unique<Texture3D>();
+		this->m_Indirection->m_Width           = this->m_BricksX;
+		this->m_Indirection->m_Height          = this->m_BricksY;
+		this->m_Indirection->m_Depth           = this->m_BricksZ;
+		this->m_Indirection->m_Format          = TextureFormat::RGBA;
+		this->m_Indirection->m_Type            = TextureDataType::UNSIGNED_BYTE;
+		this->m_Indirection->m_Wrapping.s      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Indirection->m_Wrapping.t      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Indirection->m_Wrapping.r      = TextureWrapping::CLAMP_TO_EDGE;
+		this->m_Indirection->m_Filter.minimize = TextureFilter::NEAREST;
+		this->m_Indirection->m_Filter.magnify  = TextureFilter::NEAREST;
+		this->m_Indirection->m_MaxLevel        = 0;
+		this->m_Indirection->m_Data.resize(brickCount * 4);
+		this->m_Indirection->SetDynamic(true);
+	}
+
+	BrickedVolume::~BrickedVolume() {}
+
+	void BrickedVolume::Write(uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const void* texels)
+	{
+		if (!texels || width == 0 || height == 0 || depth == 0)
+			return;
+		if (x + width > this->m_Width || y + height > this->m_Height || z + depth > this->m_Depth)
+		{
+			s_BrickedVolumeLogger.LogWarning("Region %ux%ux%u at %u, %u, %u is outside the volume of %ux%ux%u", width, height, depth, x, y, z, this->m_Width, this->m_Height, this->m_Depth);
+			return;
+		}
+
+		uint32_t brickSize  = this->m_Settings.m_BrickSize;
+		uint32_t pixelSize  = this->m_PixelSize;
+		size_t   brickBytes = static_cast<size_t>(brickSize) * brickSize * brickSize * pixelSize;
+
+		struct BrickWrite
+		{
+		public:
+			uint32_t m_X, m_Y, m_Z; // The brick.
+			Brick    m_Brick;       // The brick encoded again.
+			bool     m_Stored;      // Does the brick have texels other than zero.
+		};
+		std::vector<BrickWrite> writes;
+		for (uint32_t brickZ = z / brickSize; brickZ <= (z + depth - 1) / brickSize; brickZ++)
+			for (uint32_t brickY = y / brickSize; brickY <= (y + height - 1) / brickSize; brickY++)
+				for (uint32_t brickX = x / brickSize; brickX <= (x + width - 1) / brickSize; brickX++)
+					writes.push_back({ brickX, brickY, brickZ, {}, false });
+
+		// The bricks are independent, so they are decoded, written and encoded again in parallel.
+		const uint8_t* source = static_cast<const uint8_t*>(texels);
+		JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(writes.size()), [&](uint32_t i) {
+			BrickWrite&          write = writes[i];
+			std::vector<uint8_t> decoded(brickBytes, 0);
+			uint32_t             entry = this->m_BrickTable[GetBrickIndex(write.m_X, write.m_Y, write.m_Z)];
+			if (entry != ~0U)
+				DecodeBrick(this->m_Bricks[entry], decoded.data());
+
+			uint32_t originX = write.m_X * brickSize, originY = write.m_Y * brickSize, originZ = write.m_Z * brickSize;
+			uint32_t startX = std::max(x, originX), endX = std::min(x + width, originX + brickSize);
+			uint32_t startY = std::max(y, originY), endY = std::min(y + height, originY + brickSize);
+			uint32_t startZ = std::max(z, originZ), endZ = std::min(z + depth, originZ + brickSize);
+			for (uint32_t texelZ = startZ; texelZ < endZ; texelZ++)
+			{
+				for (uint32_t texelY = startY; texelY < endY; texelY++)
+				{
+					uint8_t*       target = decoded.data() + ((static_cast<size_t>(texelZ - originZ) * brickSize + (texelY - originY)) * brickSize + (startX - originX)) * pixelSize;
+					const uint8_t* row    = source + ((static_cast<size_t>(texelZ - z) * height + (texelY - y)) * width + (startX - x)) * pixelSize;
+					std::memcpy(target, row, static_cast<size_t>(endX - startX) * pixelSize);
+				}
+			}
+			write.m_Stored = EncodeBrick(decoded.data(), write.m_Brick);
+		});
+
+		for (BrickWrite& write : writes)
+		{
+			uint32_t  index = GetBrickIndex(write.m_X, write.m_Y, write.m_Z);
+			uint32_t& entry = this->m_BrickTable[index];
+			if (!write.m_Stored)
+			{
+				// Empty bricks that stay empty haven't changed.
+				if (entry == ~0U)
+					continue;
+
+				// The slot is free once the indirection texel stops pointing at it, which the next update writes before the slot is reused.
+				if (this->m_Bricks[entry].m_Slot != ~0U)
+					this->m_FreeSlots.push_back(this->m_Bricks[entry].m_Slot);
+				this->m_Bricks[entry] = {};
+				this->m_FreeBricks.push_back(entry);
+				entry = ~0U;
+			}
+			else
+			{
+				if (entry == ~0U)
+				{
+					if (!this->m_FreeBricks.empty())
+					{
+						entry = this->m_FreeBricks.back();
+						this->m_FreeBricks.pop_back();
+					}
+					else
+					{
+						entry = static_cast<uint32_t>(this->m_Bricks.size());
+						this->m_Bricks.emplace_back();
+					}
+				}
+				Brick& brick     = this->m_Bricks[entry];
+				brick.m_Data     = std::move(write.m_Brick.m_Data);
+				brick.m_Encoding = write.m_Brick.m_Encoding;
+			}
+
+			// The borders of the neighbours hold texels of the brick, so the neighbours the region reaches into the border of are uploaded again.
+			uint32_t brick[3] { write.m_X, write.m_Y, write.m_Z };
+			uint32_t counts[3] { this->m_BricksX, this->m_BricksY, this->m_BricksZ };
+			uint32_t starts[3] { x, y, z };
+			uint32_t ends[3] { x + width, y + height, z + depth };
+			bool     low[3], high[3];
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				low[axis]  = brick[axis] > 0 && starts[axis] <= brick[axis] * brickSize;
+				high[axis] = brick[axis] + 1 < counts[axis] && ends[axis] >= (brick[axis] + 1) * brickSize;
+			}
+			for (int32_t offsetZ = low[2] ? -1 : 0; offsetZ <= (high[2] ? 1 : 0); offsetZ++)
+				for (int32_t offsetY = low[1] ? -1 : 0; offsetY <= (high[1] ? 1 : 0); offsetY++)
+					for (int32_t offsetX = low[0] ? -1 : 0; offsetX <= (high[0] ? 1 : 0); offsetX++)
+						MarkBrickDirty(GetBrickIndex(write.m_X + offsetX, write.m_Y + offsetY, write.m_Z + offsetZ));
+		}
+	}
+
+	bool BrickedVolume::Write(const Texture3D& texture)
+	{
+		if (texture.m_Width != this->m_Width || texture.m_Height != this->m_Height || texture.m_Depth != this->m_Depth ||
+		    texture.m_Format != this->m_Settings.m_Format || texture.m_Type != this->m_Settings.m_Type ||
+		    texture.m_Data.size() < static_cast<size_t>(this->m_Width) * this->m_Height * this->m_Depth * this->m_PixelSize)
+		{
+			s_BrickedVolumeLogger.LogWarning("Textures written to a bricked volume have to match its size, format and type");
+			return false;
+		}
+
+		Write(0, 0, 0, this->m_Width, this->m_Height, this->m_Depth, texture.m_Data.data());
+		return true;
+	}
+
+	void BrickedVolume::Read(uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, void* texels) const
+	{
+		if (!texels || width == 0 || height == 0 || depth == 0)
+			return;
+		if (x + width > this->m_Width || y + height > this->m_Height || z + depth > this->m_Depth)
+		{
+			s_BrickedVolumeLogger.LogWarning("Region %ux%ux%u at %u, %u, %u is outside the volume of %ux%ux%u", width, height, depth, x, y, z, this->m_Width, this->m_Height, this->m_Depth);
+			return;
+		}
+
+		uint32_t             brickSize = this->m_Settings.m_BrickSize;
+		uint32_t             pixelSize = this->m_PixelSize;
+		uint8_t*             target    = static_cast<uint8_t*>(texels);
+		std::vector<uint8_t> decoded(static_cast<size_t>(brickSize) * brickSize * brickSize * pixelSize);
+		for (uint32_t brickZ = z / brickSize; brickZ <= (z + depth - 1) / brickSize; brickZ++)
+		{
+			for (uint32_t brickY = y / brickSize; brickY <= (y + height - 1) / brickSize; brickY++)
+			{
+				for (uint32_t brickX = x / brickSize; brickX <= (x + width - 1) / brickSize; brickX++)
+				{
+					uint32_t entry = this->m_BrickTable[GetBrickIndex(brickX, brickY, brickZ)];
+					if (entry != ~0U)
+						DecodeBrick(this->m_Bricks[entry], decoded.data());
+					else
+						std::fill(decoded.begin(), decoded.end(), static_cast<uint8_t>(0));
+
+					uint32_t originX = brickX * brickSize, originY = brickY * brickSize, originZ = brickZ * brickSize;
+					uint32_t startX = std::max(x, originX), endX = std::min(x + width, originX + brickSize);
+					uint32_t startY = std::max(y, originY), endY = std::min(y + height, originY + brickSize);
+					uint32_t startZ = std::max(z, originZ), endZ = std::min(z + depth, originZ + brickSize);
+					for (uint32_t texelZ = startZ; texelZ < endZ; texelZ++)
+					{
+						for (uint32_t texelY = startY; texelY < endY; texelY++)
+						{
+							const uint8_t* source = decoded.data() + ((static_cast<size_t>(texelZ - originZ) * brickSize + (texelY - originY)) * brickSize + (startX - originX)) * pixelSize;
+							uint8_t*       row    = target + ((static_cast<size_t>(texelZ - z) * height + (texelY - y)) * width + (startX - x)) * pixelSize;
+							std::memcpy(row, source, static_cast<size_t>(endX - startX) * pixelSize);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void BrickedVolume::Update()
+	{
+		if (this->m_DirtyBricks.empty())
+			return;
+
+		// Grow the pool first if the dirty bricks don't fit, which makes every stored brick dirty.
+		uint32_t neededSlots = 0;
+		for (uint32_t index : this->m_DirtyBricks)
+		{
+			uint32_t entry = this->m_BrickTable[index];
+			if (entry != ~0U && this->m_Bricks[entry].m_Slot == ~0U)
+				neededSlots++;
+		}
+		uint32_t newSlots = neededSlots > this->m_FreeSlots.size() ? neededSlots - static_cast<uint32_t>(this->m_FreeSlots.size()) : 0;
+		uint32_t capacity = this->m_Settings.m_PoolWidth * this->m_Settings.m_PoolWidth * this->m_PoolDepth;
+		if (this->m_UsedSlots + newSlots > capacity && !GrowPool(this->m_UsedSlots + newSlots))
+			s_BrickedVolumeLogger.LogWarning("The pool can't grow to fit %u bricks, the bricks without a slot stay empty", this->m_UsedSlots + newSlots);
+		capacity = this->m_Settings.m_PoolWidth * this->m_Settings.m_PoolWidth * this->m_PoolDepth;
+
+		std::vector<uint32_t> dirty;
+		dirty.swap(this->m_DirtyBricks);
+		for (uint32_t index : dirty)
+			this->m_Dirty[index] = false;
+
+		// Point the indirection texels at the slots, only the box around the texels that changed is uploaded.
+		uint32_t              poolWidth = this->m_Settings.m_PoolWidth;
+		uint32_t              boxMin[3] { ~0U, ~0U, ~0U }, boxMax[3] { 0, 0, 0 };
+		std::vector<uint32_t> uploads;
+		for (uint32_t index : dirty)
+		{
+			uint32_t entry = this->m_BrickTable[index];
+			uint32_t slot  = ~0U;
+			if (entry != ~0U)
+			{
+				Brick& brick = this->m_Bricks[entry];
+				if (brick.m_Slot == ~0U)
+				{
+					if (!this->m_FreeSlots.empty())
+					{
+						brick.m_Slot = this->m_FreeSlots.back();
+						this->m_FreeSlots.pop_back();
+					}
+					else if (this->m_UsedSlots < capacity)
+					{
+						brick.m_Slot = this->m_UsedSlots++;
+					}
+				}
+				slot = brick.m_Slot;
+			}
+			if (slot != ~0U)
+				uploads.push_back(index);
+
+			uint8_t  texel[4] {};
+			uint8_t* current = this->m_Indirection->m_Data.data() + static_cast<size_t>(index) * 4;
+			if (slot != ~0U)
+			{
+				texel[0] = static_cast<uint8_t>(slot % poolWidth);
+				texel[1] = static_cast<uint8_t>(slot / poolWidth % poolWidth);
+				texel[2] = static_cast<uint8_t>(slot / (poolWidth * poolWidth));
+				texel[3] = ResidentMarker;
+			}
+			if (std::memcmp(current, texel, 4) != 0)
+			{
+				std::memcpy(current, texel, 4);
+				uint32_t brick[3] { index % this->m_BricksX, index / this->m_BricksX % this->m_BricksY, index / (this->m_BricksX * this->m_BricksY) };
+				for (uint32_t axis = 0; axis < 3; axis++)
+				{
+					boxMin[axis] = std::min(boxMin[axis], brick[axis]);
+					boxMax[axis] = std::max(boxMax[axis], brick[axis]);
+				}
+			}
+		}
+
+		// The indirection texture uploads its data when it is created, so it only needs updates after that.
+		if (boxMin[0] != ~0U && !this->m_Indirection->IsDirty())
+		{
+			Texture3DUpdate update;
+			update.m_X      = boxMin[0];
+			update.m_Y      = boxMin[1];
+			update.m_Z      = boxMin[2];
+			update.m_Width  = boxMax[0] - boxMin[0] + 1;
+			update.m_Height = boxMax[1] - boxMin[1] + 1;
+			update.m_Depth  = boxMax[2] - boxMin[2] + 1;
+			update.m_Data.resize(static_cast<size_t>(update.m_Width) * update.m_Height * update.m_Depth * 4);
+			for (uint32_t brickZ = 0; brickZ < update.m_Depth; brickZ++)
+			{
+				for (uint32_t brickY = 0; brickY < update.m_Height; brickY++)
+				{
+					const uint8_t* source = this->m_Indirection->m_Data.data() + static_cast<size_t>(GetBrickIndex(update.m_X, update.m_Y + brickY, update.m_Z + brickZ)) * 4;
+					std::memcpy(update.m_Data.data() + (static_cast<size_t>(brickZ) * update.m_Height + brickY) * update.m_Width * 4, source, static_cast<size_t>(update.m_Width) * 4);
+				}
+			}
+			this->m_Indirection->m_Updates.push_back(std::move(update));
+		}
+
+		// Every uploaded brick takes its border from its neighbours, so the bricks of a batch and their neighbours are decoded once up front.
+		uint32_t brickSize  = this->m_Settings.m_BrickSize;
+		uint32_t slotSize   = brickSize + 2;
+		uint32_t pixelSize  = this->m_PixelSize;
+		size_t   brickBytes = static_cast<size_t>(brickSize) * brickSize * brickSize * pixelSize;
+		for (size_t first = 0; first < uploads.size(); first += UploadBatch)
+		{
+			uint32_t batchSize = static_cast<uint32_t>(std::min<size_t>(UploadBatch, uploads.size() - first));
+
+			std::unordered_map<uint32_t, uint32_t> decodedIndices;
+			std::vector<uint32_t>                  decodeList;
+			std::vector<uint32_t>                  neighbours(static_cast<size_t>(batchSize) * 27, ~0U);
+			for (uint32_t i = 0; i < batchSize; i++)
+			{
+				uint32_t index = uploads[first + i];
+				uint32_t brick[3] { index % this->m_BricksX, index / this->m_BricksX % this->m_BricksY, index / (this->m_BricksX * this->m_BricksY) };
+				for (uint32_t neighbour = 0; neighbour < 27; neighbour++)
+				{
+					int32_t neighbourX = static_cast<int32_t>(brick[0]) + static_cast<int32_t>(neighbour % 3) - 1;
+					int32_t neighbourY = static_cast<int32_t>(brick[1]) + static_cast<int32_t>(neighbour / 3 % 3) - 1;
+					int32_t neighbourZ = static_cast<int32_t>(brick[2]) + static_cast<int32_t>(neighbour / 9) - 1;
+					if (neighbourX < 0 || neighbourY < 0 || neighbourZ < 0 || neighbourX >= static_cast<int32_t>(this->m_BricksX) || neighbourY >= static_cast<int32_t>(this->m_BricksY) || neighbourZ >= static_cast<int32_t>(this->m_BricksZ))
+						continue;
+
+					uint32_t neighbourIndex = GetBrickIndex(neighbourX, neighbourY, neighbourZ);
+					if (this->m_BrickTable[neighbourIndex] == ~0U)
+						continue;
+
+					auto itr = decodedIndices.find(neighbourIndex);
+					if (itr == decodedIndices.end())
+					{
+						itr = decodedIndices.insert({ neighbourIndex, static_cast<uint32_t>(decodeList.size()) }).first;
+						decodeList.push_back(neighbourIndex);
+					}
+					neighbours[static_cast<size_t>(i) * 27 + neighbour] = itr->second;
+				}
+			}
+
+			std::vector<uint8_t> decoded(decodeList.size() * brickBytes);
+			JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(decodeList.size()), [&](uint32_t i) {
+				DecodeBrick(this->m_Bricks[this->m_BrickTable[decodeList[i]]], decoded.data() + i * brickBytes);
+			});
+
+			std::vector<Texture3DUpdate> updates(batchSize);
+			JobSystem::GetInstance()->ParallelFor(batchSize, [&](uint32_t i) {
+				uint32_t         slot   = this->m_Bricks[this->m_BrickTable[uploads[first + i]]].m_Slot;
+				Texture3DUpdate& update = updates[i];
+				update.m_X              = slot % poolWidth * slotSize;
+				update.m_Y              = slot / poolWidth % poolWidth * slotSize;
+				update.m_Z              = slot / (poolWidth * poolWidth) * slotSize;
+				update.m_Width          = slotSize;
+				update.m_Height         = slotSize;
+				update.m_Depth          = slotSize;
+				update.m_Data.assign(static_cast<size_t>(slotSize) * slotSize * slotSize * pixelSize, 0);
+
+				// Texels of empty neighbours and texels outside the volume stay zero.
+				for (uint32_t slotZ = 0; slotZ < slotSize; slotZ++)
+				{
+					uint32_t neighbourZ = slotZ == 0 ? 0 : (slotZ <= brickSize ? 1 : 2);
+					uint32_t localZ     = neighbourZ == 0 ? brickSize - 1 : (neighbourZ == 1 ? slotZ - 1 : 0);
+					for (uint32_t slotY = 0; slotY < slotSize; slotY++)
+					{
+						uint32_t neighbourY = slotY == 0 ? 0 : (slotY <= brickSize ? 1 : 2);
+						uint32_t localY     = neighbourY == 0 ? brickSize - 1 : (neighbourY == 1 ? slotY - 1 : 0);
+						uint8_t* row        = update.m_Data.data() + (static_cast<size_t>(slotZ) * slotSize + slotY) * slotSize * pixelSize;
+						size_t   sourceRow  = (static_cast<size_t>(localZ) * brickSize + localY) * brickSize * pixelSize;
+						for (uint32_t neighbourX = 0; neighbourX < 3; neighbourX++)
+						{
+							uint32_t decodedIndex = neighbours[static_cast<size_t>(i) * 27 + neighbourZ * 9 + neighbourY * 3 + neighbourX];
+							if (decodedIndex == ~0U)
+								continue;
+
+							const uint8_t* source = decoded.data() + decodedIndex * brickBytes + sourceRow;
+							if (neighbourX == 0)
+								std::memcpy(row, source + (brickSize - 1) * pixelSize, pixelSize);
+							else if (neighbourX == 1)
+								std::memcpy(row + pixelSize, source, static_cast<size_t>(brickSize) * pixelSize);
+							else
+								std::memcpy(row + (slotSize - 1) * pixelSize, source, pixelSize);
+						}
+					}
+				}
+			});
+
+			for (Texture3DUpdate& update : updates)
+				this->m_Pool->m_Updates.push_back(std::move(update));
+			this->m_UploadedBricks += batchSize;
+		}
+	}
+
+	Texture3D* BrickedVolume::GetPool() const
+	{
+		return this->m_Pool.get();
+	}
+
+	Texture3D* BrickedVolume::GetIndirection() const
+	{
+		return this->m_Indirection.get();
+	}
+
+	uint32_t BrickedVolume::GetWidth() const
+	{
+		return this->m_Width;
+	}
+
+	uint32_t BrickedVolume::GetHeight() const
+	{
+		return this->m_Height;
+	}
+
+	uint32_t BrickedVolume::GetDepth() const
+	{
+		return this->m_Depth;
+	}
+
+	const BrickedVolumeSettings& BrickedVolume::GetSettings() const
+	{
+		return this->m_Settings;
+	}
+
+	BrickedVolumeStats BrickedVolume::GetStats() const
+	{
+		BrickedVolumeStats stats;
+		stats.m_Bricks         = static_cast<uint32_t>(this->m_BrickTable.size());
+		stats.m_DenseSize      = static_cast<uint64_t>(this->m_Width) * this->m_Height * this->m_Depth * this->m_PixelSize;
+		stats.m_PoolSize       = static_cast<uint64_t>(this->m_Pool->m_Width) * this->m_Pool->m_Height * this->m_Pool->m_Depth * this->m_PixelSize;
+		stats.m_UploadedBricks = this->m_UploadedBricks;
+		stats.m_PendingBricks  = static_cast<uint32_t>(this->m_DirtyBricks.size());
+		for (uint32_t entry : this->m_BrickTable)
+		{
+			if (entry == ~0U)
+				continue;
+
+			const Brick& brick = this->m_Bricks[entry];
+			stats.m_StoredBricks++;
+			stats.m_RunLengthBricks += brick.m_Encoding == BrickEncoding::RUN_LENGTH;
+			stats.m_StoredSize += brick.m_Data.size();
+		}
+		return stats;
+	}
+
+	uint32_t BrickedVolume::GetBrickIndex(uint32_t x, uint32_t y, uint32_t z) const
+	{
+		return (z * this->m_BricksY + y) * this->m_BricksX + x;
+	}
+
+	void BrickedVolume::DecodeBrick(const Brick& brick, uint8_t* texels) const
+	{
+		size_t brickBytes = static_cast<size_t>(this->m_Settings.m_BrickSize) * this->m_Settings.m_BrickSize * this->m_Settings.m_BrickSize * this->m_PixelSize;
+		if (brick.m_Encoding == BrickEncoding::RAW)
+		{
+			std::memcpy(texels, brick.m_Data.data(), std::min(brickBytes, brick.m_Data.size()));
+			return;
+		}
+
+		uint32_t       pixelSize = this->m_PixelSize;
+		const uint8_t* packet    = brick.m_Data.data();
+		const uint8_t* end       = packet + brick.m_Data.size();
+		uint8_t*       target    = texels;
+		uint8_t*       targetEnd = texels + brickBytes;
+		while (packet < end && target < targetEnd)
+		{
+			uint8_t count = *packet++;
+			if (count < 128)
+			{
+				size_t size = std::min<size_t>((count + 1) * static_cast<size_t>(pixelSize), targetEnd - target);
+				std::memcpy(target, packet, size);
+				packet += (count + 1) * static_cast<size_t>(pixelSize);
+				target += size;
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count - 126U && target < targetEnd; i++, target += pixelSize)
+					std::memcpy(target, packet, pixelSize);
+				packet += pixelSize;
+			}
+		}
+	}
+
+	bool BrickedVolume::EncodeBrick(const uint8_t* texels, Brick& brick) const
+	{
+		uint32_t pixelSize  = this->m_PixelSize;
+		size_t   texelCount = static_cast<size_t>(this->m_Settings.m_BrickSize) * this->m_Settings.m_BrickSize * this->m_Settings.m_BrickSize;
+		size_t   brickBytes = texelCount * pixelSize;
+		if (IsZero(texels, brickBytes))
+			return false;
+
+		auto sameTexels = [&](size_t a, size_t b) {
+			return std::memcmp(texels + a * pixelSize, texels + b * pixelSize, pixelSize) == 0;
+		};
+
+		// Runs of two or more texels become repeat packets, the texels between them literal packets. Encoding stops once it isn't smaller.
+		std::vector<uint8_t> encoded;
+		encoded.reserve(brickBytes);
+		size_t texel = 0;
+		while (texel < texelCount && encoded.size() < brickBytes)
+		{
+			size_t run = 1;
+			while (texel + run < texelCount && run < 129 && sameTexels(texel, texel + run))
+				run++;
+			if (run >= 2)
+			{
+				encoded.push_back(static_cast<uint8_t>(run + 126));
+				encoded.insert(encoded.end(), texels + texel * pixelSize, texels + (texel + 1) * pixelSize);
+				texel += run;
+				continue;
+			}
+
+			size_t literal = 1;
+			while (texel + literal < texelCount && literal < 128 && !(texel + literal + 1 < texelCount && sameTexels(texel + literal, texel + literal + 1)))
+				literal++;
+			encoded.push_back(static_cast<uint8_t>(literal - 1));
+			encoded.insert(encoded.end(), texels + texel * pixelSize, texels + (texel + literal) * pixelSize);
+			texel += literal;
+		}
+
+		if (texel == texelCount && encoded.size() < brickBytes)
+		{
+			encoded.shrink_to_fit();
+			brick.m_Data     = std::move(encoded);
+			brick.m_Encoding = BrickEncoding::RUN_LENGTH;
+		}
+		else
+		{
+			brick.m_Data.assign(texels, texels + brickBytes);
+			brick.m_Encoding = BrickEncoding::RAW;
+		}
+		return true;
+	}
+
+	void BrickedVolume::MarkBrickDirty(uint32_t index)
+	{
+		if (this->m_Dirty[index])
+			return;
+
+		this->m_Dirty[index] = true;
+		this->m_DirtyBricks.push_back(index);
+	}
+
+	bool BrickedVolume::GrowPool(uint32_t slots)
+	{
+		uint32_t slotSize = this->m_Settings.m_BrickSize + 2;
+		uint32_t perLayer = this->m_Settings.m_PoolWidth * this->m_Settings.m_PoolWidth;
+		uint32_t maxDepth = MaxPoolSize / slotSize;
+		uint32_t needed   = (slots + perLayer - 1) / perLayer;
+		uint32_t depth    = std::max(this->m_PoolDepth, 1U);
+		while (depth < needed)
+			depth *= 2;
+		depth = std::min(depth, maxDepth);
+		if (depth <= this->m_PoolDepth)
+			return false;
+
+		// The slots keep their place as the pool only grows in depth, but the texture is created again without the bricks.
+		this->m_PoolDepth     = depth;
+		this->m_Pool->m_Depth = depth * slotSize;
+		this->m_Pool->m_Updates.clear();
+		this->m_Pool->MarkDirty();
+		for (uint32_t index = 0; index < this->m_BrickTable.size(); index++)
+			if (this->m_BrickTable[index] != ~0U && this->m_Bricks[this->m_BrickTable[index]].m_Slot != ~0U)
+				MarkBrickDirty(index);
+
+		s_BrickedVolumeLogger.LogDebug("Grew the pool to %ux%ux%u bricks", this->m_Settings.m_PoolWidth, this->m_Settings.m_PoolWidth, depth);
+		return depth >= needed;
+	}
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,589 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/EnvironmentMap.h"
+#include "Engine/Renderer/Texture/Loaders/TextureLoaders.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Renderer/Texture/TextureConversion.h"
+#include "Engine/Renderer/Texture/TextureCubeMap.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_EnvironmentMapLogger("Environment Map");
+
+	namespace environmentCache
+	{
+		constexpr const uint32_t Magic   = 0x4E455047; // "GPEN"
+		constexpr const uint32_t Version = 1;          // Bumped whenever the layout or the filtering changes, so stale caches are rebuilt.
+	}; // namespace environmentCache
+
+	struct EnvironmentCacheHeader
+	{
+	public:
+		uint32_t m_Magic;
+		uint32_t m_Version;
+		uint64_t m_Key;
+		uint32_t m_CubeSize, m_CubeLevels;
+		uint32_t m_SpecularSize, m_SpecularLevels;
+		float    m_Irradiance[27];
+	};
+
+	// The faces of one level of a float rgba cube map.
+	struct CubeLevel
+	{
+	public:
+		const float* m_Faces[6];
+		uint32_t     m_Size;
+	};
+
+	constexpr const float Pi = 3.14159265358979f;
+
+	// Get the direction through the texel coordinates of the face, which go from -1 to 1, following the GL cube map layout.
+	static glm::fvec3 GetFaceDirection(uint32_t face, float u, float v)
+	{
+		glm::fvec3 direction;
+		switch (face)
+		{
+		case TextureCubeMapFaceIndex::POSITIVE_X: direction = { 1.0f, -v, -u }; break;
+		case TextureCubeMapFaceIndex::NEGATIVE_X: direction = { -1.0f, -v, u }; break;
+		case TextureCubeMapFaceIndex::POSITIVE_Y: direction = { u, 1.0f, v }; break;
+		case TextureCubeMapFaceIndex::NEGATIVE_Y: direction = { u, -1.0f, -v }; break;
+		case TextureCubeMapFaceIndex::POSITIVE_Z: direction = { u, -v, 1.0f }; break;
+		default: direction = { -u, -v, -1.0f }; break;
+		}
+		return glm::normalize(direction);
+	}
+
+	// Get the face the direction points at and the coordinates on it, which go from 0 to 1.
+	static uint32_t GetFaceCoordinates(const glm::fvec3& direction, float& u, float& v)
+	{
+		glm::fvec3 absolute = glm::abs(direction);
+		uint32_t   face;
+		float      major, s, t;
+		if (absolute.x >= absolute.y && absolute.x >= absolute.z)
+		{
+			face  = direction.x > 0.0f ? TextureCubeMapFaceIndex::POSITIVE_X : TextureCubeMapFaceIndex::NEGATIVE_X;
+			major = absolute.x;
+			s     = direction.x > 0.0f ? -direction.z : direction.z;
+			t     = -direction.y;
+		}
+		else if (absolute.y >= absolute.z)
+		{
+			face  = direction.y > 0.0f ? TextureCubeMapFaceIndex::POSITIVE_Y : TextureCubeMapFaceIndex::NEGATIVE_Y;
+			major = absolute.y;
+			s     = direction.x;
+			t     = direction.y > 0.0f ? direction.z : -direction.z;
+		}
+		else
+		{
+			face  = direction.z > 0.0f ? TextureCubeMapFaceIndex::POSITIVE_Z : TextureCubeMapFaceIndex::NEGATIVE_Z;
+			major = absolute.z;
+			s     = direction.z > 0.0f ? direction.x : -direction.x;
+			t     = -direction.y;
+		}
+		u = 0.5f * (s / major + 1.0f);
+		v = 0.5f * (t / major + 1.0f);
+		return face;
+	}
+
+	// Sample the float rgba image bilinearly at the coordinates, which go from 0 to 1, wrapping or clamping the x axis.
+	static glm::fvec4 SampleBilinear(const float* texels, uint32_t width, uint32_t height, float u, float v, bool wrapX)
+	{
+		float    x  = u * width - 0.5f;
+		float    y  = v * height - 0.5f;
+		float    fx = std::floor(x);
+		float    fy = std::floor(y);
+		float    tx = x - fx;
+		float    ty = y - fy;
+		int32_t  x0 = static_cast<int32_t>(fx);
+		int32_t  y0 = static_cast<int32_t>(fy);
+		uint32_t xs[2], ys[2];
+		for (int32_t i = 0; i < 2; i++)
+		{
+			int32_t column = x0 + i;
+			xs[i]          = wrapX ? static_cast<uint32_t>((column % static_cast<int32_t>(width) + static_cast<int32_t>(width)) % static_cast<int32_t>(width)) : static_cast<uint32_t>(std::clamp(column, 0, static_cast<int32_t>(width) - 1));
+			ys[i]          = static_cast<uint32_t>(std::clamp(y0 + i, 0, static_cast<int32_t>(height) - 1));
+		}
+
+		auto texel = [&](uint32_t column, uint32_t row) {
+			const float* t = texels + (static_cast<size_t>(row) * width + column) * 4;
+			return glm::fvec4(t[0], t[1], t[2], t[3]);
+		};
+		glm::fvec4 top    = texel(xs[0], ys[0]) * (1.0f - tx) + texel(xs[1], ys[0]) * tx;
+		glm::fvec4 bottom = texel(xs[0], ys[1]) * (1.0f - tx) + texel(xs[1], ys[1]) * tx;
+		return top * (1.0f - ty) + bottom * ty;
+	}
+
+	// Sample the cube map levels in the direction trilinearly, the faces clamp at their edges.
+	static glm::fvec3 SampleCube(const std::vector<CubeLevel>& levels, const glm::fvec3& direction, float lod)
+	{
+		float    u, v;
+		uint32_t face = GetFaceCoordinates(direction, u, v);
+
+		lod            = std::clamp(lod, 0.0f, static_cast<float>(levels.size() - 1));
+		uint32_t level = static_cast<uint32_t>(lod);
+		float    t     = lod - level;
+
+		const CubeLevel& fine  = levels[level];
+		glm::fvec4       color = SampleBilinear(fine.m_Faces[face], fine.m_Size, fine.m_Size, u, v, false);
+		if (t > 0.0f && level + 1 < levels.size())
+		{
+			const CubeLevel& coarse = levels[level + 1];
+			color                   = color * (1.0f - t) + SampleBilinear(coarse.m_Faces[face], coarse.m_Size, coarse.m_Size, u, v, false) * t;
+		}
+		return glm::fvec3(color);
+	}
+
+	// Get the stored levels of the float rgba cube map.
+	static std::vector<CubeLevel> GetCubeLevels(const TextureCubeMap& cubeMap)
+	{
+		std::vector<CubeLevel> levels(std::max(GetStoredLevelCount(cubeMap), 1U));
+		for (uint32_t level = 0; level < levels.size(); level++)
+		{
+			levels[level].m_Size = std::max(cubeMap.m_Width >> level, 1U);
+			for (uint32_t face = 0; face < 6; face++)
+			{
+				const Texture2D& texture    = cubeMap.m_Textures[face];
+				levels[level].m_Faces[face] = reinterpret_cast<const float*>(level == 0 ? texture.m_Data.data() : texture.m_Mips[level - 1].data());
+			}
+		}
+		return levels;
+	}
+
+	// Set up the cube map and its faces as rgba of the float or half float type, of the size with the number of levels.
+	static void AllocateCubeMap(TextureCubeMap& cubeMap, uint32_t size, uint32_t levels, TextureDataType type = TextureDataType::FLOAT)
+	{
+		size_t texelSize   = type == TextureDataType::FLOAT ? 16 : 8;
+		cubeMap.m_Width    = size;
+		cubeMap.m_Height   = size;
+		cubeMap.m_Format   = TextureFormat::RGBA;
+		cubeMap.m_Type     = type;
+		cubeMap.m_MaxLevel = levels - 1;
+		for (Texture2D& face : cubeMap.m_Textures)
+		{
+			face.m_Width  = size;
+			face.m_Height = size;
+			face.m_Format = TextureFormat::RGBA;
+			face.m_Type   = type;
+			face.m_Data.resize(static_cast<size_t>(size) * size * texelSize);
+			face.m_Mips.resize(levels - 1);
+			for (uint32_t level = 1; level < levels; level++)
+			{
+				uint32_t levelSize = std::max(size >> level, 1U);
+				face.m_Mips[level - 1].resize(static_cast<size_t>(levelSize) * levelSize * texelSize);
+			}
+		}
+	}
+
+	bool ProjectEquirectangular(const Texture2D& equirect, uint32_t size, TextureCubeMap& cubeMap)
+	{
+		if (equirect.m_Format != TextureFormat::RGBA || equirect.m_Type != TextureDataType::FLOAT || equirect.m_Data.empty() || size == 0)
+			return false;
+
+		AllocateCubeMap(cubeMap, size, 1);
+		cubeMap.m_MaxLevel = 1000; // Leave room for GenerateMipmaps.
+
+		const float* source = reinterpret_cast<const float*>(equirect.m_Data.data());
+		JobSystem::GetInstance()->ParallelFor(6 * size, [&](uint32_t row) {
+			uint32_t face   = row / size;
+			uint32_t y      = row % size;
+			float*   target = reinterpret_cast<float*>(cubeMap.m_Textures[face].m_Data.data()) + static_cast<size_t>(y) * size * 4;
+			for (uint32_t x = 0; x < size; x++)
+			{
+				glm::fvec3 direction = GetFaceDirection(face, 2.0f * (x + 0.5f) / size - 1.0f, 2.0f * (y + 0.5f) / size - 1.0f);
+				float      u         = std::atan2(direction.z, direction.x) / (2.0f * Pi) + 0.5f;
+				float      v         = std::acos(std::clamp(direction.y, -1.0f, 1.0f)) / Pi;
+				glm::fvec4 color     = SampleBilinear(source, equirect.m_Width, equirect.m_Height, u, v, true);
+				std::memcpy(target + x * 4, &color, 16);
+			}
+		});
+		return true;
+	}
+
+	// Evaluate the L2 spherical harmonics basis in the direction.
+	static void EvaluateBasis(const glm::fvec3& direction, float (&basis)[9])
+	{
+		basis[0] = 0.282095f;
+		basis[1] = 0.488603f * direction.y;
+		basis[2] = 0.488603f * direction.z;
+		basis[3] = 0.488603f * direction.x;
+		basis[4] = 1.092548f * direction.x * direction.y;
+		basis[5] = 1.092548f * direction.y * direction.z;
+		basis[6] = 0.315392f * (3.0f * direction.z * direction.z - 1.0f);
+		basis[7] = 1.092548f * direction.x * direction.z;
+		basis[8] = 0.546274f * (direction.x * direction.x - direction.y * direction.y);
+	}
+
+	void ComputeIrradiance(const TextureCubeMap& cubeMap, glm::fvec3 (&irradiance)[9])
+	{
+		uint32_t size = cubeMap.m_Width;
+		for (glm::fvec3& coefficient : irradiance)
+			coefficient = glm::fvec3(0.0f);
+		if (cubeMap.m_Format != TextureFormat::RGBA || cubeMap.m_Type != TextureDataType::FLOAT || size == 0)
+			return;
+
+		// Every row sums on its own, so the rows are summed up in order after and the result doesn't depend on the scheduling.
+		struct RowSum
+		{
+		public:
+			double m_Radiance[9][3] {};
+			double m_Weight = 0.0;
+		};
+		std::vector<RowSum> rows(6 * static_cast<size_t>(size));
+		JobSystem::GetInstance()->ParallelFor(6 * size, [&](uint32_t row) {
+			uint32_t     face   = row / size;
+			uint32_t     y      = row % size;
+			const float* source = reinterpret_cast<const float*>(cubeMap.m_Textures[face].m_Data.data()) + static_cast<size_t>(y) * size * 4;
+			RowSum&      sum    = rows[row];
+			for (uint32_t x = 0; x < size; x++)
+			{
+				float u = 2.0f * (x + 0.5f) / size - 1.0f;
+				float v = 2.0f * (y + 0.5f) / size - 1.0f;
+				// The solid angle of the texel, up to a constant factor which the total weight divides out.
+				float      distance  = 1.0f + u * u + v * v;
+				float      weight    = 1.0f / (distance * std::sqrt(distance));
+				glm::fvec3 direction = GetFaceDirection(face, u, v);
+
+				float basis[9];
+				EvaluateBasis(direction, basis);
+				for (uint32_t i = 0; i < 9; i++)
+					for (uint32_t c = 0; c < 3; c++)
+						sum.m_Radiance[i][c] += static_cast<double>(source[x * 4 + c]) * basis[i] * weight;
+				sum.m_Weight += weight;
+			}
+		});
+
+		RowSum total;
+		for (const RowSum& row : rows)
+		{
+			for (uint32_t i = 0; i < 9; i++)
+				for (uint32_t c = 0; c < 3; c++)
+					total.m_Radiance[i][c] += row.m_Radiance[i][c];
+			total.m_Weight += row.m_Weight;
+		}
+
+		// The cosine lobe's zonal harmonics for every band.
+		const double bands[9] = { Pi, 2.0 * Pi / 3.0, 2.0 * Pi / 3.0, 2.0 * Pi / 3.0, Pi / 4.0, Pi / 4.0, Pi / 4.0, Pi / 4.0, Pi / 4.0 };
+		double       scale    = 4.0 * Pi / total.m_Weight;
+		for (uint32_t i = 0; i < 9; i++)
+			for (uint32_t c = 0; c < 3; c++)
+				irradiance[i][c] = static_cast<float>(total.m_Radiance[i][c] * scale * bands[i]);
+	}
+
+	glm::fvec3 EvaluateIrradiance(const glm::fvec3 (&irradiance)[9], const glm::fvec3& normal)
+	{
+		float basis[9];
+		EvaluateBasis(normal, basis);
+		glm::fvec3 result(0.0f);
+		for (uint32_t i = 0; i < 9; i++)
+			result += irradiance[i] * basis[i];
+		return glm::max(result, glm::fvec3(0.0f));
+	}
+
+	// A GGX sample around the normal, shared by every texel of a level.
+	struct SpecularSample
+	{
+	public:
+		glm::fvec3 m_Direction; // The light direction in the space of the normal, which is +z.
+		float      m_Weight;    // The cosine of the light direction to the normal.
+		float      m_Lod;       // The source level the sample reads.
+	};
+
+	// Get the point of the Hammersley set.
+	static glm::fvec2 GetHammersleyPoint(uint32_t index, uint32_t count)
+	{
+		uint32_t bits = index;
+		bits          = (bits << 16) | (bits >> 16);
+		bits          = ((bits & 0x55555555U) << 1) | ((bits & 0xAAAAAAAAU) >> 1);
+		bits          = ((bits & 0x33333333U) << 2) | ((bits & 0xCCCCCCCCU) >> 2);
+		bits          = ((bits & 0x0F0F0F0FU) << 4) | ((bits & 0xF0F0F0F0U) >> 4);
+		bits          = ((bits & 0x00FF00FFU) << 8) | ((bits & 0xFF00FF00U) >> 8);
+		return { static_cast<float>(index) / count, static_cast<float>(bits) * 2.3283064365386963e-10f };
+	}
+
+	// Importance sample the GGX distribution of the roughness with the normal and view direction along +z.
+	// Every sample's level comes from the solid angle its probability covers against a texel of the source, which is filtered importance sampling.
+	static std::vector<SpecularSample> GetSpecularSamples(float roughness, uint32_t sampleCount, uint32_t sourceSize, uint32_t levelSize)
+	{
+		// Levels smaller than the source read the source level of their size at least, so they don't skip texels.
+		float baseLod = std::log2(static_cast<float>(sourceSize) / levelSize);
+		if (roughness <= 0.0f)
+			return { { { 0.0f, 0.0f, 1.0f }, 1.0f, baseLod } };
+
+		float alpha           = roughness * roughness;
+		float alpha2          = alpha * alpha;
+		float texelSolidAngle = 4.0f * Pi / (6.0f * sourceSize * sourceSize);
+
+		std::vector<SpecularSample> samples;
+		samples.reserve(sampleCount);
+		for (uint32_t i = 0; i < sampleCount; i++)
+		{
+			glm::fvec2 point    = GetHammersleyPoint(i, sampleCount);
+			float      phi      = 2.0f * Pi * point.x;
+			float      cosTheta = std::sqrt((1.0f - point.y) / (1.0f + (alpha2 - 1.0f) * point.y));
+			float      sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+			glm::fvec3 half     = { sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta };
+			glm::fvec3 light    = 2.0f * cosTheta * half - glm::fvec3(0.0f, 0.0f, 1.0f);
+			if (light.z <= 0.0f)
+				continue;
+
+			// With the view along the normal the probability of the light direction is D(h) / 4.
+			float denominator      = cosTheta * cosTheta * (alpha2 - 1.0f) + 1.0f;
+			float distribution     = alpha2 / (Pi * denominator * denominator);
+			float sampleSolidAngle = 1.0f / (sampleCount * distribution * 0.25f + 1e-6f);
+			float lod              = std::max(0.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.0f, baseLod);
+			samples.push_back({ light, light.z, lod });
+		}
+		return samples;
+	}
+
+	bool PrefilterSpecular(const TextureCubeMap& cubeMap, uint32_t size, uint32_t levels, uint32_t sampleCount, TextureCubeMap& specular)
+	{
+		if (cubeMap.m_Format != TextureFormat::RGBA || cubeMap.m_Type != TextureDataType::FLOAT || cubeMap.m_Width == 0 || size == 0 || levels == 0)
+			return false;
+
+		uint32_t maxLevels = 1;
+		while ((size >> maxLevels) > 0)
+			maxLevels++;
+		levels = std::min(levels, maxLevels);
+		AllocateCubeMap(specular, size, levels);
+
+		std::vector<CubeLevel> source = GetCubeLevels(cubeMap);
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			uint32_t                    levelSize = std::max(size >> level, 1U);
+			float                       roughness = levels > 1 ? static_cast<float>(level) / (levels - 1) : 0.0f;
+			std::vector<SpecularSample> samples   = GetSpecularSamples(roughness, std::max(sampleCount, 1U), cubeMap.m_Width, levelSize);
+			JobSystem::GetInstance()->ParallelFor(6 * levelSize, [&](uint32_t row) {
+				uint32_t   face    = row / levelSize;
+				uint32_t   y       = row % levelSize;
+				Texture2D& texture = specular.m_Textures[face];
+				float*     target  = reinterpret_cast<float*>(level == 0 ? texture.m_Data.data() : texture.m_Mips[level - 1].data()) + static_cast<size_t>(y) * levelSize * 4;
+				for (uint32_t x = 0; x < levelSize; x++)
+				{
+					glm::fvec3 normal    = GetFaceDirection(face, 2.0f * (x + 0.5f) / levelSize - 1.0f, 2.0f * (y + 0.5f) / levelSize - 1.0f);
+					glm::fvec3 up        = std::abs(normal.z) < 0.999f ? glm::fvec3(0.0f, 0.0f, 1.0f) : glm::fvec3(1.0f, 0.0f, 0.0f);
+					glm::fvec3 tangent   = glm::normalize(glm::cross(up, normal));
+					glm::fvec3 bitangent = glm::cross(normal, tangent);
+
+					glm::fvec3 color(0.0f);
+					float      weight = 0.0f;
+					for (const SpecularSample& sample : samples)
+					{
+						glm::fvec3 light = tangent * sample.m_Direction.x + bitangent * sample.m_Direction.y + normal * sample.m_Direction.z;
+						color += SampleCube(source, light, sample.m_Lod) * sample.m_Weight;
+						weight += sample.m_Weight;
+					}
+					color /= weight;
+					target[x * 4 + 0] = color.x;
+					target[x * 4 + 1] = color.y;
+					target[x * 4 + 2] = color.z;
+					target[x * 4 + 3] = 1.0f;
+				}
+			});
+		}
+		return true;
+	}
+
+	// Hash the bytes with 64 bit FNV-1a, continuing from the hash.
+	static uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 0xCBF29CE484222325ULL)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; i++)
+			hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+		return hash;
+	}
+
+	// Hash the file's bytes and the settings that change the results, returns false if the file couldn't be read.
+	static bool GetCacheKey(const std::string& file, const EnvironmentMapSettings& settings, uint64_t& key)
+	{
+		FILE* handle = fopen(file.c_str(), "rb");
+		if (!handle)
+			return false;
+
+		key = HashBytes(&environmentCache::Version, sizeof(environmentCache::Version));
+		std::vector<uint8_t> buffer(1 << 20);
+		size_t               read;
+		while ((read = fread(buffer.data(), 1, buffer.size(), handle)) > 0)
+			key = HashBytes(buffer.data(), read, key);
+		fclose(handle);
+
+		uint32_t values[4] { settings.m_CubeSize, settings.m_SpecularSize, settings.m_SpecularLevels, settings.m_SampleCount };
+		key = HashBytes(values, sizeof(values), key);
+		return true;
+	}
+
+	// Get the number of levels of the cube map.
+	static uint32_t GetCubeLevelCount(const TextureCubeMap& cubeMap)
+	{
+		return static_cast<uint32_t>(cubeMap.m_Textures[0].m_Mips.size()) + 1;
+	}
+
+	// Read or write every level of every face of the half float cube map.
+	static bool TransferCubeLevels(FILE* handle, TextureCubeMap& cubeMap, bool write)
+	{
+		for (Texture2D& face : cubeMap.m_Textures)
+		{
+			for (uint32_t level = 0; level <= face.m_Mips.size(); level++)
+			{
+				TextureData& data = level == 0 ? face.m_Data : face.m_Mips[level - 1];
+				size_t       done = write ? fwrite(data.data(), 1, data.size(), handle) : fread(data.data(), 1, data.size(), handle);
+				if (done != data.size())
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// Convert the float cube map and its levels to half floats.
+	static void ConvertCubeMapToHalf(TextureCubeMap& cubeMap)
+	{
+		for (Texture2D& face : cubeMap.m_Textures)
+			ConvertTexture(face, TextureFormat::RGBA, TextureDataType::HALF_FLOAT);
+		cubeMap.m_Type = TextureDataType::HALF_FLOAT;
+	}
+
+	// Read the cached results, returns nullptr if there are none for the key.
+	static std::unique_ptr<EnvironmentMap> ReadCache(const std::filesystem::path& path, uint64_t key)
+	{
+		FILE* handle = fopen(path.string().c_str(), "rb");
+		if (!handle)
+			return nullptr;
+
+		EnvironmentCacheHeader header;
+		bool                   valid = fread(&header, sizeof(header), 1, handle) == 1;
+		valid                        = valid && header.m_Magic == environmentCache::Magic && header.m_Version == environmentCache::Version && header.m_Key == key;
+		valid                        = valid && header.m_CubeSize > 0 && header.m_CubeLevels > 0 && header.m_CubeLevels <= 32;
+		valid                        = valid && header.m_SpecularSize > 0 && header.m_SpecularLevels > 0 && header.m_SpecularLevels <= 32;
+
+		std::unique_ptr<EnvironmentMap> environment;
+		if (valid)
+		{
+			environment                = std::make_unique<EnvironmentMap>();
+			environment->m_Environment = std::make_unique<TextureCubeMap>();
+			environment->m_Specular    = std::make_unique<TextureCubeMap>();
+			AllocateCubeMap(*environment->m_Environment, header.m_CubeSize, header.m_CubeLevels, TextureDataType::HALF_FLOAT);
+			AllocateCubeMap(*environment->m_Specular, header.m_SpecularSize, header.m_SpecularLevels, TextureDataType::HALF_FLOAT);
+			valid = TransferCubeLevels(handle, *environment->m_Environment, false) && TransferCubeLevels(handle, *environment->m_Specular, false);
+			for (uint32_t i = 0; i < 9; i++)
+				environment->m_Irradiance[i] = { header.m_Irradiance[i * 3], header.m_Irradiance[i * 3 + 1], header.m_Irradiance[i * 3 + 2] };
+		}
+		fclose(handle);
+
+		if (!valid)
+		{
+			s_EnvironmentMapLogger.LogWarning("Environment cache '%s' is stale or damaged, it is rebuilt", path.string().c_str());
+			return nullptr;
+		}
+		return environment;
+	}
+
+	// Write the results to the cache, failing to is only logged as they can be computed again.
+	static void WriteCache(const std::filesystem::path& path, uint64_t key, EnvironmentMap& environment)
+	{
+		std::error_code error;
+		std::filesystem::create_directories(path.parent_path(), error);
+
+		FILE* handle = fopen(path.string().c_str(), "wb");
+		if (!handle)
+		{
+			s_EnvironmentMapLogger.LogWarning("Failed to write environment cache '%s'", path.string().c_str());
+			return;
+		}
+
+		EnvironmentCacheHeader header;
+		header.m_Magic          = environmentCache::Magic;
+		header.m_Version        = environmentCache::Version;
+		header.m_Key            = key;
+		header.m_CubeSize       = environment.m_Environment->m_Width;
+		header.m_CubeLevels     = GetCubeLevelCount(*environment.m_Environment);
+		header.m_SpecularSize   = environment.m_Specular->m_Width;
+		header.m_SpecularLevels = GetCubeLevelCount(*environment.m_Specular);
+		for (uint32_t i = 0; i < 9; i++)
+			for (uint32_t c = 0; c < 3; c++)
+				header.m_Irradiance[i * 3 + c] = environment.m_Irradiance[i][c];
+
+		bool written = fwrite(&header, sizeof(header), 1, handle) == 1 && TransferCubeLevels(handle, *environment.m_Environment, true) && TransferCubeLevels(handle, *environment.m_Specular, true);
+		fclose(handle);
+		if (!written)
+		{
+			s_EnvironmentMapLogger.LogWarning("Failed to write environment cache '%s'", path.string().c_str());
+			std::filesystem::remove(path, error);
+		}
+	}
+
+	std::unique_ptr<EnvironmentMap> LoadEnvironmentMap(const std::string& file, const EnvironmentMapSettings& settings)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		uint64_t key;
+		if (!GetCacheKey(file, settings, key))
+		{
+			s_EnvironmentMapLogger.LogWarning("Failed to read environment map '%s'", file.c_str());
+			return nullptr;
+		}
+
+		std::filesystem::path cachePath;
+		if (!settings.m_CacheDirectory.empty())
+		{
+			char name[32];
+			std::snprintf(name, sizeof(name), "%016llx.env", static_cast<unsigned long long>(key));
+			cachePath = std::filesystem::path(settings.m_CacheDirectory) / name;
+
+			std::unique_ptr<EnvironmentMap> cached = ReadCache(cachePath, key);
+			if (cached)
+				return cached;
+		}
+
+		auto                                start    = Clock::now();
+		std::unique_ptr<texture::Texture2D> equirect = textureLoaders::LoadTexture2DLevels(file, ~0U, textureLoaders::TextureLoadMode::HDR);
+		if (!equirect)
+			return nullptr;
+		equirect->m_Mips.clear();
+		if (!ConvertTexture(*equirect, TextureFormat::RGBA, TextureDataType::FLOAT))
+		{
+			s_EnvironmentMapLogger.LogWarning("Environment map '%s' can't be converted to float rgba", file.c_str());
+			return nullptr;
+		}
+
+		std::unique_ptr<EnvironmentMap> environment = std::make_unique<EnvironmentMap>();
+		environment->m_Environment                  = std::make_unique<TextureCubeMap>();
+		environment->m_Specular                     = std::make_unique<TextureCubeMap>();
+		ProjectEquirectangular(*equirect, std::max(settings.m_CubeSize, 1U), *environment->m_Environment);
+		equirect.reset();
+		GenerateMipmaps(*environment->m_Environment);
+		auto projected = Clock::now();
+
+		ComputeIrradiance(*environment->m_Environment, environment->m_Irradiance);
+		auto irradiance = Clock::now();
+
+		PrefilterSpecular(*environment->m_Environment, std::max(settings.m_SpecularSize, 1U), settings.m_SpecularLevels, settings.m_SampleCount, *environment->m_Specular);
+		auto prefiltered = Clock::now();
+
+		ConvertCubeMapToHalf(*environment->m_Environment);
+		ConvertCubeMapToHalf(*environment->m_Specular);
+		s_EnvironmentMapLogger.LogDebug("Prefiltered '%s': projection %.1f ms, irradiance %.1f ms, specular %.1f ms on %u workers", file.c_str(),
+		                                std::chrono::duration<double, std::milli>(projected - start).count(),
+		                                std::chrono::duration<double, std::milli>(irradiance - projected).count(),
+		                                std::chrono::duration<double, std::milli>(prefiltered - irradiance).count(),
+		                                JobSystem::GetInstance()->GetWorkerCount() + 1);
+
+		if (!cachePath.empty())
+			WriteCache(cachePath, key, *environment);
+		return environment;
+	}
+
+} // namespace gp1::renderer::texture
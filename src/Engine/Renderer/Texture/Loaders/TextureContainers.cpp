@@ -0,0 +1,491 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/Loaders/TextureContainers.h"
+
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace gp1::renderer::textureLoaders
+{
+	static Logger s_TextureContainerLogger("Texture Container");
+
+	// A container's format code and the texture format it is read as.
+	struct ContainerFormat
+	{
+	public:
+		uint32_t                 m_Code;   // The DXGI or vulkan format.
+		texture::TextureFormat   m_Format; // The texture format.
+		texture::TextureDataType m_Type;   // The texture data type.
+	};
+
+	namespace dds
+	{
+		constexpr const uint32_t Magic         = 0x20534444; // "DDS ".
+		constexpr const uint32_t HeaderSize    = 124;        // The size of the header following the magic.
+		constexpr const uint32_t DX10FourCC    = 0x30315844; // "DX10".
+		constexpr const uint32_t DX10Size      = 20;         // The size of the DX10 header following the header.
+		constexpr const uint32_t FlagFourCC    = 0x4;        // The pixel format has a four character code.
+		constexpr const uint32_t FlagRGB       = 0x40;       // The pixel format has color masks.
+		constexpr const uint32_t FlagAlpha     = 0x1;        // The pixel format has an alpha mask.
+		constexpr const uint32_t FlagLuminance = 0x20000;    // The pixel format has a single luminance mask.
+		constexpr const uint32_t CapsCubeMap   = 0x200;      // The texture is a cube map.
+		constexpr const uint32_t CapsVolume    = 0x200000;   // The texture is a volume.
+		constexpr const uint32_t MiscCubeMap   = 0x4;        // The DX10 texture is a cube map.
+		constexpr const uint32_t Texture2D     = 3;          // The DX10 resource dimension of 2D textures.
+	}; // namespace dds
+
+	namespace ktx2
+	{
+		constexpr const uint32_t HeaderSize = 80; // The size of the identifier, header and index.
+		constexpr const uint32_t LevelSize  = 24; // The size of one entry of the level index.
+
+		// The identifier every KTX2 file starts with.
+		constexpr const uint8_t Identifier[12] { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+	}; // namespace ktx2
+
+	// The DXGI formats of DX10 DDS files, the first entry of a texture format is the one it is written as.
+	// Typeless formats are read as their unorm format.
+	static constexpr const ContainerFormat s_DXGIFormats[] {
+		{ 2, texture::TextureFormat::RGBA, texture::TextureDataType::FLOAT },
+		{ 10, texture::TextureFormat::RGBA, texture::TextureDataType::HALF_FLOAT },
+		{ 28, texture::TextureFormat::RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 29, texture::TextureFormat::RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 49, texture::TextureFormat::RG, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 61, texture::TextureFormat::RED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 87, texture::TextureFormat::BGRA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 71, texture::TextureFormat::BC1_RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 70, texture::TextureFormat::BC1_RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 72, texture::TextureFormat::BC1_SRGB_ALPHA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 74, texture::TextureFormat::BC2, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 73, texture::TextureFormat::BC2, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 75, texture::TextureFormat::BC2_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 77, texture::TextureFormat::BC3, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 76, texture::TextureFormat::BC3, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 78, texture::TextureFormat::BC3_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 80, texture::TextureFormat::BC4, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 79, texture::TextureFormat::BC4, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 81, texture::TextureFormat::BC4_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 83, texture::TextureFormat::BC5, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 82, texture::TextureFormat::BC5, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 84, texture::TextureFormat::BC5_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 95, texture::TextureFormat::BC6H, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 94, texture::TextureFormat::BC6H, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 96, texture::TextureFormat::BC6H_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 98, texture::TextureFormat::BC7, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 97, texture::TextureFormat::BC7, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 99, texture::TextureFormat::BC7_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		// DXGI has no opaque BC1 format, the blocks are the same so they are written as BC1 with alpha.
+		{ 71, texture::TextureFormat::BC1_RGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 72, texture::TextureFormat::BC1_SRGB, texture::TextureDataType::UNSIGNED_BYTE }
+	};
+
+	// The vulkan formats of KTX2 files, srgb formats without an srgb texture format are read as their unorm format.
+	static constexpr const ContainerFormat s_VulkanFormats[] {
+		{ 9, texture::TextureFormat::RED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 16, texture::TextureFormat::RG, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 23, texture::TextureFormat::RGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 37, texture::TextureFormat::RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 43, texture::TextureFormat::RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 44, texture::TextureFormat::BGRA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 50, texture::TextureFormat::BGRA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 97, texture::TextureFormat::RGBA, texture::TextureDataType::HALF_FLOAT },
+		{ 109, texture::TextureFormat::RGBA, texture::TextureDataType::FLOAT },
+		{ 131, texture::TextureFormat::BC1_RGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 132, texture::TextureFormat::BC1_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 133, texture::TextureFormat::BC1_RGBA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 134, texture::TextureFormat::BC1_SRGB_ALPHA, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 135, texture::TextureFormat::BC2, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 136, texture::TextureFormat::BC2_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 137, texture::TextureFormat::BC3, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 138, texture::TextureFormat::BC3_SRGB, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 139, texture::TextureFormat::BC4, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 140, texture::TextureFormat::BC4_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 141, texture::TextureFormat::BC5, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 142, texture::TextureFormat::BC5_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 143, texture::TextureFormat::BC6H, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 144, texture::TextureFormat::BC6H_SIGNED, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 145, texture::TextureFormat::BC7, texture::TextureDataType::UNSIGNED_BYTE },
+		{ 146, texture::TextureFormat::BC7_SRGB, texture::TextureDataType::UNSIGNED_BYTE }
+	};
+
+	// Find the format of the code, returns nullptr if it isn't supported.
+	template <size_t N>
+	static const ContainerFormat* FindFormat(const ContainerFormat (&formats)[N], uint32_t code)
+	{
+		for (const ContainerFormat& format : formats)
+			if (format.m_Code == code)
+				return &format;
+		return nullptr;
+	}
+
+	// Read a little endian value at the offset.
+	template <typename T>
+	static T Read(const std::vector<uint8_t>& bytes, size_t offset)
+	{
+		T value;
+		std::memcpy(&value, bytes.data() + offset, sizeof(T));
+		return value;
+	}
+
+	// Write a little endian value at the offset.
+	template <typename T>
+	static void Write(std::vector<uint8_t>& bytes, size_t offset, T value)
+	{
+		std::memcpy(bytes.data() + offset, &value, sizeof(T));
+	}
+
+	// Get the lower case extension of the file.
+	static std::string GetExtension(const std::string& file)
+	{
+		std::string extension = std::filesystem::path(file).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+		return extension;
+	}
+
+	// Get the width or height of the level.
+	static uint32_t GetLevelExtent(uint32_t size, uint32_t level)
+	{
+		return level < 32 ? std::max(size >> level, 1U) : 1U;
+	}
+
+	// Read the bytes at the offset of the file, returns the number of bytes read.
+	static size_t ReadRange(FILE* handle, uint64_t offset, void* data, size_t size)
+	{
+		if (fseek(handle, static_cast<long>(offset), SEEK_SET) != 0)
+			return 0;
+		return fread(data, 1, size, handle);
+	}
+
+	// Read a level of the texture from the offset if it isn't larger than the max size, larger levels are left empty.
+	// Returns false if the file is too short.
+	static bool ReadLevel(const std::string& file, FILE* handle, uint64_t offset, uint32_t level, uint32_t maxSize, texture::Texture2D& texture)
+	{
+		uint32_t              width  = GetLevelExtent(texture.m_Width, level);
+		uint32_t              height = GetLevelExtent(texture.m_Height, level);
+		texture::TextureData& data   = level == 0 ? texture.m_Data : texture.m_Mips[level - 1];
+		if (width > maxSize || height > maxSize)
+		{
+			data.clear();
+			return true;
+		}
+
+		uint64_t size = texture::GetImageSize(texture.m_Format, texture.m_Type, width, height);
+		data.resize(size);
+		if (ReadRange(handle, offset, data.data(), size) != size)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' ends in level %u", file.c_str(), level);
+			return false;
+		}
+		return true;
+	}
+
+	// Read the levels laid out one after another from the offset into the texture, returns false if the file is too short.
+	static bool ReadLevels(const std::string& file, FILE* handle, uint64_t offset, uint32_t levels, uint32_t maxSize, texture::Texture2D& texture)
+	{
+		texture.m_Mips.resize(levels - 1);
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			if (!ReadLevel(file, handle, offset, level, maxSize, texture))
+				return false;
+			offset += texture::GetImageSize(texture.m_Format, texture.m_Type, GetLevelExtent(texture.m_Width, level), GetLevelExtent(texture.m_Height, level));
+		}
+		return true;
+	}
+
+	// Get the format of a DDS file without a DX10 header from its pixel format, returns false if it isn't supported.
+	static bool GetLegacyDDSFormat(const std::vector<uint8_t>& bytes, texture::Texture2D& texture)
+	{
+		uint32_t flags    = Read<uint32_t>(bytes, 80);
+		uint32_t fourCC   = Read<uint32_t>(bytes, 84);
+		uint32_t bitCount = Read<uint32_t>(bytes, 88);
+		uint32_t redMask  = Read<uint32_t>(bytes, 92);
+		texture.m_Type    = texture::TextureDataType::UNSIGNED_BYTE;
+		if (flags & dds::FlagFourCC)
+		{
+			switch (fourCC)
+			{
+			case 0x31545844: // "DXT1".
+				texture.m_Format = texture::TextureFormat::BC1_RGBA;
+				return true;
+			case 0x33545844: // "DXT3".
+				texture.m_Format = texture::TextureFormat::BC2;
+				return true;
+			case 0x35545844: // "DXT5".
+				texture.m_Format = texture::TextureFormat::BC3;
+				return true;
+			case 0x31495441: // "ATI1".
+			case 0x55344342: // "BC4U".
+				texture.m_Format = texture::TextureFormat::BC4;
+				return true;
+			case 0x32495441: // "ATI2".
+			case 0x55354342: // "BC5U".
+				texture.m_Format = texture::TextureFormat::BC5;
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		if ((flags & dds::FlagRGB) && bitCount == 32 && (flags & dds::FlagAlpha))
+		{
+			texture.m_Format = redMask == 0xFF ? texture::TextureFormat::RGBA : texture::TextureFormat::BGRA;
+			return redMask == 0xFF || redMask == 0xFF0000;
+		}
+		if ((flags & dds::FlagRGB) && bitCount == 24)
+		{
+			texture.m_Format = redMask == 0xFF ? texture::TextureFormat::RGB : texture::TextureFormat::BGR;
+			return redMask == 0xFF || redMask == 0xFF0000;
+		}
+		if ((flags & dds::FlagLuminance) && bitCount == 8)
+		{
+			texture.m_Format = texture::TextureFormat::RED;
+			return true;
+		}
+		return false;
+	}
+
+	// Read the DDS file from the open handle.
+	static bool ReadDDSFile(const std::string& file, FILE* handle, texture::Texture2D& texture, uint32_t maxSize)
+	{
+		std::vector<uint8_t> bytes(4 + dds::HeaderSize + dds::DX10Size);
+		bytes.resize(ReadRange(handle, 0, bytes.data(), bytes.size()));
+		if (bytes.size() < 4 + dds::HeaderSize || Read<uint32_t>(bytes, 0) != dds::Magic || Read<uint32_t>(bytes, 4) != dds::HeaderSize)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' isn't a DDS file", file.c_str());
+			return false;
+		}
+
+		texture.m_Height = Read<uint32_t>(bytes, 12);
+		texture.m_Width  = Read<uint32_t>(bytes, 16);
+		uint32_t levels  = std::max(Read<uint32_t>(bytes, 28), 1U);
+		uint32_t caps2   = Read<uint32_t>(bytes, 112);
+		size_t   offset  = 4 + dds::HeaderSize;
+		if (caps2 & (dds::CapsCubeMap | dds::CapsVolume))
+		{
+			s_TextureContainerLogger.LogWarning("'%s' isn't a 2D texture", file.c_str());
+			return false;
+		}
+
+		bool supported;
+		if ((Read<uint32_t>(bytes, 80) & dds::FlagFourCC) && Read<uint32_t>(bytes, 84) == dds::DX10FourCC)
+		{
+			if (bytes.size() < offset + dds::DX10Size)
+			{
+				s_TextureContainerLogger.LogWarning("'%s' ends in the DX10 header", file.c_str());
+				return false;
+			}
+			if (Read<uint32_t>(bytes, offset + 4) != dds::Texture2D || (Read<uint32_t>(bytes, offset + 8) & dds::MiscCubeMap) || Read<uint32_t>(bytes, offset + 12) > 1)
+			{
+				s_TextureContainerLogger.LogWarning("'%s' isn't a 2D texture", file.c_str());
+				return false;
+			}
+
+			const ContainerFormat* format = FindFormat(s_DXGIFormats, Read<uint32_t>(bytes, offset));
+			supported                     = format != nullptr;
+			if (format)
+			{
+				texture.m_Format = format->m_Format;
+				texture.m_Type   = format->m_Type;
+			}
+			offset += dds::DX10Size;
+		}
+		else
+		{
+			supported = GetLegacyDDSFormat(bytes, texture);
+		}
+
+		if (!supported)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' has an unsupported pixel format", file.c_str());
+			return false;
+		}
+		return ReadLevels(file, handle, offset, levels, maxSize, texture);
+	}
+
+	// Read the KTX2 file from the open handle.
+	static bool ReadKTX2File(const std::string& file, FILE* handle, texture::Texture2D& texture, uint32_t maxSize)
+	{
+		std::vector<uint8_t> bytes(ktx2::HeaderSize);
+		bytes.resize(ReadRange(handle, 0, bytes.data(), bytes.size()));
+		if (bytes.size() < ktx2::HeaderSize || std::memcmp(bytes.data(), ktx2::Identifier, sizeof(ktx2::Identifier)) != 0)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' isn't a KTX2 file", file.c_str());
+			return false;
+		}
+
+		uint32_t vkFormat         = Read<uint32_t>(bytes, 12);
+		texture.m_Width           = Read<uint32_t>(bytes, 20);
+		texture.m_Height          = std::max(Read<uint32_t>(bytes, 24), 1U);
+		uint32_t depth            = Read<uint32_t>(bytes, 28);
+		uint32_t layers           = Read<uint32_t>(bytes, 32);
+		uint32_t faces            = Read<uint32_t>(bytes, 36);
+		uint32_t levels           = std::max(Read<uint32_t>(bytes, 40), 1U);
+		uint32_t supercompression = Read<uint32_t>(bytes, 44);
+		if (depth > 0 || layers > 1 || faces != 1)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' isn't a 2D texture", file.c_str());
+			return false;
+		}
+		if (supercompression != 0)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' is supercompressed, which isn't supported", file.c_str());
+			return false;
+		}
+
+		const ContainerFormat* format = FindFormat(s_VulkanFormats, vkFormat);
+		if (!format)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' has the unsupported vulkan format %u", file.c_str(), vkFormat);
+			return false;
+		}
+		texture.m_Format = format->m_Format;
+		texture.m_Type   = format->m_Type;
+
+		std::vector<uint8_t> index(static_cast<size_t>(levels) * ktx2::LevelSize);
+		if (ReadRange(handle, ktx2::HeaderSize, index.data(), index.size()) != index.size())
+		{
+			s_TextureContainerLogger.LogWarning("'%s' ends in the level index", file.c_str());
+			return false;
+		}
+
+		// The levels are usually stored smallest first, so each one is read from its own offset.
+		texture.m_Mips.resize(levels - 1);
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			size_t   entry  = static_cast<size_t>(level) * ktx2::LevelSize;
+			uint64_t offset = Read<uint64_t>(index, entry);
+			uint64_t length = Read<uint64_t>(index, entry + 8);
+			uint64_t size   = texture::GetImageSize(texture.m_Format, texture.m_Type, GetLevelExtent(texture.m_Width, level), GetLevelExtent(texture.m_Height, level));
+			if (length < size)
+			{
+				s_TextureContainerLogger.LogWarning("'%s' has an invalid level %u", file.c_str(), level);
+				return false;
+			}
+			if (!ReadLevel(file, handle, offset, level, maxSize, texture))
+				return false;
+		}
+		return true;
+	}
+
+	bool IsTextureContainer(const std::string& file)
+	{
+		std::string extension = GetExtension(file);
+		return extension == ".dds" || extension == ".ktx2";
+	}
+
+	bool ReadTextureContainer(const std::string& file, texture::Texture2D& texture, uint32_t maxSize)
+	{
+		std::string extension = GetExtension(file);
+		if (extension == ".dds")
+			return ReadDDS(file, texture, maxSize);
+		if (extension == ".ktx2")
+			return ReadKTX2(file, texture, maxSize);
+
+		s_TextureContainerLogger.LogWarning("'%s' isn't a texture container", file.c_str());
+		return false;
+	}
+
+	bool ReadDDS(const std::string& file, texture::Texture2D& texture, uint32_t maxSize)
+	{
+		FILE* handle = fopen(file.c_str(), "rb");
+		if (!handle)
+		{
+			s_TextureContainerLogger.LogWarning("Failed to open '%s'", file.c_str());
+			return false;
+		}
+
+		bool read = ReadDDSFile(file, handle, texture, maxSize);
+		fclose(handle);
+		return read;
+	}
+
+	bool ReadKTX2(const std::string& file, texture::Texture2D& texture, uint32_t maxSize)
+	{
+		FILE* handle = fopen(file.c_str(), "rb");
+		if (!handle)
+		{
+			s_TextureContainerLogger.LogWarning("Failed to open '%s'", file.c_str());
+			return false;
+		}
+
+		bool read = ReadKTX2File(file, handle, texture, maxSize);
+		fclose(handle);
+		return read;
+	}
+
+	bool WriteDDS(const std::string& file, const texture::Texture2D& texture)
+	{
+		const ContainerFormat* format = nullptr;
+		for (const ContainerFormat& dxgiFormat : s_DXGIFormats)
+		{
+			if (dxgiFormat.m_Format == texture.m_Format && (texture::IsCompressedFormat(texture.m_Format) || dxgiFormat.m_Type == texture.m_Type))
+			{
+				format = &dxgiFormat;
+				break;
+			}
+		}
+		if (!format)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' can't be written, its format has no DXGI format", file.c_str());
+			return false;
+		}
+
+		uint32_t levels = texture::GetStoredLevelCount(texture);
+		if (levels == 0)
+		{
+			s_TextureContainerLogger.LogWarning("'%s' can't be written, the texture has no data", file.c_str());
+			return false;
+		}
+
+		bool     compressed = texture::IsCompressedFormat(texture.m_Format);
+		uint32_t flags      = 0x1 | 0x2 | 0x4 | 0x1000 | (compressed ? 0x80000 : 0x8) | (levels > 1 ? 0x20000 : 0);
+		uint32_t pitch      = static_cast<uint32_t>(compressed ? texture.m_Data.size() : texture::GetImageSize(texture.m_Format, texture.m_Type, texture.m_Width, 1));
+
+		std::vector<uint8_t> header(4 + dds::HeaderSize + dds::DX10Size, 0);
+		Write<uint32_t>(header, 0, dds::Magic);
+		Write<uint32_t>(header, 4, dds::HeaderSize);
+		Write<uint32_t>(header, 8, flags);
+		Write<uint32_t>(header, 12, texture.m_Height);
+		Write<uint32_t>(header, 16, texture.m_Width);
+		Write<uint32_t>(header, 20, pitch);
+		Write<uint32_t>(header, 28, levels);
+		Write<uint32_t>(header, 76, 32);
+		Write<uint32_t>(header, 80, dds::FlagFourCC);
+		Write<uint32_t>(header, 84, dds::DX10FourCC);
+		Write<uint32_t>(header, 108, 0x1000 | (levels > 1 ? 0x400008 : 0));
+		Write<uint32_t>(header, 128, format->m_Code);
+		Write<uint32_t>(header, 132, dds::Texture2D);
+		Write<uint32_t>(header, 140, 1);
+
+		FILE* handle = fopen(file.c_str(), "wb");
+		if (!handle)
+		{
+			s_TextureContainerLogger.LogWarning("Failed to open '%s' for writing", file.c_str());
+			return false;
+		}
+
+		bool written = fwrite(header.data(), 1, header.size(), handle) == header.size();
+		for (uint32_t level = 0; level < levels && written; level++)
+		{
+			const texture::TextureData& data = level == 0 ? texture.m_Data : texture.m_Mips[level - 1];
+			uint64_t                    size = texture::GetImageSize(texture.m_Format, texture.m_Type, std::max(texture.m_Width >> level, 1U), std::max(texture.m_Height >> level, 1U));
+			written                          = fwrite(data.data(), 1, size, handle) == size;
+		}
+		fclose(handle);
+
+		if (!written)
+			s_TextureContainerLogger.LogWarning("Failed to write '%s'", file.c_str());
+		return written;
+	}
+
+} // namespace gp1::renderer::textureLoaders
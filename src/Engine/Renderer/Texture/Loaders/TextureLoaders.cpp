@@ -3,126 +3,314 @@
 //
 
 #include "Engine/Renderer/Texture/Loaders/TextureLoaders.h"
+#include "Engine/Renderer/Texture/Loaders/TextureContainers.h"
 
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
 #include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Renderer/Texture/Texture2DArray.h"
+#include "Engine/Renderer/Texture/TextureConversion.h"
+#include "Engine/Renderer/Texture/TextureCubeMap.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <stb/stb_image.h>
 #include <unordered_map>
 
 namespace gp1::renderer::textureLoaders
 {
-	std::unordered_map<std::string, texture::Texture2D*> s_Texture2Ds;
+	static Logger s_TextureLoaderLogger("Texture Loader");
 
-	texture::Texture2D* LoadTexture2D(std::string file, TextureLoadMode mode)
-	{
-		auto itr = s_Texture2Ds.find(file);
-		if (itr != s_Texture2Ds.end()) return itr->second;
+	using Texture2DLoad = std::shared_future<Texture2DReference>;
 
-		texture::Texture2D* tex = new texture::Texture2D();
+	static std::unordered_map<std::string, std::weak_ptr<const Texture2DLoad>> s_Texture2DLoads;     // The loads by file, alive while a handle to them is.
+	static std::mutex                                                          s_Texture2DLoadMutex; // The mutex guarding the loads.
 
-		int32_t width, height, nrChannels;
+	// Decode the image file, adopting the decoded pixels so they aren't copied.
+	static std::unique_ptr<texture::Texture2D> DecodeImage(const std::string& file, TextureLoadMode mode)
+	{
+		int32_t                  width, height, nrChannels;
+		void*                    data          = nullptr;
+		uint64_t                 componentSize = 1;
+		texture::TextureDataType type          = texture::TextureDataType::UNSIGNED_BYTE;
+		// Many drivers convert rgb uploads texel by texel, so images are decoded straight to rgba, which keeps stb's buffer adoptable.
+		// This also lets stb read the file once, instead of reading its header first to find the channel count.
+		constexpr int32_t channels = 4;
 		switch (mode)
 		{
 		case TextureLoadMode::NORMAL:
-		{
-			uint8_t* data = stbi_load(file.c_str(), &width, &height, &nrChannels, 0);
-			if (data)
-			{
-				uint64_t size = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(nrChannels);
-				tex->m_Data.resize(size);
-				for (uint64_t i = 0; i < size; i++)
-					tex->m_Data[i] = data[i];
-				tex->m_Width  = static_cast<uint32_t>(width);
-				tex->m_Height = static_cast<uint32_t>(height);
-				switch (nrChannels)
-				{
-				case 1:
-					tex->m_Format = texture::TextureFormat::RED;
-					break;
-				case 2:
-					tex->m_Format = texture::TextureFormat::RG;
-					break;
-				case 3:
-					tex->m_Format = texture::TextureFormat::RGB;
-					break;
-				case 4:
-					tex->m_Format = texture::TextureFormat::RGBA;
-					break;
-				}
-				s_Texture2Ds.insert({ file, tex });
-				return tex;
-			}
+			data = stbi_load(file.c_str(), &width, &height, &nrChannels, channels);
 			break;
-		}
 		case TextureLoadMode::HDR:
+			data          = stbi_loadf(file.c_str(), &width, &height, &nrChannels, channels);
+			componentSize = 4;
+			type          = texture::TextureDataType::FLOAT;
+			break;
+		case TextureLoadMode::BPC16:
+			data          = stbi_load_16(file.c_str(), &width, &height, &nrChannels, channels);
+			componentSize = 2;
+			type          = texture::TextureDataType::UNSIGNED_SHORT;
+			break;
+		}
+
+		if (!data)
+		{
+			s_TextureLoaderLogger.LogWarning("Failed to load texture '%s': %s", file.c_str(), stbi_failure_reason());
+			return nullptr;
+		}
+
+		std::unique_ptr<texture::Texture2D> tex  = std::make_unique<texture::Texture2D>();
+		uint64_t                            size = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(channels) * componentSize;
+		tex->m_Data.Adopt(data, size, stbi_image_free);
+		tex->m_Width  = static_cast<uint32_t>(width);
+		tex->m_Height = static_cast<uint32_t>(height);
+		tex->m_Format = texture::TextureFormat::RGBA;
+		tex->m_Type   = type;
+		return tex;
+	}
+
+	// Decode the file, texture containers are read as they are stored, so the load mode only applies to images.
+	// Levels wider or taller than the max size are left empty.
+	static std::unique_ptr<texture::Texture2D> DecodeTexture2D(const std::string& file, TextureLoadMode mode, uint32_t maxSize = ~0U)
+	{
+		std::unique_ptr<texture::Texture2D> tex;
+		bool                                isContainer = IsTextureContainer(file);
+		if (isContainer)
+		{
+			tex = std::make_unique<texture::Texture2D>();
+			if (!ReadTextureContainer(file, *tex, maxSize))
+				return nullptr;
+		}
+		else
+		{
+			tex = DecodeImage(file, mode);
+			if (!tex)
+				return nullptr;
+		}
+
+		// The mipmaps are built here on the loading thread, so uploading the texture is a plain copy of every level.
+		// Containers usually store their mipmaps already, and compressed textures can't have any generated.
+		if (texture::UsesMipmaps(tex->m_Filter.minimize) && tex->m_Mips.empty() && texture::CanGenerateMipmaps(tex->m_Format, tex->m_Type))
+			texture::GenerateMipmaps(*tex);
+
+		// Decoded hdr images are stored as half floats once their mipmaps are built, which halves their memory and upload.
+		if (!isContainer && tex->m_Type == texture::TextureDataType::FLOAT)
+			texture::ConvertTexture(*tex, tex->m_Format, texture::TextureDataType::HALF_FLOAT);
+
+		// Images can't be read a level at a time, so the levels that are too large are dropped after decoding. The last level is always kept.
+		for (uint32_t level = 0; level < tex->m_Mips.size(); level++)
+		{
+			if (std::max(tex->m_Width >> level, 1U) <= maxSize && std::max(tex->m_Height >> level, 1U) <= maxSize)
+				break;
+			(level == 0 ? tex->m_Data : tex->m_Mips[level - 1]).clear();
+		}
+		return tex;
+	}
+
+	// Decode the file and add it to the texture cache, an empty reference if it failed to load.
+	static Texture2DReference LoadIntoCache(const std::string& file, TextureLoadMode mode)
+	{
+		std::unique_ptr<texture::Texture2D> tex = DecodeTexture2D(file, mode);
+		if (!tex)
+			return {};
+		return texture::TextureCache::GetInstance()->Add(file, std::move(tex));
+	}
+
+	// Find the load of the file, loads that failed or have no handles left aren't returned so they can be retried.
+	// s_Texture2DLoadMutex has to be locked.
+	static std::shared_ptr<const Texture2DLoad> FindTexture2DLoad(const std::string& file)
+	{
+		auto itr = s_Texture2DLoads.find(file);
+		if (itr == s_Texture2DLoads.end())
+			return nullptr;
+
+		std::shared_ptr<const Texture2DLoad> load = itr->second.lock();
+		if (!load || (load->wait_for(std::chrono::seconds(0)) == std::future_status::ready && !load->get()))
 		{
-			float* data = stbi_loadf(file.c_str(), &width, &height, &nrChannels, 0);
-			if (data)
+			s_Texture2DLoads.erase(itr);
+			return nullptr;
+		}
+		return load;
+	}
+
+	// Drop the loads without handles left.
+	// s_Texture2DLoadMutex has to be locked.
+	static void CollectTexture2DLoads()
+	{
+		for (auto itr = s_Texture2DLoads.begin(); itr != s_Texture2DLoads.end();)
+		{
+			if (itr->second.expired())
+				itr = s_Texture2DLoads.erase(itr);
+			else
+				++itr;
+		}
+	}
+
+	TextureLoadHandle::TextureLoadHandle(std::shared_ptr<const std::shared_future<Texture2DReference>> load)
+	    : m_Load(std::move(load)) {}
+
+	bool TextureLoadHandle::IsValid() const
+	{
+		return this->m_Load && this->m_Load->valid();
+	}
+
+	bool TextureLoadHandle::IsReady() const
+	{
+		return IsValid() && this->m_Load->wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+
+	Texture2DReference TextureLoadHandle::Get() const
+	{
+		return IsValid() ? this->m_Load->get() : Texture2DReference();
+	}
+
+	uint32_t TextureLoadBatch::Add(std::string file, TextureLoadMode mode)
+	{
+		this->m_Handles.push_back(LoadTexture2DAsync(std::move(file), mode));
+		return static_cast<uint32_t>(this->m_Handles.size() - 1);
+	}
+
+	uint32_t TextureLoadBatch::GetCount() const
+	{
+		return static_cast<uint32_t>(this->m_Handles.size());
+	}
+
+	uint32_t TextureLoadBatch::GetReadyCount() const
+	{
+		uint32_t count = 0;
+		for (const TextureLoadHandle& handle : this->m_Handles)
+			if (handle.IsReady())
+				count++;
+		return count;
+	}
+
+	float TextureLoadBatch::GetProgress() const
+	{
+		if (this->m_Handles.empty())
+			return 1.0f;
+		return static_cast<float>(GetReadyCount()) / static_cast<float>(this->m_Handles.size());
+	}
+
+	bool TextureLoadBatch::IsDone() const
+	{
+		return GetReadyCount() == this->m_Handles.size();
+	}
+
+	void TextureLoadBatch::Wait() const
+	{
+		for (const TextureLoadHandle& handle : this->m_Handles)
+			handle.Get();
+	}
+
+	const TextureLoadHandle& TextureLoadBatch::GetHandle(uint32_t index) const
+	{
+		return this->m_Handles[index];
+	}
+
+	std::unique_ptr<texture::Texture2D> LoadTexture2DLevels(const std::string& file, uint32_t maxSize, TextureLoadMode mode)
+	{
+		return DecodeTexture2D(file, mode, maxSize);
+	}
+
+	// Decode the files as the layers of an array or cube map on the job system and convert them to one format and type.
+	// Layers of different formats become rgba, returns false if a file couldn't be loaded, the sizes differ or a layer can't be converted.
+	static bool DecodeLayers(const std::string* files, uint32_t count, TextureLoadMode mode, std::vector<std::unique_ptr<texture::Texture2D>>& layers)
+	{
+		layers.resize(count);
+		JobSystem::GetInstance()->ParallelFor(count, [&](uint32_t i) { layers[i] = DecodeTexture2D(files[i], mode); });
+		for (uint32_t i = 0; i < count; i++)
+			if (!layers[i])
+				return false;
+
+		texture::TextureFormat   format = layers[0]->m_Format;
+		texture::TextureDataType type   = layers[0]->m_Type;
+		for (uint32_t i = 1; i < count; i++)
+		{
+			if (layers[i]->m_Width != layers[0]->m_Width || layers[i]->m_Height != layers[0]->m_Height)
 			{
-				uint64_t size = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(nrChannels) * 4ULL;
-				tex->m_Data.resize(size);
-				uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
-				for (uint64_t i = 0; i < size; i++)
-					tex->m_Data[i] = bytes[i];
-				tex->m_Width  = static_cast<uint32_t>(width);
-				tex->m_Height = static_cast<uint32_t>(height);
-				tex->m_Type   = texture::TextureDataType::FLOAT;
-				switch (nrChannels)
-				{
-				case 1:
-					tex->m_Format = texture::TextureFormat::RED;
-					break;
-				case 2:
-					tex->m_Format = texture::TextureFormat::RG;
-					break;
-				case 3:
-					tex->m_Format = texture::TextureFormat::RGB;
-					break;
-				case 4:
-					tex->m_Format = texture::TextureFormat::RGBA;
-					break;
-				}
-				s_Texture2Ds.insert({ file, tex });
-				return tex;
+				s_TextureLoaderLogger.LogWarning("Layer '%s' is %ux%u, the first layer is %ux%u", files[i].c_str(), layers[i]->m_Width, layers[i]->m_Height, layers[0]->m_Width, layers[0]->m_Height);
+				return false;
 			}
-			break;
+			if (layers[i]->m_Format != format)
+				format = texture::TextureFormat::RGBA;
 		}
-		case TextureLoadMode::BPC16:
+
+		for (uint32_t i = 0; i < count; i++)
 		{
-			uint16_t* data = stbi_load_16(file.c_str(), &width, &height, &nrChannels, 0);
-			if (data)
+			if (!texture::ConvertTexture(*layers[i], format, type))
 			{
-				uint64_t size = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(nrChannels) * 2ULL;
-				tex->m_Data.resize(size);
-				uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
-				for (uint64_t i = 0; i < size; i++)
-					tex->m_Data[i] = bytes[i];
-				tex->m_Width  = static_cast<uint32_t>(width);
-				tex->m_Height = static_cast<uint32_t>(height);
-				tex->m_Type   = texture::TextureDataType::UNSIGNED_SHORT;
-				switch (nrChannels)
-				{
-				case 1:
-					tex->m_Format = texture::TextureFormat::RED;
-					break;
-				case 2:
-					tex->m_Format = texture::TextureFormat::RG;
-					break;
-				case 3:
-					tex->m_Format = texture::TextureFormat::RGB;
-					break;
-				case 4:
-					tex->m_Format = texture::TextureFormat::RGBA;
-					break;
-				}
-				s_Texture2Ds.insert({ file, tex });
-				return tex;
+				s_TextureLoaderLogger.LogWarning("Layer '%s' can't be converted to the format of the other layers", files[i].c_str());
+				return false;
 			}
-			break;
 		}
+		return true;
+	}
+
+	std::unique_ptr<texture::Texture2DArray> LoadTexture2DArray(const std::vector<std::string>& files, TextureLoadMode mode)
+	{
+		std::vector<std::unique_ptr<texture::Texture2D>> layers;
+		if (files.empty() || !DecodeLayers(files.data(), static_cast<uint32_t>(files.size()), mode, layers))
+			return nullptr;
+
+		std::unique_ptr<texture::Texture2DArray> tex = std::make_unique<texture::Texture2DArray>();
+		tex->m_Width                                 = layers[0]->m_Width;
+		tex->m_Height                                = layers[0]->m_Height;
+		tex->m_Format                                = layers[0]->m_Format;
+		tex->m_Type                                  = layers[0]->m_Type;
+		tex->m_Textures.resize(layers.size());
+		for (size_t i = 0; i < layers.size(); i++)
+		{
+			tex->m_Textures[i].m_Data = std::move(layers[i]->m_Data);
+			tex->m_Textures[i].m_Mips = std::move(layers[i]->m_Mips);
 		}
-		delete tex;
-		return nullptr;
+		return tex;
+	}
+
+	std::unique_ptr<texture::TextureCubeMap> LoadTextureCubeMap(const std::array<std::string, 6>& files, TextureLoadMode mode)
+	{
+		std::vector<std::unique_ptr<texture::Texture2D>> faces;
+		if (!DecodeLayers(files.data(), 6, mode, faces))
+			return nullptr;
+
+		std::unique_ptr<texture::TextureCubeMap> tex = std::make_unique<texture::TextureCubeMap>();
+		tex->m_Width                                 = faces[0]->m_Width;
+		tex->m_Height                                = faces[0]->m_Height;
+		tex->m_Format                                = faces[0]->m_Format;
+		tex->m_Type                                  = faces[0]->m_Type;
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			tex->m_Textures[i].m_Data = std::move(faces[i]->m_Data);
+			tex->m_Textures[i].m_Mips = std::move(faces[i]->m_Mips);
+		}
+		return tex;
+	}
+
+	TextureLoadHandle LoadTexture2DAsync(std::string file, TextureLoadMode mode)
+	{
+		std::lock_guard<std::mutex> lock(s_Texture2DLoadMutex);
+
+		std::shared_ptr<const Texture2DLoad> load = FindTexture2DLoad(file);
+		if (load)
+			return load;
+
+		Texture2DReference tex = texture::TextureCache::GetInstance()->Find<texture::Texture2D>(file);
+		if (tex)
+		{
+			// Already cached textures are handed out through a finished load so every handle looks the same.
+			std::promise<Texture2DReference> promise;
+			promise.set_value(std::move(tex));
+			load = std::make_shared<const Texture2DLoad>(promise.get_future().share());
+		}
+		else
+		{
+			load = std::make_shared<const Texture2DLoad>(JobSystem::GetInstance()->Submit([file, mode]() { return LoadIntoCache(file, mode); }).share());
+		}
+
+		CollectTexture2DLoads();
+		s_Texture2DLoads[file] = load;
+		return load;
 	}
 
 } // namespace gp1::renderer::textureLoaders
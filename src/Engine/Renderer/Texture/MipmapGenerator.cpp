@@ -0,0 +1,621 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Renderer/Texture/Texture2DArray.h"
+#include "Engine/Renderer/Texture/Texture3D.h"
+#include "Engine/Renderer/Texture/TextureCubeMap.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define GP1_MIPMAP_SSE
+	#include <emmintrin.h>
+#endif
+
+namespace gp1::renderer::texture
+{
+	// The layout of a texture's raw data.
+	struct MipFormat
+	{
+	public:
+		uint32_t        m_Channels      = 4;                              // The number of channels of every texel.
+		uint32_t        m_ComponentSize = 1;                              // The bytes of every channel.
+		TextureDataType m_Type          = TextureDataType::UNSIGNED_BYTE; // The type of every channel.
+		bool            m_HasAlpha      = true;                           // Is the fourth channel alpha.
+	};
+
+	// One level being filtered, every texel is four linear floats whatever the texture stores.
+	struct MipImage
+	{
+	public:
+		uint32_t           m_Extent[3] { 1, 1, 1 }; // The width, height and depth of the level.
+		std::vector<float> m_Texels;                // The texels, four floats each.
+	};
+
+	// The source texels and weights of every texel of the smaller level along one axis.
+	struct FilterKernel
+	{
+	public:
+		std::vector<uint32_t> m_Offsets; // The first tap of every texel, followed by one past the last tap.
+		std::vector<uint32_t> m_Indices; // The source texel of every tap.
+		std::vector<float>    m_Weights; // The weight of every tap.
+	};
+
+	static bool GetMipFormat(TextureFormat format, TextureDataType type, MipFormat& mipFormat)
+	{
+		switch (format)
+		{
+		case TextureFormat::RED:
+			mipFormat.m_Channels = 1;
+			break;
+		case TextureFormat::RG:
+			mipFormat.m_Channels = 2;
+			break;
+		case TextureFormat::RGB:
+		case TextureFormat::BGR:
+			mipFormat.m_Channels = 3;
+			break;
+		case TextureFormat::RGBA:
+		case TextureFormat::BGRA:
+			mipFormat.m_Channels = 4;
+			break;
+		default:
+			return false;
+		}
+
+		switch (type)
+		{
+		case TextureDataType::UNSIGNED_BYTE:
+			mipFormat.m_ComponentSize = 1;
+			break;
+		case TextureDataType::UNSIGNED_SHORT:
+			mipFormat.m_ComponentSize = 2;
+			break;
+		case TextureDataType::FLOAT:
+			mipFormat.m_ComponentSize = 4;
+			break;
+		default:
+			return false;
+		}
+		mipFormat.m_Type     = type;
+		mipFormat.m_HasAlpha = mipFormat.m_Channels == 4;
+		return true;
+	}
+
+	static float SRGBToLinear(float value)
+	{
+		return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	static float LinearToSRGB(float value)
+	{
+		return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	// Get the linear value of every 8 bit sRGB value.
+	static const float* GetSRGBTable()
+	{
+		static const std::array<float, 256> s_Table = []() {
+			std::array<float, 256> table {};
+			for (uint32_t i = 0; i < 256; i++)
+				table[i] = SRGBToLinear(static_cast<float>(i) / 255.0f);
+			return table;
+		}();
+		return s_Table.data();
+	}
+
+	static uint64_t GetTexelCount(const uint32_t extent[3])
+	{
+		return static_cast<uint64_t>(extent[0]) * extent[1] * extent[2];
+	}
+
+	// Get the number of levels down to 1x1, capped by the max level.
+	static uint32_t GetLevelCount(const uint32_t extent[3], uint32_t maxLevel)
+	{
+		uint32_t size   = std::max({ extent[0], extent[1], extent[2] });
+		uint32_t levels = 1;
+		while (size > 1 && levels <= maxLevel)
+		{
+			size >>= 1;
+			levels++;
+		}
+		return levels;
+	}
+
+	// Convert the raw texels to linear floats, channels the format doesn't have are 0 and a missing alpha is 1.
+	static void DecodeTexels(const uint8_t* data, const MipFormat& format, bool srgb, MipImage& image)
+	{
+		uint64_t count = GetTexelCount(image.m_Extent);
+		image.m_Texels.resize(count * 4);
+		float* texels = image.m_Texels.data();
+
+		if (format.m_Type == TextureDataType::UNSIGNED_BYTE)
+		{
+			const float* srgbTable = GetSRGBTable();
+			if (format.m_Channels == 4 && !srgb)
+			{
+#ifdef GP1_MIPMAP_SSE
+				const __m128i zero  = _mm_setzero_si128();
+				const __m128  scale = _mm_set1_ps(1.0f / 255.0f);
+				for (uint64_t i = 0; i < count; i++)
+				{
+					int32_t bytes;
+					std::memcpy(&bytes, data + i * 4, 4);
+					__m128i words  = _mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero);
+					__m128i dwords = _mm_unpacklo_epi16(words, zero);
+					_mm_storeu_ps(texels + i * 4, _mm_mul_ps(_mm_cvtepi32_ps(dwords), scale));
+				}
+				return;
+#endif
+			}
+
+			for (uint64_t i = 0; i < count; i++)
+			{
+				for (uint32_t c = 0; c < 4; c++)
+				{
+					float value = c == 3 ? 1.0f : 0.0f;
+					if (c < format.m_Channels)
+					{
+						uint8_t byte = data[i * format.m_Channels + c];
+						value        = srgb && !(format.m_HasAlpha && c == 3) ? srgbTable[byte] : byte / 255.0f;
+					}
+					texels[i * 4 + c] = value;
+				}
+			}
+			return;
+		}
+
+		for (uint64_t i = 0; i < count; i++)
+		{
+			for (uint32_t c = 0; c < 4; c++)
+			{
+				float value = c == 3 ? 1.0f : 0.0f;
+				if (c < format.m_Channels)
+				{
+					const uint8_t* component = data + (i * format.m_Channels + c) * format.m_ComponentSize;
+					if (format.m_Type == TextureDataType::UNSIGNED_SHORT)
+					{
+						uint16_t word;
+						std::memcpy(&word, component, 2);
+						value = word / 65535.0f;
+						if (srgb && !(format.m_HasAlpha && c == 3))
+							value = SRGBToLinear(value);
+					}
+					else
+					{
+						std::memcpy(&value, component, 4);
+					}
+				}
+				texels[i * 4 + c] = value;
+			}
+		}
+	}
+
+	// Convert the linear floats back to raw texels, scaling alpha by the given scale.
+	static void EncodeTexels(const MipImage& image, const MipFormat& format, bool srgb, float alphaScale, uint8_t* data)
+	{
+		uint64_t     count  = GetTexelCount(image.m_Extent);
+		const float* texels = image.m_Texels.data();
+
+		if (format.m_Type == TextureDataType::UNSIGNED_BYTE && format.m_Channels == 4 && !srgb)
+		{
+#ifdef GP1_MIPMAP_SSE
+			const __m128 zero    = _mm_setzero_ps();
+			const __m128 maximum = _mm_set1_ps(255.0f);
+			const __m128 scale   = _mm_setr_ps(255.0f, 255.0f, 255.0f, 255.0f * alphaScale);
+			const __m128 half    = _mm_set1_ps(0.5f);
+			for (uint64_t i = 0; i < count; i++)
+			{
+				__m128  value = _mm_mul_ps(_mm_loadu_ps(texels + i * 4), scale);
+				value         = _mm_min_ps(_mm_max_ps(value, zero), maximum);
+				__m128i ints  = _mm_cvttps_epi32(_mm_add_ps(value, half));
+				ints          = _mm_packs_epi32(ints, ints);
+				ints          = _mm_packus_epi16(ints, ints);
+				int32_t bytes = _mm_cvtsi128_si32(ints);
+				std::memcpy(data + i * 4, &bytes, 4);
+			}
+			return;
+#endif
+		}
+
+		for (uint64_t i = 0; i < count; i++)
+		{
+			for (uint32_t c = 0; c < format.m_Channels; c++)
+			{
+				bool  alpha = format.m_HasAlpha && c == 3;
+				float value = texels[i * 4 + c];
+				if (alpha)
+					value *= alphaScale;
+
+				uint8_t* component = data + (i * format.m_Channels + c) * format.m_ComponentSize;
+				if (format.m_Type == TextureDataType::FLOAT)
+				{
+					std::memcpy(component, &value, 4);
+					continue;
+				}
+
+				value = std::clamp(value, 0.0f, 1.0f);
+				if (srgb && !alpha)
+					value = LinearToSRGB(value);
+				if (format.m_Type == TextureDataType::UNSIGNED_BYTE)
+				{
+					*component = static_cast<uint8_t>(value * 255.0f + 0.5f);
+				}
+				else
+				{
+					uint16_t word = static_cast<uint16_t>(value * 65535.0f + 0.5f);
+					std::memcpy(component, &word, 2);
+				}
+			}
+		}
+	}
+
+	static float Sinc(float x)
+	{
+		if (std::abs(x) < 1e-6f)
+			return 1.0f;
+		x *= 3.14159265358979f;
+		return std::sin(x) / x;
+	}
+
+	// The modified bessel function of the first kind of order 0, used by the kaiser window.
+	static float BesselI0(float x)
+	{
+		float sum  = 1.0f;
+		float term = 1.0f;
+		float half = x * 0.5f;
+		for (uint32_t k = 1; k < 32; k++)
+		{
+			term *= (half / k) * (half / k);
+			sum += term;
+			if (term < sum * 1e-8f)
+				break;
+		}
+		return sum;
+	}
+
+	static float Kaiser(float t, float alpha)
+	{
+		if (std::abs(t) >= 1.0f)
+			return 0.0f;
+		return BesselI0(alpha * std::sqrt(1.0f - t * t)) / BesselI0(alpha);
+	}
+
+	// Build the taps of every texel of the smaller level, sampling past the edges either wraps or clamps.
+	static void BuildKernel(uint32_t sourceSize, uint32_t size, const MipmapSettings& settings, bool wrap, FilterKernel& kernel)
+	{
+		kernel.m_Offsets.clear();
+		kernel.m_Indices.clear();
+		kernel.m_Weights.clear();
+		kernel.m_Offsets.push_back(0);
+
+		float scale  = static_cast<float>(sourceSize) / static_cast<float>(size);
+		float radius = settings.m_Filter == MipmapFilter::BOX ? 0.5f * scale : std::max(settings.m_KaiserRadius, 0.5f) * scale;
+		for (uint32_t i = 0; i < size; i++)
+		{
+			float   center = (i + 0.5f) * scale;
+			int32_t first  = static_cast<int32_t>(std::floor(center - radius));
+			int32_t last   = static_cast<int32_t>(std::ceil(center + radius)) - 1;
+
+			size_t start = kernel.m_Weights.size();
+			float  total = 0.0f;
+			for (int32_t j = first; j <= last; j++)
+			{
+				float weight;
+				if (settings.m_Filter == MipmapFilter::BOX)
+				{
+					// The overlap of the source texel with the box covering the smaller level's texel.
+					weight = std::max(0.0f, std::min(j + 1.0f, center + radius) - std::max(static_cast<float>(j), center - radius));
+				}
+				else
+				{
+					float x = (j + 0.5f - center) / scale;
+					weight  = Sinc(x) * Kaiser(x / settings.m_KaiserRadius, settings.m_KaiserAlpha);
+				}
+				if (weight == 0.0f)
+					continue;
+
+				int32_t index;
+				if (wrap)
+					index = ((j % static_cast<int32_t>(sourceSize)) + static_cast<int32_t>(sourceSize)) % static_cast<int32_t>(sourceSize);
+				else
+					index = std::clamp(j, 0, static_cast<int32_t>(sourceSize) - 1);
+				kernel.m_Indices.push_back(static_cast<uint32_t>(index));
+				kernel.m_Weights.push_back(weight);
+				total += weight;
+			}
+
+			if (total != 0.0f)
+				for (size_t j = start; j < kernel.m_Weights.size(); j++)
+					kernel.m_Weights[j] /= total;
+			kernel.m_Offsets.push_back(static_cast<uint32_t>(kernel.m_Indices.size()));
+		}
+	}
+
+	// Resample the image along one axis, the taps are accumulated over whole rows so the texels are read in order.
+	static void ResampleAxis(const MipImage& source, uint32_t axis, const FilterKernel& kernel, MipImage& image)
+	{
+		uint32_t sourceSize = source.m_Extent[axis];
+		uint32_t size       = static_cast<uint32_t>(kernel.m_Offsets.size() - 1);
+
+		image.m_Extent[0]    = source.m_Extent[0];
+		image.m_Extent[1]    = source.m_Extent[1];
+		image.m_Extent[2]    = source.m_Extent[2];
+		image.m_Extent[axis] = size;
+		image.m_Texels.assign(GetTexelCount(image.m_Extent) * 4, 0.0f);
+
+		// The texels below the axis are contiguous and the ones above it are independent.
+		uint64_t inner = 1;
+		uint64_t outer = 1;
+		for (uint32_t i = 0; i < axis; i++)
+			inner *= source.m_Extent[i];
+		for (uint32_t i = axis + 1; i < 3; i++)
+			outer *= source.m_Extent[i];
+
+		if (inner == 1)
+		{
+			// Along the rows every texel is one register, so the taps are accumulated without going through memory.
+			for (uint64_t o = 0; o < outer; o++)
+			{
+				const float* sourceRow = source.m_Texels.data() + o * sourceSize * 4;
+				float*       row       = image.m_Texels.data() + o * size * 4;
+				for (uint32_t i = 0; i < size; i++)
+				{
+#ifdef GP1_MIPMAP_SSE
+					__m128 sum = _mm_setzero_ps();
+					for (uint32_t tap = kernel.m_Offsets[i]; tap < kernel.m_Offsets[i + 1]; tap++)
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(sourceRow + kernel.m_Indices[tap] * 4), _mm_set1_ps(kernel.m_Weights[tap])));
+					_mm_storeu_ps(row + i * 4, sum);
+#else
+					for (uint32_t tap = kernel.m_Offsets[i]; tap < kernel.m_Offsets[i + 1]; tap++)
+						for (uint32_t c = 0; c < 4; c++)
+							row[i * 4 + c] += sourceRow[kernel.m_Indices[tap] * 4 + c] * kernel.m_Weights[tap];
+#endif
+				}
+			}
+			return;
+		}
+
+		for (uint64_t o = 0; o < outer; o++)
+		{
+			const float* sourceBlock = source.m_Texels.data() + o * sourceSize * inner * 4;
+			for (uint32_t i = 0; i < size; i++)
+			{
+				float* row = image.m_Texels.data() + (o * size + i) * inner * 4;
+				for (uint32_t tap = kernel.m_Offsets[i]; tap < kernel.m_Offsets[i + 1]; tap++)
+				{
+					const float* sourceRow = sourceBlock + kernel.m_Indices[tap] * inner * 4;
+					float        weight    = kernel.m_Weights[tap];
+#ifdef GP1_MIPMAP_SSE
+					const __m128 weights = _mm_set1_ps(weight);
+					for (uint64_t j = 0; j < inner * 4; j += 4)
+						_mm_storeu_ps(row + j, _mm_add_ps(_mm_loadu_ps(row + j), _mm_mul_ps(_mm_loadu_ps(sourceRow + j), weights)));
+#else
+					for (uint64_t j = 0; j < inner * 4; j++)
+						row[j] += sourceRow[j] * weight;
+#endif
+				}
+			}
+		}
+	}
+
+	// Get the fraction of texels whose scaled alpha passes the cutoff.
+	static float GetAlphaCoverage(const std::vector<float>& alphas, float scale, float cutoff)
+	{
+		uint64_t covered = 0;
+		for (float alpha : alphas)
+			if (alpha * scale > cutoff)
+				covered++;
+		return alphas.empty() ? 0.0f : static_cast<float>(covered) / static_cast<float>(alphas.size());
+	}
+
+	static void GetAlphas(const MipImage& image, std::vector<float>& alphas)
+	{
+		alphas.resize(image.m_Texels.size() / 4);
+		for (size_t i = 0; i < alphas.size(); i++)
+			alphas[i] = image.m_Texels[i * 4 + 3];
+	}
+
+	// Find the alpha scale that gives the level the coverage of the base level.
+	// Filtering blurs alpha towards its average, so without this alpha tested cutouts thin out or vanish in the distance.
+	static float FindAlphaScale(const std::vector<float>& alphas, float coverage, float cutoff)
+	{
+		float low  = 0.0f;
+		float high = 16.0f;
+		for (uint32_t i = 0; i < 24; i++)
+		{
+			float scale = (low + high) * 0.5f;
+			if (GetAlphaCoverage(alphas, scale, cutoff) < coverage)
+				low = scale;
+			else
+				high = scale;
+		}
+		// Coverage only changes in steps of whole texels, so the bound closest to the base level's coverage is used.
+		return std::abs(GetAlphaCoverage(alphas, low, cutoff) - coverage) < std::abs(GetAlphaCoverage(alphas, high, cutoff) - coverage) ? low : high;
+	}
+
+	// Decode the base level, filter it down to the level count and store every smaller level in the mips.
+	template <typename T>
+	static bool GenerateLevels(const uint8_t* data, uint64_t size, const uint32_t extent[3], TextureFormat textureFormat, TextureDataType type, uint32_t maxLevel, const MipmapSettings& settings, const bool wrap[3], std::vector<T>& mips)
+	{
+		MipFormat format;
+		if (!GetMipFormat(textureFormat, type, format))
+			return false;
+
+		uint64_t texelSize = static_cast<uint64_t>(format.m_Channels) * format.m_ComponentSize;
+		if (!data || GetTexelCount(extent) == 0 || size < GetTexelCount(extent) * texelSize)
+			return false;
+
+		bool     srgb = settings.m_SRGB && type != TextureDataType::FLOAT;
+		MipImage image;
+		std::copy(extent, extent + 3, image.m_Extent);
+		DecodeTexels(data, format, srgb, image);
+
+		bool               preserveCoverage = settings.m_PreserveAlphaCoverage && format.m_HasAlpha;
+		std::vector<float> alphas;
+		float              coverage = 0.0f;
+		if (preserveCoverage)
+		{
+			GetAlphas(image, alphas);
+			coverage = GetAlphaCoverage(alphas, 1.0f, settings.m_AlphaCutoff);
+		}
+
+		uint32_t levels = GetLevelCount(extent, maxLevel);
+		mips.clear();
+		mips.resize(levels - 1);
+
+		MipImage     scratch;
+		FilterKernel kernel;
+		for (uint32_t level = 1; level < levels; level++)
+		{
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				uint32_t sourceSize = image.m_Extent[axis];
+				uint32_t axisSize   = std::max(sourceSize >> 1, 1U);
+				if (axisSize == sourceSize)
+					continue;
+
+				BuildKernel(sourceSize, axisSize, settings, wrap[axis], kernel);
+				ResampleAxis(image, axis, kernel, scratch);
+				std::swap(image, scratch);
+			}
+
+			// The scale is only applied to the stored level, the next level is filtered from the unscaled alpha.
+			float alphaScale = 1.0f;
+			if (preserveCoverage)
+			{
+				GetAlphas(image, alphas);
+				alphaScale = FindAlphaScale(alphas, coverage, settings.m_AlphaCutoff);
+			}
+
+			T& mip = mips[level - 1];
+			mip.resize(GetTexelCount(image.m_Extent) * texelSize);
+			EncodeTexels(image, format, srgb, alphaScale, mip.data());
+		}
+		return true;
+	}
+
+	// Count the base level and the stored mipmaps following it whose sizes match it.
+	// The sizes are counted in whole blocks for compressed formats, so mipmaps read from a container are counted too.
+	template <typename T>
+	static uint32_t CountStoredLevels(uint64_t baseSize, const T* mips, size_t mipCount, const uint32_t baseExtent[3], TextureFormat textureFormat, TextureDataType type)
+	{
+		if (baseSize == 0)
+			return 0;
+
+		uint32_t extent[3] { baseExtent[0], baseExtent[1], baseExtent[2] };
+		if (baseSize < GetImageSize(textureFormat, type, extent[0], extent[1], extent[2]))
+			return 0;
+
+		uint32_t count = 1;
+		for (size_t i = 0; i < mipCount; i++)
+		{
+			for (uint32_t& size : extent)
+				size = std::max(size >> 1, 1U);
+			if (mips[i].size() != GetImageSize(textureFormat, type, extent[0], extent[1], extent[2]))
+				break;
+			count++;
+		}
+		return count;
+	}
+
+	bool UsesMipmaps(TextureFilter filter)
+	{
+		return filter == TextureFilter::NEAREST_MIPMAP_NEAREST || filter == TextureFilter::NEAREST_MIPMAP_LINEAR || filter == TextureFilter::LINEAR_MIPMAP_NEAREST || filter == TextureFilter::LINEAR_MIPMAP_LINEAR;
+	}
+
+	bool CanGenerateMipmaps(TextureFormat format, TextureDataType type)
+	{
+		MipFormat mipFormat;
+		return GetMipFormat(format, type, mipFormat);
+	}
+
+	bool GenerateMipmaps(Texture2D& texture, const MipmapSettings& settings)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		bool     wrap[3] { texture.m_Wrapping.s == TextureWrapping::REPEAT, texture.m_Wrapping.t == TextureWrapping::REPEAT, false };
+		return GenerateLevels(texture.m_Data.data(), texture.m_Data.size(), extent, texture.m_Format, texture.m_Type, texture.m_MaxLevel, settings, wrap, texture.m_Mips);
+	}
+
+	bool GenerateMipmaps(Texture2DArray& texture, const MipmapSettings& settings)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		bool     wrap[3] { texture.m_Wrapping.s == TextureWrapping::REPEAT, texture.m_Wrapping.t == TextureWrapping::REPEAT, false };
+		if (texture.m_Textures.empty())
+			return false;
+
+		for (Texture2D& layer : texture.m_Textures)
+			if (!GenerateLevels(layer.m_Data.data(), layer.m_Data.size(), extent, texture.m_Format, texture.m_Type, texture.m_MaxLevel, settings, wrap, layer.m_Mips))
+				return false;
+		return true;
+	}
+
+	bool GenerateMipmaps(Texture3D& texture, const MipmapSettings& settings)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, texture.m_Depth };
+		bool     wrap[3] { texture.m_Wrapping.s == TextureWrapping::REPEAT, texture.m_Wrapping.t == TextureWrapping::REPEAT, texture.m_Wrapping.r == TextureWrapping::REPEAT };
+		return GenerateLevels(texture.m_Data.data(), texture.m_Data.size(), extent, texture.m_Format, texture.m_Type, texture.m_MaxLevel, settings, wrap, texture.m_Mips);
+	}
+
+	bool GenerateMipmaps(TextureCubeMap& texture, const MipmapSettings& settings)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		bool     wrap[3] { false, false, false };
+		for (Texture2D& face : texture.m_Textures)
+			if (!GenerateLevels(face.m_Data.data(), face.m_Data.size(), extent, texture.m_Format, texture.m_Type, texture.m_MaxLevel, settings, wrap, face.m_Mips))
+				return false;
+		return true;
+	}
+
+	uint32_t GetStoredLevelCount(const Texture2D& texture)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		return CountStoredLevels(texture.m_Data.size(), texture.m_Mips.data(), texture.m_Mips.size(), extent, texture.m_Format, texture.m_Type);
+	}
+
+	uint32_t GetStoredLevelCount(const Texture2DArray& texture)
+	{
+		if (texture.m_Textures.empty())
+			return 0;
+
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		uint32_t count = ~0U;
+		for (const Texture2D& layer : texture.m_Textures)
+			count = std::min(count, CountStoredLevels(layer.m_Data.size(), layer.m_Mips.data(), layer.m_Mips.size(), extent, texture.m_Format, texture.m_Type));
+		return count;
+	}
+
+	uint32_t GetStoredLevelCount(const Texture3D& texture)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, texture.m_Depth };
+		return CountStoredLevels(texture.m_Data.size(), texture.m_Mips.data(), texture.m_Mips.size(), extent, texture.m_Format, texture.m_Type);
+	}
+
+	uint32_t GetStoredLevelCount(const TextureCubeMap& texture)
+	{
+		uint32_t extent[3] { texture.m_Width, texture.m_Height, 1 };
+		uint32_t count = ~0U;
+		for (const Texture2D& face : texture.m_Textures)
+			count = std::min(count, CountStoredLevels(face.m_Data.size(), face.m_Mips.data(), face.m_Mips.size(), extent, texture.m_Format, texture.m_Type));
+		return count;
+	}
+
+	uint32_t GetStoredLevelCount(const Texture2D& texture, uint32_t firstLevel)
+	{
+		if (firstLevel == 0)
+			return GetStoredLevelCount(texture);
+		if (firstLevel > texture.m_Mips.size() || firstLevel >= 32)
+			return 0;
+
+		uint32_t extent[3] { std::max(texture.m_Width >> firstLevel, 1U), std::max(texture.m_Height >> firstLevel, 1U), 1 };
+		return CountStoredLevels(texture.m_Mips[firstLevel - 1].size(), texture.m_Mips.data() + firstLevel, texture.m_Mips.size() - firstLevel, extent, texture.m_Format, texture.m_Type);
+	}
+
+} // namespace gp1::renderer::texture
@@ -24,6 +24,21 @@ namespace gp1::renderer::texture
 		return this->m_Dirty;
 	}
 
+	void Texture2D::MarkSamplerDirty()
+	{
+		this->m_SamplerDirty = this->m_Editable;
+	}
+
+	void Texture2D::ClearSamplerDirty()
+	{
+		this->m_SamplerDirty = false;
+	}
+
+	bool Texture2D::IsSamplerDirty()
+	{
+		return this->m_SamplerDirty;
+	}
+
 	bool Texture2D::IsEditable()
 	{
 		return this->m_Editable;
@@ -34,4 +49,9 @@ namespace gp1::renderer::texture
 		return this->m_IsDynamic;
 	}
 
+	void Texture2D::SetDynamic(bool dynamic)
+	{
+		this->m_IsDynamic = dynamic;
+	}
+
 } // namespace gp1::renderer::texture
@@ -34,4 +34,9 @@ namespace gp1::renderer::texture
 		return this->m_IsDynamic;
 	}
 
+	void Texture3D::SetDynamic(bool dynamic)
+	{
+		this->m_IsDynamic = dynamic;
+	}
+
 } // namespace gp1::renderer::texture
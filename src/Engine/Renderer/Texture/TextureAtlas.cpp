@@ -0,0 +1,371 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureAtlas.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_TextureAtlasLogger("Texture Atlas");
+
+	// Round the value up to a multiple of the alignment, which is a power of two.
+	static uint32_t AlignUp(uint32_t value, uint32_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	// Get the data of the level of the texture.
+	static TextureData& GetLevelData(Texture2D& texture, uint32_t level)
+	{
+		return level == 0 ? texture.m_Data : texture.m_Mips[level - 1];
+	}
+
+	bool TextureAtlasRegion::IsValid() const
+	{
+		return this->m_Texture;
+	}
+
+	TextureAtlas::TextureAtlas(const TextureAtlasSettings& settings)
+	    : m_Settings(settings)
+	{
+		uint32_t pageSize = 1;
+		while (pageSize < this->m_Settings.m_PageSize && pageSize < (1U << 15))
+			pageSize <<= 1;
+		if (pageSize != this->m_Settings.m_PageSize)
+			s_TextureAtlasLogger.LogWarning("Page size %u isn't a power of two, using %u", this->m_Settings.m_PageSize, pageSize);
+		this->m_Settings.m_PageSize = pageSize;
+
+		uint32_t maxLevels = 1;
+		while ((pageSize >> maxLevels) > 0)
+			maxLevels++;
+		this->m_Settings.m_MipLevels = std::clamp(this->m_Settings.m_MipLevels, 1U, maxLevels);
+
+		// A texel of the last level covers this many texels of the first, so rectangles on multiples of it keep every level of a region
+		// in texels of its own. Bilinear filtering reads half a texel past the edge, which takes a texel of gutter at the last level.
+		this->m_Alignment = 1U << (this->m_Settings.m_MipLevels - 1);
+		this->m_Gutter    = AlignUp(std::max(this->m_Settings.m_Padding, this->m_Settings.m_MipLevels > 1 ? this->m_Alignment : 0U), this->m_Alignment);
+	}
+
+	TextureAtlas::~TextureAtlas()
+	{
+		Clear();
+	}
+
+	TextureAtlasRegion TextureAtlas::Add(const Texture2D& texture)
+	{
+		TextureAtlasRegion region;
+		if (texture.m_Format != this->m_Settings.m_Format || texture.m_Type != this->m_Settings.m_Type || IsCompressedFormat(texture.m_Format))
+		{
+			s_TextureAtlasLogger.LogWarning("Textures added have to match the format and type of the atlas");
+			return region;
+		}
+
+		uint32_t pixelSize = GetPixelSize(texture.m_Format, texture.m_Type);
+		if (texture.m_Width == 0 || texture.m_Height == 0 || texture.m_Data.size() < static_cast<size_t>(texture.m_Width) * texture.m_Height * pixelSize)
+		{
+			s_TextureAtlasLogger.LogWarning("Textures added have to have data");
+			return region;
+		}
+
+		uint32_t mipLevels = this->m_Settings.m_MipLevels;
+		if (mipLevels > 1 && !CanGenerateMipmaps(texture.m_Format, texture.m_Type))
+		{
+			s_TextureAtlasLogger.LogWarning("Can't generate mipmaps for the format of the atlas");
+			return region;
+		}
+
+		uint32_t gutter = this->m_Gutter;
+		uint32_t width  = AlignUp(texture.m_Width + 2 * gutter, this->m_Alignment);
+		uint32_t height = AlignUp(texture.m_Height + 2 * gutter, this->m_Alignment);
+		if (width > this->m_Settings.m_PageSize || height > this->m_Settings.m_PageSize)
+		{
+			s_TextureAtlasLogger.LogWarning("Texture of %ux%u doesn't fit on a page of %u with its gutter", texture.m_Width, texture.m_Height, this->m_Settings.m_PageSize);
+			return region;
+		}
+
+		uint32_t x = 0, y = 0;
+		uint32_t pageIndex = 0;
+		while (pageIndex < this->m_Pages.size() && !Place(this->m_Pages[pageIndex], width, height, x, y))
+			pageIndex++;
+		if (pageIndex == this->m_Pages.size())
+			Place(AddPage(), width, height, x, y);
+		Page& page = this->m_Pages[pageIndex];
+
+		// The texture is laid out with its gutter on its own and its levels are generated there, so no filter reads texels of other regions.
+		// The levels are then copied onto the page's levels, which they line up with as the rectangle is aligned.
+		Texture2D padded;
+		padded.m_Width      = width;
+		padded.m_Height     = height;
+		padded.m_Format     = texture.m_Format;
+		padded.m_Type       = texture.m_Type;
+		padded.m_Wrapping.s = TextureWrapping::CLAMP_TO_EDGE;
+		padded.m_Wrapping.t = TextureWrapping::CLAMP_TO_EDGE;
+		padded.m_MaxLevel   = mipLevels - 1;
+		padded.m_Data.resize(static_cast<size_t>(width) * height * pixelSize);
+		for (uint32_t row = 0; row < height; row++)
+		{
+			uint32_t       sourceRow = std::min(row > gutter ? row - gutter : 0U, texture.m_Height - 1);
+			const uint8_t* source    = texture.m_Data.data() + static_cast<size_t>(sourceRow) * texture.m_Width * pixelSize;
+			uint8_t*       target    = padded.m_Data.data() + static_cast<size_t>(row) * width * pixelSize;
+			for (uint32_t column = 0; column < gutter; column++)
+				std::memcpy(target + column * pixelSize, source, pixelSize);
+			std::memcpy(target + gutter * pixelSize, source, static_cast<size_t>(texture.m_Width) * pixelSize);
+			for (uint32_t column = gutter + texture.m_Width; column < width; column++)
+				std::memcpy(target + column * pixelSize, source + (texture.m_Width - 1) * pixelSize, pixelSize);
+		}
+		if (mipLevels > 1)
+			GenerateMipmaps(padded, this->m_Settings.m_Mipmaps);
+
+		for (uint32_t level = 0; level < mipLevels; level++)
+		{
+			uint32_t     pageSize    = this->m_Settings.m_PageSize >> level;
+			uint32_t     levelWidth  = width >> level;
+			uint32_t     levelHeight = height >> level;
+			TextureData& source      = GetLevelData(padded, level);
+			TextureData& target      = GetLevelData(*page.m_Texture, level);
+			for (uint32_t row = 0; row < levelHeight; row++)
+				std::memcpy(target.data() + ((static_cast<size_t>((y >> level) + row) * pageSize + (x >> level)) * pixelSize), source.data() + static_cast<size_t>(row) * levelWidth * pixelSize, static_cast<size_t>(levelWidth) * pixelSize);
+		}
+		page.m_UsedTexels += static_cast<uint64_t>(width) * height;
+		page.m_Changed = true;
+
+		float pageSize       = static_cast<float>(this->m_Settings.m_PageSize);
+		region.m_Texture     = page.m_Texture.get();
+		region.m_Page        = pageIndex;
+		region.m_X           = x + gutter;
+		region.m_Y           = y + gutter;
+		region.m_Width       = texture.m_Width;
+		region.m_Height      = texture.m_Height;
+		region.m_UVTransform = { region.m_Width / pageSize, region.m_Height / pageSize, region.m_X / pageSize, region.m_Y / pageSize };
+		return region;
+	}
+
+	void TextureAtlas::Update()
+	{
+		for (Page& page : this->m_Pages)
+		{
+			if (page.m_Changed)
+			{
+				page.m_Texture->MarkDirty();
+				page.m_Changed = false;
+			}
+		}
+	}
+
+	void TextureAtlas::Clear()
+	{
+		this->m_Pages.clear();
+	}
+
+	uint32_t TextureAtlas::GetPageCount() const
+	{
+		return static_cast<uint32_t>(this->m_Pages.size());
+	}
+
+	Texture2D* TextureAtlas::GetPage(uint32_t page) const
+	{
+		return page < this->m_Pages.size() ? this->m_Pages[page].m_Texture.get() : nullptr;
+	}
+
+	float TextureAtlas::GetPageOccupancy(uint32_t page) const
+	{
+		if (page >= this->m_Pages.size())
+			return 0.0f;
+		return static_cast<float>(static_cast<double>(this->m_Pages[page].m_UsedTexels) / (static_cast<double>(this->m_Settings.m_PageSize) * this->m_Settings.m_PageSize));
+	}
+
+	const TextureAtlasSettings& TextureAtlas::GetSettings() const
+	{
+		return this->m_Settings;
+	}
+
+	TextureAtlas::Page& TextureAtlas::AddPage()
+	{
+		uint32_t pageSize  = this->m_Settings.m_PageSize;
+		uint32_t pixelSize = GetPixelSize(this->m_Settings.m_Format, this->m_Settings.m_Type);
+
+		Page& page     = this->m_Pages.emplace_back();
+		page.m_Texture = std::make_unique<Texture2D>();
+
+		Texture2D& texture        = *page.m_Texture;
+		texture.m_Width           = pageSize;
+		texture.m_Height          = pageSize;
+		texture.m_Format          = this->m_Settings.m_Format;
+		texture.m_Type            = this->m_Settings.m_Type;
+		texture.m_Wrapping.s      = TextureWrapping::CLAMP_TO_EDGE;
+		texture.m_Wrapping.t      = TextureWrapping::CLAMP_TO_EDGE;
+		texture.m_Filter.minimize = this->m_Settings.m_MipLevels > 1 ? TextureFilter::LINEAR_MIPMAP_LINEAR : TextureFilter::LINEAR;
+		texture.m_MaxLevel        = this->m_Settings.m_MipLevels - 1;
+		texture.m_Data.resize(static_cast<size_t>(pageSize) * pageSize * pixelSize);
+		texture.m_Mips.resize(this->m_Settings.m_MipLevels - 1);
+		for (uint32_t level = 1; level < this->m_Settings.m_MipLevels; level++)
+			texture.m_Mips[level - 1].resize(static_cast<size_t>(pageSize >> level) * (pageSize >> level) * pixelSize);
+		texture.SetDynamic(true);
+
+		page.m_FreeRects.push_back({ 0, 0, pageSize, pageSize });
+		page.m_Skyline.push_back({ 0, 0, pageSize });
+		return page;
+	}
+
+	bool TextureAtlas::Place(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		switch (this->m_Settings.m_Packing)
+		{
+		case AtlasPacking::MAX_RECTS: return PlaceMaxRects(page, width, height, x, y);
+		case AtlasPacking::SKYLINE: return PlaceSkyline(page, width, height, x, y);
+		default: return false;
+		}
+	}
+
+	bool TextureAtlas::PlaceMaxRects(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		// Best short side fit, ties go to the best long side fit.
+		uint32_t bestShortSide = std::numeric_limits<uint32_t>::max();
+		uint32_t bestLongSide  = std::numeric_limits<uint32_t>::max();
+		size_t   bestRect      = page.m_FreeRects.size();
+		for (size_t i = 0; i < page.m_FreeRects.size(); i++)
+		{
+			const Rect& rect = page.m_FreeRects[i];
+			if (rect.m_Width < width || rect.m_Height < height)
+				continue;
+
+			uint32_t shortSide = std::min(rect.m_Width - width, rect.m_Height - height);
+			uint32_t longSide  = std::max(rect.m_Width - width, rect.m_Height - height);
+			if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+			{
+				bestShortSide = shortSide;
+				bestLongSide  = longSide;
+				bestRect      = i;
+			}
+		}
+		if (bestRect == page.m_FreeRects.size())
+			return false;
+
+		Rect placed { page.m_FreeRects[bestRect].m_X, page.m_FreeRects[bestRect].m_Y, width, height };
+		x = placed.m_X;
+		y = placed.m_Y;
+
+		// Split every free rectangle the placed one overlaps into the maximal rectangles around it.
+		std::vector<Rect> split;
+		for (size_t i = 0; i < page.m_FreeRects.size();)
+		{
+			Rect rect = page.m_FreeRects[i];
+			if (placed.m_X >= rect.m_X + rect.m_Width || placed.m_X + placed.m_Width <= rect.m_X ||
+			    placed.m_Y >= rect.m_Y + rect.m_Height || placed.m_Y + placed.m_Height <= rect.m_Y)
+			{
+				i++;
+				continue;
+			}
+
+			if (placed.m_X > rect.m_X)
+				split.push_back({ rect.m_X, rect.m_Y, placed.m_X - rect.m_X, rect.m_Height });
+			if (placed.m_X + placed.m_Width < rect.m_X + rect.m_Width)
+				split.push_back({ placed.m_X + placed.m_Width, rect.m_Y, rect.m_X + rect.m_Width - placed.m_X - placed.m_Width, rect.m_Height });
+			if (placed.m_Y > rect.m_Y)
+				split.push_back({ rect.m_X, rect.m_Y, rect.m_Width, placed.m_Y - rect.m_Y });
+			if (placed.m_Y + placed.m_Height < rect.m_Y + rect.m_Height)
+				split.push_back({ rect.m_X, placed.m_Y + placed.m_Height, rect.m_Width, rect.m_Y + rect.m_Height - placed.m_Y - placed.m_Height });
+
+			page.m_FreeRects[i] = page.m_FreeRects.back();
+			page.m_FreeRects.pop_back();
+		}
+		page.m_FreeRects.insert(page.m_FreeRects.end(), split.begin(), split.end());
+
+		// Drop the free rectangles contained in others.
+		auto contains = [](const Rect& outer, const Rect& inner) -> bool {
+			return inner.m_X >= outer.m_X && inner.m_Y >= outer.m_Y &&
+			       inner.m_X + inner.m_Width <= outer.m_X + outer.m_Width && inner.m_Y + inner.m_Height <= outer.m_Y + outer.m_Height;
+		};
+		for (size_t i = 0; i < page.m_FreeRects.size(); i++)
+		{
+			for (size_t j = i + 1; j < page.m_FreeRects.size();)
+			{
+				if (contains(page.m_FreeRects[i], page.m_FreeRects[j]))
+				{
+					page.m_FreeRects.erase(page.m_FreeRects.begin() + j);
+				}
+				else if (contains(page.m_FreeRects[j], page.m_FreeRects[i]))
+				{
+					page.m_FreeRects.erase(page.m_FreeRects.begin() + i);
+					j = i + 1;
+				}
+				else
+				{
+					j++;
+				}
+			}
+		}
+		return true;
+	}
+
+	bool TextureAtlas::PlaceSkyline(Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		// Bottom left, the lowest place the rectangle fits at, ties go to the leftmost.
+		uint32_t                  pageSize = this->m_Settings.m_PageSize;
+		std::vector<SkylineNode>& skyline  = page.m_Skyline;
+		uint32_t                  bestY    = std::numeric_limits<uint32_t>::max();
+		size_t                    bestNode = skyline.size();
+		for (size_t i = 0; i < skyline.size() && skyline[i].m_X + width <= pageSize; i++)
+		{
+			uint32_t top  = 0;
+			uint32_t left = width;
+			for (size_t j = i; left > 0; j++)
+			{
+				top = std::max(top, skyline[j].m_Y);
+				if (skyline[j].m_Width >= left)
+					break;
+				left -= skyline[j].m_Width;
+			}
+			if (top + height <= pageSize && top < bestY)
+			{
+				bestY    = top;
+				bestNode = i;
+			}
+		}
+		if (bestNode == skyline.size())
+			return false;
+
+		x = skyline[bestNode].m_X;
+		y = bestY;
+
+		// Raise the skyline under the rectangle and trim the nodes it covers.
+		skyline.insert(skyline.begin() + bestNode, { x, y + height, width });
+		for (size_t i = bestNode + 1; i < skyline.size();)
+		{
+			uint32_t end = x + width;
+			if (skyline[i].m_X >= end)
+				break;
+
+			uint32_t covered = end - skyline[i].m_X;
+			if (covered >= skyline[i].m_Width)
+			{
+				skyline.erase(skyline.begin() + i);
+				continue;
+			}
+			skyline[i].m_X += covered;
+			skyline[i].m_Width -= covered;
+			break;
+		}
+
+		for (size_t i = 0; i + 1 < skyline.size();)
+		{
+			if (skyline[i].m_Y == skyline[i + 1].m_Y)
+			{
+				skyline[i].m_Width += skyline[i + 1].m_Width;
+				skyline.erase(skyline.begin() + i + 1);
+			}
+			else
+			{
+				i++;
+			}
+		}
+		return true;
+	}
+
+} // namespace gp1::renderer::texture
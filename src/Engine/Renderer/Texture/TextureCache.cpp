@@ -0,0 +1,283 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureCache.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Renderer/Texture/Texture2DArray.h"
+#include "Engine/Renderer/Texture/Texture3D.h"
+#include "Engine/Renderer/Texture/TextureCubeMap.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_TextureCacheLogger("Texture Cache");
+
+	std::atomic<uint64_t> TextureCache::s_Clock { 0 };
+
+	// Get the bytes of one texel as the opengl textures store it, they always use four components unless they are depth textures.
+	static uint64_t GetTexelBytes(TextureFormat format, TextureDataType type)
+	{
+		if (format == TextureFormat::DEPTH_COMPONENT || format == TextureFormat::DEPTH_STENCIL)
+			return 4;
+
+		switch (type)
+		{
+		case TextureDataType::BYTE:
+		case TextureDataType::UNSIGNED_BYTE:
+		case TextureDataType::UNSIGNED_BYTE_3_3_2:
+		case TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
+			return 4;
+		case TextureDataType::SHORT:
+		case TextureDataType::UNSIGNED_SHORT:
+		case TextureDataType::HALF_FLOAT:
+		case TextureDataType::UNSIGNED_SHORT_5_6_5:
+		case TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
+		case TextureDataType::UNSIGNED_SHORT_4_4_4_4:
+		case TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
+		case TextureDataType::UNSIGNED_SHORT_5_5_5_1:
+		case TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
+			return 8;
+		default:
+			return 16;
+		}
+	}
+
+	// Get the bytes of every level, the depth is only halved per level if it is a 3D texture's.
+	// Compressed levels are stored as they are, uncompressed texels take the bytes opengl stores them in.
+	static uint64_t GetLevelBytes(TextureFormat format, TextureDataType type, uint32_t width, uint32_t height, uint32_t depth, bool mipmaps, bool mipmapDepth)
+	{
+		bool     compressed = IsCompressedFormat(format);
+		uint64_t bytes      = 0;
+		while (true)
+		{
+			if (compressed)
+				bytes += GetImageSize(format, type, width, height, depth);
+			else
+				bytes += static_cast<uint64_t>(width) * height * depth * GetTexelBytes(format, type);
+			if (!mipmaps || (width <= 1 && height <= 1 && (!mipmapDepth || depth <= 1)))
+				break;
+
+			width  = std::max(width / 2, 1U);
+			height = std::max(height / 2, 1U);
+			if (mipmapDepth)
+				depth = std::max(depth / 2, 1U);
+		}
+		return bytes;
+	}
+
+	uint64_t GetTextureCPUBytes(Texture2D& texture)
+	{
+		uint64_t bytes = texture.m_Data.size();
+		for (const TextureData& mip : texture.m_Mips)
+			bytes += mip.size();
+		return bytes;
+	}
+
+	uint64_t GetTextureCPUBytes(Texture2DArray& texture)
+	{
+		uint64_t bytes = 0;
+		for (Texture2D& layer : texture.m_Textures)
+			bytes += GetTextureCPUBytes(layer);
+		return bytes;
+	}
+
+	uint64_t GetTextureCPUBytes(Texture3D& texture)
+	{
+		uint64_t bytes = texture.m_Data.size();
+		for (const std::vector<uint8_t>& mip : texture.m_Mips)
+			bytes += mip.size();
+		return bytes;
+	}
+
+	uint64_t GetTextureCPUBytes(TextureCubeMap& texture)
+	{
+		uint64_t bytes = 0;
+		for (Texture2D& face : texture.m_Textures)
+			bytes += GetTextureCPUBytes(face);
+		return bytes;
+	}
+
+	uint64_t GetTextureGPUBytes(Texture2D& texture)
+	{
+		if (!texture.HasRendererData() || texture.IsDirty())
+			return 0;
+		// Only the levels from the base level on are allocated.
+		bool     mipmaps   = UsesMipmaps(texture.m_Filter.minimize);
+		uint32_t baseLevel = mipmaps ? std::min(texture.m_BaseLevel, 31U) : 0;
+		return GetLevelBytes(texture.m_Format, texture.m_Type, std::max(texture.m_Width >> baseLevel, 1U), std::max(texture.m_Height >> baseLevel, 1U), 1, mipmaps, false);
+	}
+
+	uint64_t GetTextureGPUBytes(Texture2DArray& texture)
+	{
+		if (!texture.HasRendererData() || texture.IsDirty())
+			return 0;
+		return GetLevelBytes(texture.m_Format, texture.m_Type, texture.m_Width, texture.m_Height, static_cast<uint32_t>(texture.m_Textures.size()), UsesMipmaps(texture.m_Filter.minimize), false);
+	}
+
+	uint64_t GetTextureGPUBytes(Texture3D& texture)
+	{
+		if (!texture.HasRendererData() || texture.IsDirty())
+			return 0;
+		return GetLevelBytes(texture.m_Format, texture.m_Type, texture.m_Width, texture.m_Height, texture.m_Depth, UsesMipmaps(texture.m_Filter.minimize), true);
+	}
+
+	uint64_t GetTextureGPUBytes(TextureCubeMap& texture)
+	{
+		if (!texture.HasRendererData() || texture.IsDirty())
+			return 0;
+		return GetLevelBytes(texture.m_Format, texture.m_Type, texture.m_Width, texture.m_Height, 6, UsesMipmaps(texture.m_Filter.minimize), false);
+	}
+
+	TextureCache::~TextureCache()
+	{
+		if (!this->m_Entries.empty())
+			s_TextureCacheLogger.LogWarning("%u textures were still cached on shutdown", GetTextureCount());
+	}
+
+	void TextureCache::SetBudget(uint64_t cpuBytes, uint64_t gpuBytes)
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		this->m_CPUBudget = cpuBytes;
+		this->m_GPUBudget = gpuBytes;
+	}
+
+	void TextureCache::Trim()
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+		this->m_CPUBytes = 0;
+		this->m_GPUBytes = 0;
+		for (auto& [name, entry] : this->m_Entries)
+		{
+			entry->m_CPUBytes = entry->m_GetCPUBytes(entry->m_Texture.get());
+			entry->m_GPUBytes = entry->m_GetGPUBytes(entry->m_Texture.get());
+			this->m_CPUBytes += entry->m_CPUBytes;
+			this->m_GPUBytes += entry->m_GPUBytes;
+		}
+
+		if (this->m_CPUBytes > this->m_CPUBudget || this->m_GPUBytes > this->m_GPUBudget)
+			Evict(false);
+		else
+			this->m_OverBudget = false;
+	}
+
+	void TextureCache::Clear()
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		Evict(true);
+	}
+
+	uint64_t TextureCache::GetCPUBytes() const
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		return this->m_CPUBytes;
+	}
+
+	uint64_t TextureCache::GetGPUBytes() const
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		return this->m_GPUBytes;
+	}
+
+	uint32_t TextureCache::GetTextureCount() const
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		return static_cast<uint32_t>(this->m_Entries.size());
+	}
+
+	uint64_t TextureCache::GetEvictionCount() const
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+		return this->m_EvictionCount;
+	}
+
+	TextureCache* TextureCache::GetInstance()
+	{
+		static TextureCache s_Instance;
+		return &s_Instance;
+	}
+
+	void TextureCache::AddReference(TextureCacheEntry* entry)
+	{
+		entry->m_References++;
+		entry->m_LastUse = ++TextureCache::s_Clock;
+	}
+
+	void TextureCache::RemoveReference(TextureCacheEntry* entry)
+	{
+		entry->m_LastUse = ++TextureCache::s_Clock;
+		entry->m_References--;
+	}
+
+	TextureCacheEntry* TextureCache::AddEntry(const std::string& name, std::unique_ptr<Data> texture, TextureCacheEntry::ByteCounter getCPUBytes, TextureCacheEntry::ByteCounter getGPUBytes)
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+		auto itr = this->m_Entries.find(name);
+		if (itr != this->m_Entries.end())
+		{
+			TextureCacheEntry* entry = itr->second.get();
+			if (entry->m_Texture->GetType() != texture->GetType())
+				return nullptr;
+			AddReference(entry);
+			return entry;
+		}
+
+		std::unique_ptr<TextureCacheEntry> entry = std::make_unique<TextureCacheEntry>();
+		entry->m_Name                            = name;
+		entry->m_Texture                         = std::move(texture);
+		entry->m_GetCPUBytes                     = getCPUBytes;
+		entry->m_GetGPUBytes                     = getGPUBytes;
+		entry->m_CPUBytes                        = getCPUBytes(entry->m_Texture.get());
+		this->m_CPUBytes += entry->m_CPUBytes;
+		AddReference(entry.get());
+		return this->m_Entries.insert({ name, std::move(entry) }).first->second.get();
+	}
+
+	TextureCacheEntry* TextureCache::FindEntry(const std::string& name, const std::type_info& type)
+	{
+		std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+		auto itr = this->m_Entries.find(name);
+		if (itr == this->m_Entries.end() || itr->second->m_Texture->GetType() != type)
+			return nullptr;
+
+		AddReference(itr->second.get());
+		return itr->second.get();
+	}
+
+	void TextureCache::Evict(bool all)
+	{
+		std::vector<TextureCacheEntry*> candidates;
+		for (auto& [name, entry] : this->m_Entries)
+			if (entry->m_References == 0)
+				candidates.push_back(entry.get());
+		std::sort(candidates.begin(), candidates.end(), [](TextureCacheEntry* lhs, TextureCacheEntry* rhs) { return lhs->m_LastUse < rhs->m_LastUse; });
+
+		// References are only added with the mutex locked, so an unreferenced texture can't be picked up while it is evicted.
+		uint32_t evicted = 0;
+		for (TextureCacheEntry* entry : candidates)
+		{
+			if (!all && this->m_CPUBytes <= this->m_CPUBudget && this->m_GPUBytes <= this->m_GPUBudget)
+				break;
+
+			this->m_CPUBytes -= std::min(this->m_CPUBytes, entry->m_CPUBytes);
+			this->m_GPUBytes -= std::min(this->m_GPUBytes, entry->m_GPUBytes);
+			this->m_Entries.erase(entry->m_Name);
+			evicted++;
+		}
+		this->m_EvictionCount += evicted;
+
+		// Only the first trim that can't meet the budgets warns, so it isn't repeated every frame.
+		bool overBudget = this->m_CPUBytes > this->m_CPUBudget || this->m_GPUBytes > this->m_GPUBudget;
+		if (!all && overBudget && !this->m_OverBudget)
+			s_TextureCacheLogger.LogWarning("The referenced textures take %llu cpu and %llu gpu bytes, over the budgets of %llu and %llu bytes", static_cast<unsigned long long>(this->m_CPUBytes), static_cast<unsigned long long>(this->m_GPUBytes), static_cast<unsigned long long>(this->m_CPUBudget), static_cast<unsigned long long>(this->m_GPUBudget));
+		this->m_OverBudget = overBudget;
+	}
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,104 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureCommon.h"
+
+namespace gp1::renderer::texture
+{
+	bool IsCompressedFormat(TextureFormat format)
+	{
+		return GetBlockSize(format) > 0;
+	}
+
+	uint32_t GetBlockSize(TextureFormat format)
+	{
+		switch (format)
+		{
+		case TextureFormat::BC1_RGB:
+		case TextureFormat::BC1_RGBA:
+		case TextureFormat::BC1_SRGB:
+		case TextureFormat::BC1_SRGB_ALPHA:
+		case TextureFormat::BC4:
+		case TextureFormat::BC4_SIGNED:
+			return 8;
+		case TextureFormat::BC2:
+		case TextureFormat::BC2_SRGB:
+		case TextureFormat::BC3:
+		case TextureFormat::BC3_SRGB:
+		case TextureFormat::BC5:
+		case TextureFormat::BC5_SIGNED:
+		case TextureFormat::BC6H:
+		case TextureFormat::BC6H_SIGNED:
+		case TextureFormat::BC7:
+		case TextureFormat::BC7_SRGB:
+			return 16;
+		default:
+			return 0;
+		}
+	}
+
+	uint32_t GetPixelSize(TextureFormat format, TextureDataType type)
+	{
+		uint32_t componentSize;
+		switch (type)
+		{
+		case TextureDataType::UNSIGNED_BYTE_3_3_2:
+		case TextureDataType::UNSIGNED_BYTE_2_3_3_REV:
+			return 1;
+		case TextureDataType::UNSIGNED_SHORT_5_6_5:
+		case TextureDataType::UNSIGNED_SHORT_5_6_5_REV:
+		case TextureDataType::UNSIGNED_SHORT_4_4_4_4:
+		case TextureDataType::UNSIGNED_SHORT_4_4_4_4_REV:
+		case TextureDataType::UNSIGNED_SHORT_5_5_5_1:
+		case TextureDataType::UNSIGNED_SHORT_1_5_5_5_REV:
+			return 2;
+		case TextureDataType::UNSIGNED_INT_8_8_8_8:
+		case TextureDataType::UNSIGNED_INT_8_8_8_8_REV:
+		case TextureDataType::UNSIGNED_INT_10_10_10_2:
+		case TextureDataType::UNSIGNED_INT_2_10_10_10_REV:
+			return 4;
+		case TextureDataType::SHORT:
+		case TextureDataType::UNSIGNED_SHORT:
+		case TextureDataType::HALF_FLOAT:
+			componentSize = 2;
+			break;
+		case TextureDataType::INT:
+		case TextureDataType::UNSIGNED_INT:
+		case TextureDataType::FLOAT:
+			componentSize = 4;
+			break;
+		default:
+			componentSize = 1;
+		}
+
+		switch (format)
+		{
+		case TextureFormat::RED:
+		case TextureFormat::RED_INTEGER:
+		case TextureFormat::STENCIL_INDEX:
+		case TextureFormat::DEPTH_COMPONENT:
+			return componentSize;
+		case TextureFormat::RG:
+		case TextureFormat::RG_INTEGER:
+		case TextureFormat::DEPTH_STENCIL:
+			return componentSize * 2;
+		case TextureFormat::RGB:
+		case TextureFormat::RGB_INTEGER:
+		case TextureFormat::BGR:
+		case TextureFormat::BGR_INTEGER:
+			return componentSize * 3;
+		default:
+			return componentSize * 4;
+		}
+	}
+
+	uint64_t GetImageSize(TextureFormat format, TextureDataType type, uint32_t width, uint32_t height, uint32_t depth)
+	{
+		uint32_t blockSize = GetBlockSize(format);
+		if (blockSize > 0)
+			return static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4) * depth * blockSize;
+		return static_cast<uint64_t>(width) * height * depth * GetPixelSize(format, type);
+	}
+
+} // namespace gp1::renderer::texture
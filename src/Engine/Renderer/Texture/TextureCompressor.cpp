@@ -0,0 +1,644 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureCompressor.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_TextureCompressorLogger("Texture Compressor");
+
+	// The rgba texels of one 4x4 block, row by row.
+	using BlockTexels = uint8_t[16][4];
+
+	// The interpolation weights of BC7's 4 bit indices out of 64.
+	static constexpr const uint32_t s_BC7Weights[16] { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	// Read one texel of unsigned byte data as rgba, missing channels read like opengl samples them.
+	static void ReadTexel(const uint8_t* texel, TextureFormat format, uint8_t rgba[4])
+	{
+		rgba[0] = texel[0];
+		rgba[1] = 0;
+		rgba[2] = 0;
+		rgba[3] = 255;
+		switch (format)
+		{
+		case TextureFormat::RG:
+			rgba[1] = texel[1];
+			break;
+		case TextureFormat::RGB:
+			rgba[1] = texel[1];
+			rgba[2] = texel[2];
+			break;
+		case TextureFormat::BGR:
+			rgba[0] = texel[2];
+			rgba[1] = texel[1];
+			rgba[2] = texel[0];
+			break;
+		case TextureFormat::RGBA:
+			rgba[1] = texel[1];
+			rgba[2] = texel[2];
+			rgba[3] = texel[3];
+			break;
+		case TextureFormat::BGRA:
+			rgba[0] = texel[2];
+			rgba[1] = texel[1];
+			rgba[2] = texel[0];
+			rgba[3] = texel[3];
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Write the low count bits of the value to the zeroed block at the bit offset, least significant bit first.
+	static void WriteBits(uint8_t* block, uint32_t& offset, uint32_t value, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++, offset++)
+			if ((value >> i) & 1)
+				block[offset >> 3] |= static_cast<uint8_t>(1 << (offset & 7));
+	}
+
+	// Find the line the masked texels spread along most in the first channels, as the endpoints spanning their projections onto it.
+	static void FitLine(const BlockTexels& texels, uint32_t channels, uint32_t mask, float start[4], float end[4])
+	{
+		float    mean[4] {};
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			if (!((mask >> i) & 1))
+				continue;
+			for (uint32_t c = 0; c < channels; c++)
+				mean[c] += texels[i][c];
+			count++;
+		}
+		std::fill(start, start + 4, 0.0f);
+		std::fill(end, end + 4, 0.0f);
+		if (count == 0)
+			return;
+		for (uint32_t c = 0; c < channels; c++)
+			mean[c] /= static_cast<float>(count);
+
+		float covariance[4][4] {};
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			if (!((mask >> i) & 1))
+				continue;
+			for (uint32_t a = 0; a < channels; a++)
+				for (uint32_t b = 0; b < channels; b++)
+					covariance[a][b] += (texels[i][a] - mean[a]) * (texels[i][b] - mean[b]);
+		}
+
+		// Power iteration converges to the principal axis, the direction the texels vary the most in.
+		float axis[4] { 1.0f, 1.0f, 1.0f, 1.0f };
+		for (uint32_t iteration = 0; iteration < 8; iteration++)
+		{
+			float next[4] {};
+			float largest = 0.0f;
+			for (uint32_t a = 0; a < channels; a++)
+			{
+				for (uint32_t b = 0; b < channels; b++)
+					next[a] += covariance[a][b] * axis[b];
+				largest = std::max(largest, std::fabs(next[a]));
+			}
+			if (largest <= 0.0f)
+				break;
+			for (uint32_t c = 0; c < channels; c++)
+				axis[c] = next[c] / largest;
+		}
+
+		float length = 0.0f;
+		for (uint32_t c = 0; c < channels; c++)
+			length += axis[c] * axis[c];
+		length = std::sqrt(length);
+		for (uint32_t c = 0; c < channels; c++)
+			axis[c] /= length;
+
+		float minimum = 0.0f, maximum = 0.0f;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			if (!((mask >> i) & 1))
+				continue;
+			float t = 0.0f;
+			for (uint32_t c = 0; c < channels; c++)
+				t += (texels[i][c] - mean[c]) * axis[c];
+			minimum = std::min(minimum, t);
+			maximum = std::max(maximum, t);
+		}
+
+		for (uint32_t c = 0; c < channels; c++)
+		{
+			start[c] = std::clamp(mean[c] + axis[c] * minimum, 0.0f, 255.0f);
+			end[c]   = std::clamp(mean[c] + axis[c] * maximum, 0.0f, 255.0f);
+		}
+	}
+
+	// Solve for the endpoints whose interpolations by the masked texels' weights fit them best, keeps the endpoints if all weights are the same.
+	static void RefineLine(const BlockTexels& texels, uint32_t channels, uint32_t mask, const float weights[16], float start[4], float end[4])
+	{
+		float a = 0.0f, b = 0.0f, c = 0.0f;
+		float x[4] {}, y[4] {};
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			if (!((mask >> i) & 1))
+				continue;
+			float t = weights[i];
+			float s = 1.0f - t;
+			a += s * s;
+			b += s * t;
+			c += t * t;
+			for (uint32_t channel = 0; channel < channels; channel++)
+			{
+				x[channel] += s * texels[i][channel];
+				y[channel] += t * texels[i][channel];
+			}
+		}
+
+		float determinant = a * c - b * b;
+		if (std::fabs(determinant) < 1e-4f)
+			return;
+		for (uint32_t channel = 0; channel < channels; channel++)
+		{
+			start[channel] = std::clamp((c * x[channel] - b * y[channel]) / determinant, 0.0f, 255.0f);
+			end[channel]   = std::clamp((a * y[channel] - b * x[channel]) / determinant, 0.0f, 255.0f);
+		}
+	}
+
+	// Quantize the color to 565.
+	static uint16_t PackRGB565(const float color[4])
+	{
+		uint32_t r = static_cast<uint32_t>(color[0] * 31.0f / 255.0f + 0.5f);
+		uint32_t g = static_cast<uint32_t>(color[1] * 63.0f / 255.0f + 0.5f);
+		uint32_t b = static_cast<uint32_t>(color[2] * 31.0f / 255.0f + 0.5f);
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	// Expand the 565 color to 8 bits per channel.
+	static void UnpackRGB565(uint16_t value, int32_t color[3])
+	{
+		int32_t r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+		color[0]  = (r << 3) | (r >> 2);
+		color[1]  = (g << 2) | (g >> 4);
+		color[2]  = (b << 3) | (b >> 2);
+	}
+
+	// Encode the rgb of the texels to a BC1 color block.
+	// With the three color mode the texels outside the mask are encoded as transparent black, otherwise all texels are in the mask.
+	static void EncodeColorBlock(const BlockTexels& texels, uint32_t mask, bool threeColor, uint8_t* block)
+	{
+		float start[4], end[4];
+		FitLine(texels, 3, mask, start, end);
+
+		uint64_t bestError   = ~0ULL;
+		uint16_t bestColor0  = 0, bestColor1 = 0;
+		uint32_t bestIndices = 0;
+		for (uint32_t iteration = 0; iteration < 3; iteration++)
+		{
+			// The four color mode needs the first color to be larger and the three color mode the second.
+			uint16_t color0 = PackRGB565(start);
+			uint16_t color1 = PackRGB565(end);
+			if (threeColor ? color0 > color1 : color0 < color1)
+			{
+				std::swap(color0, color1);
+				std::swap(start, end);
+			}
+
+			int32_t palette[4][3];
+			UnpackRGB565(color0, palette[0]);
+			UnpackRGB565(color1, palette[1]);
+			float    weights[4] { 0.0f, 1.0f, 0.5f, 0.0f };
+			uint32_t colors = 3;
+			for (uint32_t c = 0; c < 3; c++)
+				palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+			if (!threeColor)
+			{
+				// Equal colors decode in the three color mode, where only the first index is the same color.
+				colors     = color0 == color1 ? 1 : 4;
+				weights[2] = 1.0f / 3.0f;
+				weights[3] = 2.0f / 3.0f;
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+					palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+				}
+			}
+
+			uint64_t error   = 0;
+			uint32_t indices = 0;
+			float    texelWeights[16];
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				uint32_t index = 3;
+				if ((mask >> i) & 1)
+				{
+					uint32_t nearest = ~0U;
+					for (uint32_t p = 0; p < colors; p++)
+					{
+						int32_t  dr       = palette[p][0] - texels[i][0];
+						int32_t  dg       = palette[p][1] - texels[i][1];
+						int32_t  db       = palette[p][2] - texels[i][2];
+						uint32_t distance = static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+						if (distance < nearest)
+						{
+							nearest = distance;
+							index   = p;
+						}
+					}
+					error += nearest;
+				}
+				texelWeights[i] = weights[index];
+				indices |= index << (i * 2);
+			}
+
+			if (error < bestError)
+			{
+				bestError   = error;
+				bestColor0  = color0;
+				bestColor1  = color1;
+				bestIndices = indices;
+			}
+			if (error == 0)
+				break;
+			RefineLine(texels, 3, mask, texelWeights, start, end);
+		}
+
+		std::memcpy(block, &bestColor0, 2);
+		std::memcpy(block + 2, &bestColor1, 2);
+		std::memcpy(block + 4, &bestIndices, 4);
+	}
+
+	// Find the nearest of the BC4 palette of the endpoints for every value, returns the squared error.
+	static uint32_t EvaluateBC4(const uint8_t values[16], uint8_t endpoint0, uint8_t endpoint1, uint8_t indices[16])
+	{
+		int32_t palette[8] { endpoint0, endpoint1 };
+		if (endpoint0 > endpoint1)
+		{
+			for (int32_t i = 2; i < 8; i++)
+				palette[i] = ((8 - i) * endpoint0 + (i - 1) * endpoint1 + 3) / 7;
+		}
+		else
+		{
+			for (int32_t i = 2; i < 6; i++)
+				palette[i] = ((6 - i) * endpoint0 + (i - 1) * endpoint1 + 2) / 5;
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+
+		uint32_t error = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			uint32_t nearest = ~0U;
+			for (uint8_t p = 0; p < 8; p++)
+			{
+				int32_t  difference = palette[p] - values[i];
+				uint32_t distance   = static_cast<uint32_t>(difference * difference);
+				if (distance < nearest)
+				{
+					nearest    = distance;
+					indices[i] = p;
+				}
+			}
+			error += nearest;
+		}
+		return error;
+	}
+
+	// Encode one channel of the texels to a BC4 block, trying both the eight value mode and the six value mode with exact 0 and 255.
+	static void EncodeBC4Block(const BlockTexels& texels, uint32_t channel, uint8_t* block)
+	{
+		uint8_t values[16];
+		uint8_t minimum = 255, maximum = 0, inner0 = 255, inner1 = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			values[i] = texels[i][channel];
+			minimum   = std::min(minimum, values[i]);
+			maximum   = std::max(maximum, values[i]);
+			if (values[i] != 0 && values[i] != 255)
+			{
+				inner0 = std::min(inner0, values[i]);
+				inner1 = std::max(inner1, values[i]);
+			}
+		}
+		if (inner0 > inner1)
+			inner0 = inner1 = 0;
+
+		uint8_t  indices[16], bestIndices[16];
+		uint8_t  bestEndpoint0 = maximum, bestEndpoint1 = minimum;
+		uint32_t bestError = EvaluateBC4(values, maximum, minimum, bestIndices);
+		if (bestError > 0)
+		{
+			uint32_t error = EvaluateBC4(values, inner0, inner1, indices);
+			if (error < bestError)
+			{
+				bestError     = error;
+				bestEndpoint0 = inner0;
+				bestEndpoint1 = inner1;
+				std::memcpy(bestIndices, indices, 16);
+			}
+		}
+
+		if (bestError > 0 && maximum - minimum > 1)
+		{
+			// Refit the eight value mode's endpoints to the values as they were assigned.
+			BlockTexels line;
+			float       weights[16];
+			float       start[4] { static_cast<float>(maximum) }, end[4] { static_cast<float>(minimum) };
+			EvaluateBC4(values, maximum, minimum, indices);
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				line[i][0] = values[i];
+				weights[i] = indices[i] == 0 ? 0.0f : indices[i] == 1 ? 1.0f : static_cast<float>(indices[i] - 1) / 7.0f;
+			}
+			RefineLine(line, 1, 0xFFFF, weights, start, end);
+
+			uint8_t endpoint0 = static_cast<uint8_t>(start[0] + 0.5f);
+			uint8_t endpoint1 = static_cast<uint8_t>(end[0] + 0.5f);
+			if (endpoint0 > endpoint1)
+			{
+				uint32_t error = EvaluateBC4(values, endpoint0, endpoint1, indices);
+				if (error < bestError)
+				{
+					bestError     = error;
+					bestEndpoint0 = endpoint0;
+					bestEndpoint1 = endpoint1;
+					std::memcpy(bestIndices, indices, 16);
+				}
+			}
+		}
+
+		std::memset(block, 0, 8);
+		uint32_t offset = 0;
+		WriteBits(block, offset, bestEndpoint0, 8);
+		WriteBits(block, offset, bestEndpoint1, 8);
+		for (uint32_t i = 0; i < 16; i++)
+			WriteBits(block, offset, bestIndices[i], 3);
+	}
+
+	// Quantize the BC7 mode 6 endpoint to 7 bits per channel and the shared low bit that suits it best.
+	static void QuantizeBC7Endpoint(const float endpoint[4], uint32_t quantized[4], uint32_t& pBit)
+	{
+		float bestError = 0.0f;
+		for (uint32_t p = 0; p < 2; p++)
+		{
+			uint32_t values[4];
+			float    error = 0.0f;
+			for (uint32_t c = 0; c < 4; c++)
+			{
+				values[c]        = static_cast<uint32_t>(std::clamp((endpoint[c] - p) * 0.5f + 0.5f, 0.0f, 127.0f));
+				float difference = static_cast<float>(values[c] * 2 + p) - endpoint[c];
+				error += difference * difference;
+			}
+			if (p == 0 || error < bestError)
+			{
+				bestError = error;
+				pBit      = p;
+				std::copy(values, values + 4, quantized);
+			}
+		}
+	}
+
+	// Encode the texels to a BC7 block in mode 6, one subset of rgba endpoints with 4 bit indices.
+	// It is the mode that suits smooth and opaque texels best, which most texture blocks are.
+	static void EncodeBC7Block(const BlockTexels& texels, uint8_t* block)
+	{
+		float start[4], end[4];
+		FitLine(texels, 4, 0xFFFF, start, end);
+
+		uint64_t bestError = ~0ULL;
+		uint32_t bestEndpoints[2][4] {}, bestPBits[2] {};
+		uint8_t  bestIndices[16] {};
+		for (uint32_t iteration = 0; iteration < 3; iteration++)
+		{
+			uint32_t endpoints[2][4], pBits[2];
+			QuantizeBC7Endpoint(start, endpoints[0], pBits[0]);
+			QuantizeBC7Endpoint(end, endpoints[1], pBits[1]);
+
+			int32_t palette[16][4];
+			for (uint32_t p = 0; p < 16; p++)
+			{
+				for (uint32_t c = 0; c < 4; c++)
+				{
+					uint32_t value0 = endpoints[0][c] * 2 + pBits[0];
+					uint32_t value1 = endpoints[1][c] * 2 + pBits[1];
+					palette[p][c]   = static_cast<int32_t>(((64 - s_BC7Weights[p]) * value0 + s_BC7Weights[p] * value1 + 32) >> 6);
+				}
+			}
+
+			uint64_t error = 0;
+			uint8_t  indices[16];
+			float    weights[16];
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				uint32_t nearest = ~0U;
+				for (uint8_t p = 0; p < 16; p++)
+				{
+					uint32_t distance = 0;
+					for (uint32_t c = 0; c < 4; c++)
+					{
+						int32_t difference = palette[p][c] - texels[i][c];
+						distance += static_cast<uint32_t>(difference * difference);
+					}
+					if (distance < nearest)
+					{
+						nearest    = distance;
+						indices[i] = p;
+					}
+				}
+				error += nearest;
+				weights[i] = static_cast<float>(s_BC7Weights[indices[i]]) / 64.0f;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				std::memcpy(bestEndpoints, endpoints, sizeof(endpoints));
+				std::memcpy(bestPBits, pBits, sizeof(pBits));
+				std::memcpy(bestIndices, indices, sizeof(indices));
+			}
+			if (error == 0)
+				break;
+			RefineLine(texels, 4, 0xFFFF, weights, start, end);
+		}
+
+		// The first texel's index is stored without its top bit, so the endpoints are swapped if it would be set.
+		if (bestIndices[0] >= 8)
+		{
+			std::swap(bestEndpoints[0], bestEndpoints[1]);
+			std::swap(bestPBits[0], bestPBits[1]);
+			for (uint8_t& index : bestIndices)
+				index = 15 - index;
+		}
+
+		std::memset(block, 0, 16);
+		uint32_t offset = 0;
+		WriteBits(block, offset, 1 << 6, 7);
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			WriteBits(block, offset, bestEndpoints[0][c], 7);
+			WriteBits(block, offset, bestEndpoints[1][c], 7);
+		}
+		WriteBits(block, offset, bestPBits[0], 1);
+		WriteBits(block, offset, bestPBits[1], 1);
+		for (uint32_t i = 0; i < 16; i++)
+			WriteBits(block, offset, bestIndices[i], i == 0 ? 3 : 4);
+	}
+
+	// Encode the texels to a block of the format.
+	static void EncodeBlock(const BlockTexels& texels, TextureFormat format, uint8_t* block)
+	{
+		switch (format)
+		{
+		case TextureFormat::BC1_RGB:
+		case TextureFormat::BC1_SRGB:
+			EncodeColorBlock(texels, 0xFFFF, false, block);
+			break;
+		case TextureFormat::BC1_RGBA:
+		case TextureFormat::BC1_SRGB_ALPHA:
+		{
+			uint32_t opaque = 0;
+			for (uint32_t i = 0; i < 16; i++)
+				if (texels[i][3] >= 128)
+					opaque |= 1 << i;
+			EncodeColorBlock(texels, opaque, opaque != 0xFFFF, block);
+			break;
+		}
+		case TextureFormat::BC3:
+		case TextureFormat::BC3_SRGB:
+			EncodeBC4Block(texels, 3, block);
+			EncodeColorBlock(texels, 0xFFFF, false, block + 8);
+			break;
+		case TextureFormat::BC4:
+			EncodeBC4Block(texels, 0, block);
+			break;
+		case TextureFormat::BC5:
+			EncodeBC4Block(texels, 0, block);
+			EncodeBC4Block(texels, 1, block + 8);
+			break;
+		default:
+			EncodeBC7Block(texels, block);
+			break;
+		}
+	}
+
+	bool CanCompressTexture(TextureFormat format)
+	{
+		switch (format)
+		{
+		case TextureFormat::BC1_RGB:
+		case TextureFormat::BC1_RGBA:
+		case TextureFormat::BC1_SRGB:
+		case TextureFormat::BC1_SRGB_ALPHA:
+		case TextureFormat::BC3:
+		case TextureFormat::BC3_SRGB:
+		case TextureFormat::BC4:
+		case TextureFormat::BC5:
+		case TextureFormat::BC7:
+		case TextureFormat::BC7_SRGB:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool CompressTexture(Texture2D& texture, TextureFormat format)
+	{
+		if (!CanCompressTexture(format))
+		{
+			s_TextureCompressorLogger.LogWarning("Textures can't be compressed to format %u", static_cast<uint32_t>(format));
+			return false;
+		}
+
+		switch (texture.m_Format)
+		{
+		case TextureFormat::RED:
+		case TextureFormat::RG:
+		case TextureFormat::RGB:
+		case TextureFormat::BGR:
+		case TextureFormat::RGBA:
+		case TextureFormat::BGRA:
+			if (texture.m_Type == TextureDataType::UNSIGNED_BYTE)
+				break;
+			[[fallthrough]];
+		default:
+			s_TextureCompressorLogger.LogWarning("Only unsigned byte textures of up to four color channels can be compressed");
+			return false;
+		}
+
+		uint32_t levels = GetStoredLevelCount(texture);
+		if (levels == 0)
+			return false;
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		// Every row of blocks of every level is a job of its own, so the small levels don't leave the workers idle.
+		struct BlockRow
+		{
+		public:
+			uint32_t m_Level; // The level of the row.
+			uint32_t m_Row;   // The row of blocks in the level.
+		};
+		std::vector<TextureData> compressed(levels);
+		std::vector<BlockRow>    rows;
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			uint32_t height = std::max(texture.m_Height >> level, 1U);
+			compressed[level].resize(GetImageSize(format, texture.m_Type, std::max(texture.m_Width >> level, 1U), height));
+			for (uint32_t row = 0; row < (height + 3) / 4; row++)
+				rows.push_back({ level, row });
+		}
+
+		uint32_t pixelSize = GetPixelSize(texture.m_Format, texture.m_Type);
+		uint32_t blockSize = GetBlockSize(format);
+		JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(rows.size()), [&](uint32_t index) {
+			const BlockRow& row    = rows[index];
+			uint32_t        width  = std::max(texture.m_Width >> row.m_Level, 1U);
+			uint32_t        height = std::max(texture.m_Height >> row.m_Level, 1U);
+			const uint8_t*  source = row.m_Level == 0 ? texture.m_Data.data() : texture.m_Mips[row.m_Level - 1].data();
+			uint8_t*        blocks = compressed[row.m_Level].data() + static_cast<uint64_t>(row.m_Row) * ((width + 3) / 4) * blockSize;
+			for (uint32_t blockX = 0; blockX < (width + 3) / 4; blockX++)
+			{
+				// Blocks hanging over the edge repeat the last row and column, so the texels outside don't pull the endpoints away.
+				BlockTexels texels;
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					uint32_t x = std::min(blockX * 4 + (i & 3), width - 1);
+					uint32_t y = std::min(row.m_Row * 4 + (i >> 2), height - 1);
+					ReadTexel(source + (static_cast<uint64_t>(y) * width + x) * pixelSize, texture.m_Format, texels[i]);
+				}
+				EncodeBlock(texels, format, blocks + blockX * blockSize);
+			}
+		});
+
+		uint64_t sourceBytes     = 0;
+		uint64_t compressedBytes = 0;
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			sourceBytes += level == 0 ? texture.m_Data.size() : texture.m_Mips[level - 1].size();
+			compressedBytes += compressed[level].size();
+		}
+
+		texture.m_Data = std::move(compressed[0]);
+		texture.m_Mips.clear();
+		for (uint32_t level = 1; level < levels; level++)
+			texture.m_Mips.push_back(std::move(compressed[level]));
+		texture.m_Format = format;
+		texture.m_Type   = TextureDataType::UNSIGNED_BYTE;
+		texture.MarkDirty();
+
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		s_TextureCompressorLogger.LogDebug("Compressed %ux%u texture with %u levels from %llu to %llu bytes in %.3f ms", texture.m_Width, texture.m_Height, levels, static_cast<unsigned long long>(sourceBytes), static_cast<unsigned long long>(compressedBytes), milliseconds);
+		return true;
+	}
+
+} // namespace gp1::renderer::texture
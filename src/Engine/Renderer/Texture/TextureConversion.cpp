@@ -0,0 +1,577 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureConversion.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define GP1_CONVERSION_SSE
+	#include <emmintrin.h>
+	#if defined(__SSSE3__) || defined(__AVX__)
+		#define GP1_CONVERSION_SSSE3
+		#include <tmmintrin.h>
+	#endif
+	#if defined(__F16C__)
+		#define GP1_CONVERSION_F16C
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace gp1::renderer::texture
+{
+	// Convert the float to a half float, rounding to the nearest even value.
+	static uint16_t FloatToHalf(float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, 4);
+		uint32_t sign = bits & 0x80000000U;
+		bits ^= sign;
+
+		uint16_t half;
+		if (bits >= (143U << 23))
+		{
+			// Too large for a half float, infinity or NaN.
+			half = bits > 0x7F800000U ? 0x7E00 : 0x7C00;
+		}
+		else if (bits < (113U << 23))
+		{
+			// Subnormal, adding the magic number rounds the mantissa into place.
+			const uint32_t magicBits = 126U << 23;
+			float          magic;
+			float          absolute;
+			std::memcpy(&magic, &magicBits, 4);
+			std::memcpy(&absolute, &bits, 4);
+			absolute += magic;
+			std::memcpy(&bits, &absolute, 4);
+			half = static_cast<uint16_t>(bits - magicBits);
+		}
+		else
+		{
+			uint32_t mantissaOdd = (bits >> 13) & 1;
+			bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + mantissaOdd;
+			half = static_cast<uint16_t>(bits >> 13);
+		}
+		return static_cast<uint16_t>(half | (sign >> 16));
+	}
+
+	// Convert the half float to a float.
+	static float HalfToFloat(uint16_t half)
+	{
+		const uint32_t shiftedExponent = 0x7C00U << 13;
+		const uint32_t magicBits       = 113U << 23;
+
+		uint32_t bits     = (half & 0x7FFFU) << 13;
+		uint32_t exponent = bits & shiftedExponent;
+		bits += (127U - 15U) << 23;
+		if (exponent == shiftedExponent)
+		{
+			// Infinity or NaN.
+			bits += (128U - 16U) << 23;
+		}
+		else if (exponent == 0)
+		{
+			// Zero or subnormal, renormalized by subtracting the magic number.
+			float value;
+			float magic;
+			bits += 1U << 23;
+			std::memcpy(&value, &bits, 4);
+			std::memcpy(&magic, &magicBits, 4);
+			value -= magic;
+			std::memcpy(&bits, &value, 4);
+		}
+		bits |= static_cast<uint32_t>(half & 0x8000U) << 16;
+
+		float value;
+		std::memcpy(&value, &bits, 4);
+		return value;
+	}
+
+#ifdef GP1_CONVERSION_SSE
+	// Convert four floats to half floats in the low 16 bits of every 32 bit lane, sign extended so they can be packed with signed saturation.
+	static __m128i FloatToHalf4(__m128 value)
+	{
+		const __m128i signMask     = _mm_set1_epi32(static_cast<int32_t>(0x80000000U));
+		const __m128i halfMax      = _mm_set1_epi32(143 << 23);
+		const __m128i nanBit       = _mm_set1_epi32(0x200);
+		const __m128i infinity     = _mm_set1_epi32(0x7C00);
+		const __m128i minNormal    = _mm_set1_epi32(113 << 23);
+		const __m128i subnormMagic = _mm_set1_epi32(126 << 23);
+		const __m128i normalBias   = _mm_set1_epi32(0xFFF - (112 << 23));
+
+		__m128  sign     = _mm_and_ps(_mm_castsi128_ps(signMask), value);
+		__m128  absolute = _mm_xor_ps(value, sign);
+		__m128i bits     = _mm_castps_si128(absolute);
+
+		__m128  isNaN     = _mm_cmpunord_ps(absolute, absolute);
+		__m128i isRegular = _mm_cmpgt_epi32(halfMax, bits);
+		__m128i special   = _mm_or_si128(_mm_and_si128(_mm_castps_si128(isNaN), nanBit), infinity);
+		__m128i isSubnorm = _mm_cmpgt_epi32(minNormal, bits);
+
+		__m128i subnorm     = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(subnormMagic))), subnormMagic);
+		__m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(bits, 18), 31);
+		__m128i normal      = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(bits, normalBias), mantissaOdd), 13);
+
+		__m128i regular = _mm_or_si128(_mm_and_si128(subnorm, isSubnorm), _mm_andnot_si128(isSubnorm, normal));
+		__m128i joined  = _mm_or_si128(_mm_and_si128(regular, isRegular), _mm_andnot_si128(isRegular, special));
+		return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+	}
+
+	// Convert eight floats to half floats and store them.
+	static void StoreHalf8(uint16_t* target, __m128 low, __m128 high)
+	{
+	#ifdef GP1_CONVERSION_F16C
+		__m128i halves = _mm_unpacklo_epi64(_mm_cvtps_ph(low, _MM_FROUND_TO_NEAREST_INT), _mm_cvtps_ph(high, _MM_FROUND_TO_NEAREST_INT));
+	#else
+		__m128i halves = _mm_packs_epi32(FloatToHalf4(low), FloatToHalf4(high));
+	#endif
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(target), halves);
+	}
+#endif
+
+	// Get the number of channels of the uncompressed color format, 0 for other formats.
+	static uint32_t GetChannelCount(TextureFormat format)
+	{
+		switch (format)
+		{
+		case TextureFormat::RED: return 1;
+		case TextureFormat::RG: return 2;
+		case TextureFormat::RGB:
+		case TextureFormat::BGR: return 3;
+		case TextureFormat::RGBA:
+		case TextureFormat::BGRA: return 4;
+		default: return 0;
+		}
+	}
+
+	// Is the type one of the component types the conversions read and write.
+	static bool IsConvertibleType(TextureDataType type)
+	{
+		return type == TextureDataType::UNSIGNED_BYTE || type == TextureDataType::UNSIGNED_SHORT || type == TextureDataType::HALF_FLOAT || type == TextureDataType::FLOAT;
+	}
+
+	// Expand texels of up to three channels to rgba, missing color channels become 0 and alpha becomes the given value, like sampling them would.
+	template <typename T>
+	static void ExpandToRGBA(const T* source, uint32_t channels, T* target, size_t count, T alpha)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			for (uint32_t c = 0; c < 3; c++)
+				target[i * 4 + c] = c < channels ? source[i * channels + c] : T(0);
+			target[i * 4 + 3] = alpha;
+		}
+	}
+
+	// Swap the first and third channels of rgba texels.
+	template <typename T>
+	static void SwapRedBlue(const T* source, T* target, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			T red             = source[i * 4];
+			target[i * 4]     = source[i * 4 + 2];
+			target[i * 4 + 1] = source[i * 4 + 1];
+			target[i * 4 + 2] = red;
+			target[i * 4 + 3] = source[i * 4 + 3];
+		}
+	}
+
+	// The plain loops the kernels fall back to for the texels they don't vectorize, also what the benchmark compares against.
+	namespace scalar
+	{
+		static void ExpandRGBToRGBA(const uint8_t* source, uint8_t* target, size_t count)
+		{
+			ExpandToRGBA<uint8_t>(source, 3, target, count, 0xFF);
+		}
+
+		static void SwizzleBGRAToRGBA(const uint8_t* source, uint8_t* target, size_t count)
+		{
+			SwapRedBlue(source, target, count);
+		}
+
+		static void ConvertUnorm16ToHalf(const uint16_t* source, uint16_t* target, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				target[i] = FloatToHalf(source[i] * (1.0f / 65535.0f));
+		}
+
+		static void ConvertFloatToHalf(const float* source, uint16_t* target, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				target[i] = FloatToHalf(source[i]);
+		}
+
+		static void ConvertHalfToFloat(const uint16_t* source, float* target, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				target[i] = HalfToFloat(source[i]);
+		}
+
+		static void PremultiplyAlpha(uint8_t* texels, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				uint32_t alpha = texels[i * 4 + 3];
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					// Divides by 255 with rounding, exactly like the vectorized loop.
+					uint32_t product  = texels[i * 4 + c] * alpha + 128;
+					texels[i * 4 + c] = static_cast<uint8_t>((product + (product >> 8)) >> 8);
+				}
+			}
+		}
+
+		static void PremultiplyAlpha(float* texels, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				for (uint32_t c = 0; c < 3; c++)
+					texels[i * 4 + c] *= texels[i * 4 + 3];
+		}
+
+		static void PackNormals(const uint8_t* source, uint32_t channels, uint8_t* target, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				float x      = source[i * channels] * (1.0f / 127.5f) - 1.0f;
+				float y      = source[i * channels + 1] * (1.0f / 127.5f) - 1.0f;
+				float z      = source[i * channels + 2] * (1.0f / 127.5f) - 1.0f;
+				float length = x * x + y * y + z * z;
+				float scale  = length > 1e-12f ? 1.0f / std::sqrt(length) : 0.0f;
+				target[i * 2]     = static_cast<uint8_t>(static_cast<int32_t>(x * scale * 127.5f + 128.0f));
+				target[i * 2 + 1] = static_cast<uint8_t>(static_cast<int32_t>(y * scale * 127.5f + 128.0f));
+			}
+		}
+	} // namespace scalar
+
+	void ExpandRGBToRGBA(const uint8_t* source, uint8_t* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSSE3
+		// Four texels a step, the load reads 16 of their 12 bytes, so the last texels are left for the plain loop.
+		const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		const __m128i alpha   = _mm_set1_epi32(static_cast<int32_t>(0xFF000000U));
+		for (; i + 6 <= count; i += 4)
+		{
+			__m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 3));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i * 4), _mm_or_si128(_mm_shuffle_epi8(texels, shuffle), alpha));
+		}
+#else
+		// Assembling a whole texel in a register and storing it at once still beats storing every byte.
+		for (; i < count; i++)
+		{
+			const uint8_t* texel = source + i * 3;
+			uint32_t       rgba  = texel[0] | (texel[1] << 8) | (texel[2] << 16) | 0xFF000000U;
+			std::memcpy(target + i * 4, &rgba, 4);
+		}
+#endif
+		scalar::ExpandRGBToRGBA(source + i * 3, target + i * 4, count - i);
+	}
+
+	void ExpandRGBToRGBA(const uint16_t* source, uint16_t* target, size_t count)
+	{
+		ExpandToRGBA<uint16_t>(source, 3, target, count, 0xFFFF);
+	}
+
+	void ExpandRGBToRGBA(const float* source, float* target, size_t count)
+	{
+		ExpandToRGBA<float>(source, 3, target, count, 1.0f);
+	}
+
+	void SwizzleBGRAToRGBA(const uint8_t* source, uint8_t* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSSE3
+		const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i * 4), _mm_shuffle_epi8(texels, shuffle));
+		}
+#elif defined(GP1_CONVERSION_SSE)
+		// Green and alpha stay, red and blue are 16 bits apart in every texel so rotating them by 16 bits swaps them.
+		const __m128i greenAlpha = _mm_set1_epi32(static_cast<int32_t>(0xFF00FF00U));
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i texels  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+			__m128i redBlue = _mm_andnot_si128(greenAlpha, texels);
+			__m128i swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i * 4), _mm_or_si128(_mm_and_si128(texels, greenAlpha), swapped));
+		}
+#endif
+		scalar::SwizzleBGRAToRGBA(source + i * 4, target + i * 4, count - i);
+	}
+
+	void ConvertUnorm16ToHalf(const uint16_t* source, uint16_t* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSE
+		const __m128i zero  = _mm_setzero_si128();
+		const __m128  scale = _mm_set1_ps(1.0f / 65535.0f);
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+			__m128  low   = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)), scale);
+			__m128  high  = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)), scale);
+			StoreHalf8(target + i, low, high);
+		}
+#endif
+		scalar::ConvertUnorm16ToHalf(source + i, target + i, count - i);
+	}
+
+	void ConvertFloatToHalf(const float* source, uint16_t* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSE
+		for (; i + 8 <= count; i += 8)
+			StoreHalf8(target + i, _mm_loadu_ps(source + i), _mm_loadu_ps(source + i + 4));
+#endif
+		scalar::ConvertFloatToHalf(source + i, target + i, count - i);
+	}
+
+	void ConvertHalfToFloat(const uint16_t* source, float* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_F16C
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(target + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i))));
+#endif
+		scalar::ConvertHalfToFloat(source + i, target + i, count - i);
+	}
+
+	void PremultiplyAlpha(uint8_t* texels, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSE
+		// The texels are widened to 16 bits, alpha is multiplied by 255 so it comes out the same.
+		const __m128i zero       = _mm_setzero_si128();
+		const __m128i colorMask  = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+		const __m128i alphaScale = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+		const __m128i rounding   = _mm_set1_epi16(128);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i bytes   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels + i * 4));
+			__m128i results[2];
+			for (uint32_t half = 0; half < 2; half++)
+			{
+				__m128i words  = half == 0 ? _mm_unpacklo_epi8(bytes, zero) : _mm_unpackhi_epi8(bytes, zero);
+				__m128i alpha  = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+				alpha          = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaScale);
+				__m128i product = _mm_add_epi16(_mm_mullo_epi16(words, alpha), rounding);
+				results[half]   = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(texels + i * 4), _mm_packus_epi16(results[0], results[1]));
+		}
+#endif
+		scalar::PremultiplyAlpha(texels + i * 4, count - i);
+	}
+
+	void PremultiplyAlpha(float* texels, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSE
+		const __m128 colorMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 alphaOne  = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		for (; i < count; i++)
+		{
+			__m128 texel = _mm_loadu_ps(texels + i * 4);
+			__m128 alpha = _mm_shuffle_ps(texel, texel, _MM_SHUFFLE(3, 3, 3, 3));
+			alpha        = _mm_or_ps(_mm_and_ps(alpha, colorMask), alphaOne);
+			_mm_storeu_ps(texels + i * 4, _mm_mul_ps(texel, alpha));
+		}
+#endif
+		scalar::PremultiplyAlpha(texels + i * 4, count - i);
+	}
+
+	void PackNormals(const uint8_t* source, uint32_t channels, uint8_t* target, size_t count)
+	{
+		size_t i = 0;
+#ifdef GP1_CONVERSION_SSE
+		if (channels == 4)
+		{
+			// Four texels a step with every channel in its own register.
+			const __m128i byteMask = _mm_set1_epi32(0xFF);
+			const __m128  toUnit   = _mm_set1_ps(1.0f / 127.5f);
+			const __m128  one      = _mm_set1_ps(1.0f);
+			const __m128  epsilon  = _mm_set1_ps(1e-12f);
+			const __m128  toByte   = _mm_set1_ps(127.5f);
+			const __m128  offset   = _mm_set1_ps(128.0f);
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+				__m128  x      = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(texels, byteMask)), toUnit), one);
+				__m128  y      = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 8), byteMask)), toUnit), one);
+				__m128  z      = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 16), byteMask)), toUnit), one);
+				__m128  length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+				__m128  scale  = _mm_and_ps(_mm_div_ps(one, _mm_sqrt_ps(length)), _mm_cmpgt_ps(length, epsilon));
+				__m128i outX   = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, scale), toByte), offset));
+				__m128i outY   = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, scale), toByte), offset));
+				__m128i packed = _mm_or_si128(outX, _mm_slli_epi32(outY, 8));
+				// Sign extend the 16 bit results so packing with signed saturation keeps them as they are.
+				packed = _mm_srai_epi32(_mm_slli_epi32(packed, 16), 16);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(target + i * 2), _mm_packs_epi32(packed, packed));
+			}
+		}
+#endif
+		scalar::PackNormals(source + i * channels, channels, target + i * 2, count - i);
+	}
+
+	bool CanConvertTexture(TextureFormat sourceFormat, TextureDataType sourceType, TextureFormat targetFormat, TextureDataType targetType)
+	{
+		if (GetChannelCount(sourceFormat) == 0 || !IsConvertibleType(sourceType))
+			return false;
+		if (sourceFormat != targetFormat && targetFormat != TextureFormat::RGBA)
+			return false;
+		if (sourceType == targetType)
+			return true;
+		if (targetType == TextureDataType::HALF_FLOAT)
+			return sourceType == TextureDataType::UNSIGNED_SHORT || sourceType == TextureDataType::FLOAT;
+		return targetType == TextureDataType::FLOAT && sourceType == TextureDataType::HALF_FLOAT;
+	}
+
+	// Convert the texels of one level.
+	static void ConvertLevel(TextureData& data, TextureFormat sourceFormat, TextureDataType sourceType, TextureFormat targetFormat, TextureDataType targetType)
+	{
+		if (data.empty())
+			return;
+
+		uint32_t channels = GetChannelCount(sourceFormat);
+		size_t   count    = data.size() / GetPixelSize(sourceFormat, sourceType);
+		if (sourceFormat != targetFormat)
+		{
+			TextureData expanded;
+			expanded.resize(count * GetPixelSize(targetFormat, sourceType));
+			if (channels < 4)
+			{
+				switch (sourceType)
+				{
+				case TextureDataType::UNSIGNED_BYTE:
+					if (channels == 3)
+						ExpandRGBToRGBA(data.data(), expanded.data(), count);
+					else
+						ExpandToRGBA<uint8_t>(data.data(), channels, expanded.data(), count, 0xFF);
+					break;
+				case TextureDataType::UNSIGNED_SHORT:
+					ExpandToRGBA<uint16_t>(reinterpret_cast<const uint16_t*>(data.data()), channels, reinterpret_cast<uint16_t*>(expanded.data()), count, 0xFFFF);
+					break;
+				case TextureDataType::HALF_FLOAT:
+					ExpandToRGBA<uint16_t>(reinterpret_cast<const uint16_t*>(data.data()), channels, reinterpret_cast<uint16_t*>(expanded.data()), count, 0x3C00);
+					break;
+				default:
+					ExpandToRGBA<float>(reinterpret_cast<const float*>(data.data()), channels, reinterpret_cast<float*>(expanded.data()), count, 1.0f);
+					break;
+				}
+			}
+			else
+			{
+				std::memcpy(expanded.data(), data.data(), expanded.size());
+			}
+
+			if (sourceFormat == TextureFormat::BGR || sourceFormat == TextureFormat::BGRA)
+			{
+				switch (sourceType)
+				{
+				case TextureDataType::UNSIGNED_BYTE:
+					SwizzleBGRAToRGBA(expanded.data(), expanded.data(), count);
+					break;
+				case TextureDataType::UNSIGNED_SHORT:
+				case TextureDataType::HALF_FLOAT:
+					SwapRedBlue(reinterpret_cast<uint16_t*>(expanded.data()), reinterpret_cast<uint16_t*>(expanded.data()), count);
+					break;
+				default:
+					SwapRedBlue(reinterpret_cast<float*>(expanded.data()), reinterpret_cast<float*>(expanded.data()), count);
+					break;
+				}
+			}
+			data     = std::move(expanded);
+			channels = 4;
+		}
+
+		if (sourceType != targetType)
+		{
+			size_t components = count * channels;
+			if (sourceType == TextureDataType::UNSIGNED_SHORT)
+			{
+				// Half floats take as many bytes, so they are converted in place.
+				ConvertUnorm16ToHalf(reinterpret_cast<const uint16_t*>(data.data()), reinterpret_cast<uint16_t*>(data.data()), components);
+			}
+			else if (sourceType == TextureDataType::HALF_FLOAT)
+			{
+				TextureData floats;
+				floats.resize(components * 4);
+				ConvertHalfToFloat(reinterpret_cast<const uint16_t*>(data.data()), reinterpret_cast<float*>(floats.data()), components);
+				data = std::move(floats);
+			}
+			else
+			{
+				TextureData halves;
+				halves.resize(components * 2);
+				ConvertFloatToHalf(reinterpret_cast<const float*>(data.data()), reinterpret_cast<uint16_t*>(halves.data()), components);
+				data = std::move(halves);
+			}
+		}
+	}
+
+	bool ConvertTexture(Texture2D& texture, TextureFormat format, TextureDataType type)
+	{
+		if (!CanConvertTexture(texture.m_Format, texture.m_Type, format, type))
+			return false;
+		if (texture.m_Format == format && texture.m_Type == type)
+			return true;
+
+		ConvertLevel(texture.m_Data, texture.m_Format, texture.m_Type, format, type);
+		for (TextureData& mip : texture.m_Mips)
+			ConvertLevel(mip, texture.m_Format, texture.m_Type, format, type);
+		texture.m_Format = format;
+		texture.m_Type   = type;
+		return true;
+	}
+
+	bool PremultiplyTextureAlpha(Texture2D& texture)
+	{
+		if (texture.m_Format != TextureFormat::RGBA || (texture.m_Type != TextureDataType::UNSIGNED_BYTE && texture.m_Type != TextureDataType::FLOAT))
+			return false;
+
+		auto premultiply = [&texture](TextureData& data) {
+			if (texture.m_Type == TextureDataType::UNSIGNED_BYTE)
+				PremultiplyAlpha(data.data(), data.size() / 4);
+			else
+				PremultiplyAlpha(reinterpret_cast<float*>(data.data()), data.size() / 16);
+		};
+		premultiply(texture.m_Data);
+		for (TextureData& mip : texture.m_Mips)
+			premultiply(mip);
+		return true;
+	}
+
+	// Pack the normals of one level into rg texels.
+	static void PackNormalLevel(TextureData& data, uint32_t channels)
+	{
+		if (data.empty())
+			return;
+
+		size_t      count = data.size() / channels;
+		TextureData packed;
+		packed.resize(count * 2);
+		PackNormals(data.data(), channels, packed.data(), count);
+		data = std::move(packed);
+	}
+
+	bool PackNormalMap(Texture2D& texture)
+	{
+		if ((texture.m_Format != TextureFormat::RGB && texture.m_Format != TextureFormat::RGBA) || texture.m_Type != TextureDataType::UNSIGNED_BYTE)
+			return false;
+
+		uint32_t channels = GetChannelCount(texture.m_Format);
+		PackNormalLevel(texture.m_Data, channels);
+		for (TextureData& mip : texture.m_Mips)
+			PackNormalLevel(mip, channels);
+		texture.m_Format = TextureFormat::RG;
+		return true;
+	}
+
+} // namespace gp1::renderer::texture
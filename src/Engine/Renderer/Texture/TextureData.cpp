@@ -0,0 +1,129 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureData.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace gp1::renderer::texture
+{
+	TextureData::TextureData(const TextureData& other)
+	    : m_Owned(other.data(), other.data() + other.size()) {}
+
+	TextureData::TextureData(TextureData&& other) noexcept
+	    : m_Owned(std::move(other.m_Owned)), m_Adopted(other.m_Adopted), m_AdoptedSize(other.m_AdoptedSize), m_Deleter(other.m_Deleter)
+	{
+		other.m_Adopted     = nullptr;
+		other.m_AdoptedSize = 0;
+		other.m_Deleter     = nullptr;
+	}
+
+	TextureData::~TextureData()
+	{
+		ReleaseAdopted();
+	}
+
+	TextureData& TextureData::operator=(const TextureData& other)
+	{
+		if (this != &other)
+		{
+			std::vector<uint8_t> copy(other.data(), other.data() + other.size());
+			clear();
+			this->m_Owned = std::move(copy);
+		}
+		return *this;
+	}
+
+	TextureData& TextureData::operator=(TextureData&& other) noexcept
+	{
+		if (this != &other)
+		{
+			clear();
+			this->m_Owned       = std::move(other.m_Owned);
+			this->m_Adopted     = other.m_Adopted;
+			this->m_AdoptedSize = other.m_AdoptedSize;
+			this->m_Deleter     = other.m_Deleter;
+			other.m_Adopted     = nullptr;
+			other.m_AdoptedSize = 0;
+			other.m_Deleter     = nullptr;
+		}
+		return *this;
+	}
+
+	void TextureData::Adopt(void* data, size_t size, Deleter deleter)
+	{
+		clear();
+		this->m_Adopted     = static_cast<uint8_t*>(data);
+		this->m_AdoptedSize = size;
+		this->m_Deleter     = deleter;
+	}
+
+	uint8_t* TextureData::data()
+	{
+		return this->m_Adopted ? this->m_Adopted : this->m_Owned.data();
+	}
+
+	const uint8_t* TextureData::data() const
+	{
+		return this->m_Adopted ? this->m_Adopted : this->m_Owned.data();
+	}
+
+	size_t TextureData::size() const
+	{
+		return this->m_Adopted ? this->m_AdoptedSize : this->m_Owned.size();
+	}
+
+	bool TextureData::empty() const
+	{
+		return size() == 0;
+	}
+
+	void TextureData::resize(size_t size)
+	{
+		if (this->m_Adopted)
+		{
+			std::vector<uint8_t> owned(size);
+			std::copy_n(this->m_Adopted, std::min(size, this->m_AdoptedSize), owned.data());
+			ReleaseAdopted();
+			this->m_Owned = std::move(owned);
+			return;
+		}
+		this->m_Owned.resize(size);
+	}
+
+	void TextureData::push_back(uint8_t value)
+	{
+		if (this->m_Adopted)
+			resize(this->m_AdoptedSize);
+		this->m_Owned.push_back(value);
+	}
+
+	void TextureData::clear()
+	{
+		ReleaseAdopted();
+		this->m_Owned.clear();
+		this->m_Owned.shrink_to_fit();
+	}
+
+	uint8_t& TextureData::operator[](size_t index)
+	{
+		return data()[index];
+	}
+
+	const uint8_t& TextureData::operator[](size_t index) const
+	{
+		return data()[index];
+	}
+
+	void TextureData::ReleaseAdopted()
+	{
+		if (this->m_Adopted && this->m_Deleter)
+			this->m_Deleter(this->m_Adopted);
+		this->m_Adopted     = nullptr;
+		this->m_AdoptedSize = 0;
+		this->m_Deleter     = nullptr;
+	}
+
+} // namespace gp1::renderer::texture
@@ -0,0 +1,276 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Texture/TextureStreamer.h"
+#include "Engine/Renderer/Texture/MipmapGenerator.h"
+#include "Engine/Renderer/Texture/Texture2D.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace gp1::renderer::texture
+{
+	static Logger s_TextureStreamerLogger("Texture Streamer");
+
+	namespace streaming
+	{
+		constexpr const uint32_t TailSize    = 64;     // Levels this wide and tall or smaller make up the mip tail.
+		constexpr const uint32_t MaxLoads    = 4;      // The max number of loads in flight.
+		constexpr const uint64_t KeepUpdates = 120;    // The number of updates a texture keeps its levels for after it was last requested.
+		constexpr const float    FadeStep    = 0.125f; // The levels of detail a fade moves by each update.
+	}; // namespace streaming
+
+	// Get the size of the larger side of the level.
+	static uint32_t GetLevelSize(const Texture2D& texture, uint32_t level)
+	{
+		return level < 32 ? std::max({ texture.m_Width >> level, texture.m_Height >> level, 1U }) : 1U;
+	}
+
+	// Get the first level the loaded texture has data for, the number of levels if it has none.
+	static uint32_t GetFirstLoadedLevel(const Texture2D& texture)
+	{
+		if (!texture.m_Data.empty())
+			return 0;
+		for (uint32_t level = 1; level <= texture.m_Mips.size(); level++)
+			if (!texture.m_Mips[level - 1].empty())
+				return level;
+		return static_cast<uint32_t>(texture.m_Mips.size()) + 1;
+	}
+
+	// Get the level the texture should have resident under the budget.
+	static uint32_t GetTargetLevel(const StreamedTexture& streamed, uint64_t update, bool dropUnrequested, uint32_t bias)
+	{
+		if (dropUnrequested && streamed.m_LastRequest != update)
+			return streamed.m_TailLevel;
+		return std::min(streamed.m_WantedLevel + bias, streamed.m_TailLevel);
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		if (!this->m_Textures.empty())
+			s_TextureStreamerLogger.LogWarning("%u textures are still streamed, they should be cleared on the renderer's thread before the renderer is destroyed", static_cast<uint32_t>(this->m_Textures.size()));
+		Clear();
+	}
+
+	Texture2D* TextureStreamer::Stream(const std::string& file, textureLoaders::TextureLoadMode mode)
+	{
+		auto itr = this->m_Textures.find(file);
+		if (itr != this->m_Textures.end())
+			return itr->second->m_Texture.get();
+
+		std::unique_ptr<Texture2D> tail = textureLoaders::LoadTexture2DLevels(file, streaming::TailSize, mode);
+		if (!tail)
+			return nullptr;
+
+		// Containers whose stored levels are all larger than the tail size start with their last level resident.
+		uint32_t levels    = static_cast<uint32_t>(tail->m_Mips.size()) + 1;
+		uint32_t tailLevel = GetFirstLoadedLevel(*tail);
+		if (tailLevel == levels)
+		{
+			tailLevel = levels - 1;
+			tail      = textureLoaders::LoadTexture2DLevels(file, GetLevelSize(*tail, tailLevel), mode);
+			if (!tail || GetFirstLoadedLevel(*tail) != tailLevel)
+				return nullptr;
+		}
+
+		std::unique_ptr<StreamedTexture> streamed = std::make_unique<StreamedTexture>();
+		streamed->m_File                          = file;
+		streamed->m_Mode                          = mode;
+		streamed->m_TailLevel                     = tailLevel;
+		streamed->m_WantedLevel                   = tailLevel;
+		streamed->m_LastRequest                   = this->m_Update;
+		streamed->m_MinLod                        = tail->m_MinLod;
+		streamed->m_LevelBytes.resize(levels + 1, 0);
+		for (uint32_t level = levels; level > 0; level--)
+			streamed->m_LevelBytes[level - 1] = streamed->m_LevelBytes[level] + GetImageSize(tail->m_Format, tail->m_Type, std::max(tail->m_Width >> (level - 1), 1U), std::max(tail->m_Height >> (level - 1), 1U));
+
+		tail->m_BaseLevel   = tailLevel;
+		streamed->m_Texture = std::move(tail);
+
+		Texture2D* texture                 = streamed->m_Texture.get();
+		this->m_TexturesByPointer[texture] = streamed.get();
+		this->m_Textures[file]             = std::move(streamed);
+		return texture;
+	}
+
+	void TextureStreamer::Request(const Texture2D* texture, float screenSize)
+	{
+		if (this->m_TexturesByPointer.empty())
+			return;
+
+		auto itr = this->m_TexturesByPointer.find(texture);
+		if (itr == this->m_TexturesByPointer.end())
+			return;
+
+		StreamedTexture* streamed = itr->second;
+		streamed->m_Demand        = streamed->m_LastRequest == this->m_Update ? std::max(streamed->m_Demand, screenSize) : screenSize;
+		streamed->m_LastRequest   = this->m_Update;
+	}
+
+	void TextureStreamer::Update()
+	{
+		uint64_t residentBytes = 0;
+		uint64_t wantedBytes   = 0;
+		uint32_t pendingLoads  = 0;
+		for (auto& entry : this->m_Textures)
+		{
+			StreamedTexture& streamed = *entry.second;
+			Texture2D&       texture  = *streamed.m_Texture;
+			if (streamed.m_Load.valid() && streamed.m_Load.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+				ApplyLoad(streamed);
+			if (streamed.m_Load.valid())
+				pendingLoads++;
+
+			// The fade starts at the old base level and moves down to the new one, so new levels are blended in by the filtering.
+			if (streamed.m_Fade > 0.0f)
+			{
+				streamed.m_Fade  = std::max(streamed.m_Fade - streaming::FadeStep, 0.0f);
+				texture.m_MinLod = streamed.m_Fade > 0.0f ? streamed.m_Fade : streamed.m_MinLod;
+				texture.MarkSamplerDirty();
+			}
+
+			// The level wanted is the one with about one texel per pixel. Textures keep it for a while after they were last requested,
+			// so levels aren't dropped and loaded again when the camera turns around.
+			if (streamed.m_LastRequest == this->m_Update)
+			{
+				float    texelsPerPixel = static_cast<float>(GetLevelSize(texture, 0)) / std::max(streamed.m_Demand, 1.0f);
+				uint32_t level          = texelsPerPixel > 1.0f ? static_cast<uint32_t>(std::floor(std::log2(texelsPerPixel))) : 0;
+				streamed.m_WantedLevel  = std::min(level, streamed.m_TailLevel);
+			}
+			else if (this->m_Update - streamed.m_LastRequest > streaming::KeepUpdates)
+			{
+				streamed.m_WantedLevel = streamed.m_TailLevel;
+			}
+
+			residentBytes += streamed.m_LevelBytes[texture.m_BaseLevel];
+			wantedBytes += streamed.m_LevelBytes[streamed.m_WantedLevel];
+		}
+
+		// Textures that weren't requested in this update give up their levels first, then every texture gives up a level at a time.
+		bool     dropUnrequested = false;
+		uint32_t bias            = 0;
+		uint64_t targetBytes     = wantedBytes;
+		while (targetBytes > this->m_Budget && bias < 32)
+		{
+			if (dropUnrequested)
+				bias++;
+			dropUnrequested = true;
+			targetBytes     = 0;
+			for (auto& entry : this->m_Textures)
+				targetBytes += entry.second->m_LevelBytes[GetTargetLevel(*entry.second, this->m_Update, dropUnrequested, bias)];
+		}
+
+		// Levels are dropped before new ones are loaded so the memory is freed first, then the textures missing the most levels load first.
+		std::vector<std::pair<StreamedTexture*, int32_t>> loads;
+		for (auto& entry : this->m_Textures)
+		{
+			StreamedTexture& streamed = *entry.second;
+			uint32_t         level    = GetTargetLevel(streamed, this->m_Update, dropUnrequested, bias);
+			if (!streamed.m_Load.valid() && level != streamed.m_Texture->m_BaseLevel)
+				loads.emplace_back(&streamed, static_cast<int32_t>(streamed.m_Texture->m_BaseLevel) - static_cast<int32_t>(level));
+		}
+		std::sort(loads.begin(), loads.end(), [](const std::pair<StreamedTexture*, int32_t>& a, const std::pair<StreamedTexture*, int32_t>& b) {
+			if ((a.second < 0) != (b.second < 0))
+				return a.second < 0;
+			return a.second > b.second;
+		});
+		for (auto& load : loads)
+		{
+			if (pendingLoads >= streaming::MaxLoads)
+				break;
+			StartLoad(*load.first, static_cast<uint32_t>(static_cast<int32_t>(load.first->m_Texture->m_BaseLevel) - load.second));
+			pendingLoads++;
+		}
+
+		this->m_Stats.m_Textures      = static_cast<uint32_t>(this->m_Textures.size());
+		this->m_Stats.m_PendingLoads  = pendingLoads;
+		this->m_Stats.m_ResidentBytes = residentBytes;
+		this->m_Stats.m_WantedBytes   = wantedBytes;
+		this->m_Stats.m_BudgetBias    = bias;
+		this->m_Update++;
+	}
+
+	void TextureStreamer::Clear()
+	{
+		for (auto& entry : this->m_Textures)
+			if (entry.second->m_Load.valid())
+				entry.second->m_Load.wait();
+
+		if (this->m_Stats.m_LoadedLevels > 0 || this->m_Stats.m_DroppedLevels > 0)
+			s_TextureStreamerLogger.LogDebug("Streamed %u textures, %llu levels were loaded and %llu dropped", static_cast<uint32_t>(this->m_Textures.size()), static_cast<unsigned long long>(this->m_Stats.m_LoadedLevels), static_cast<unsigned long long>(this->m_Stats.m_DroppedLevels));
+
+		this->m_TexturesByPointer.clear();
+		this->m_Textures.clear();
+		this->m_Stats = {};
+	}
+
+	void TextureStreamer::SetBudget(uint64_t bytes)
+	{
+		this->m_Budget = bytes;
+	}
+
+	const TextureStreamerStats& TextureStreamer::GetStats() const
+	{
+		return this->m_Stats;
+	}
+
+	TextureStreamer* TextureStreamer::GetInstance()
+	{
+		static TextureStreamer s_Instance;
+		return &s_Instance;
+	}
+
+	void TextureStreamer::ApplyLoad(StreamedTexture& streamed)
+	{
+		uint32_t                   level   = streamed.m_LoadLevel;
+		std::unique_ptr<Texture2D> levels  = streamed.m_Load.get();
+		Texture2D&                 texture = *streamed.m_Texture;
+		uint32_t                   count   = static_cast<uint32_t>(streamed.m_LevelBytes.size()) - 1;
+		if (!levels || levels->m_Width != texture.m_Width || levels->m_Height != texture.m_Height || levels->m_Format != texture.m_Format || levels->m_Type != texture.m_Type || GetStoredLevelCount(*levels, level) != count - level)
+		{
+			s_TextureStreamerLogger.LogWarning("Failed to load level %u of '%s', it keeps its resident levels", level, streamed.m_File.c_str());
+			return;
+		}
+
+		uint32_t baseLevel = texture.m_BaseLevel;
+		if (level < baseLevel)
+		{
+			streamed.m_Fade += static_cast<float>(baseLevel - level);
+			this->m_Stats.m_LoadedLevels += baseLevel - level;
+		}
+		else
+		{
+			// Dropped levels aren't faded out, as the texture is drawn smaller than them or the budget needs the memory.
+			streamed.m_Fade = 0.0f;
+			this->m_Stats.m_DroppedLevels += level - baseLevel;
+		}
+
+		texture.m_Data      = std::move(levels->m_Data);
+		texture.m_Mips      = std::move(levels->m_Mips);
+		texture.m_BaseLevel = level;
+		texture.m_MinLod    = streamed.m_Fade > 0.0f ? streamed.m_Fade : streamed.m_MinLod;
+		texture.MarkDirty();
+	}
+
+	void TextureStreamer::StartLoad(StreamedTexture& streamed, uint32_t level)
+	{
+		std::string                     file    = streamed.m_File;
+		textureLoaders::TextureLoadMode mode    = streamed.m_Mode;
+		uint32_t                        maxSize = GetLevelSize(*streamed.m_Texture, level);
+		streamed.m_LoadLevel                    = level;
+		streamed.m_Load                         = JobSystem::GetInstance()->Submit([file, mode, maxSize]() { return textureLoaders::LoadTexture2DLevels(file, maxSize, mode); });
+	}
+
+	float EstimateScreenSize(float radius, float distance, float projectionScale, uint32_t viewportHeight)
+	{
+		if (distance <= radius)
+			return std::numeric_limits<float>::max();
+		return radius * projectionScale * static_cast<float>(viewportHeight) / distance;
+	}
+
+} // namespace gp1::renderer::texture
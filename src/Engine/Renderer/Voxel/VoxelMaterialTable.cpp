@@ -0,0 +1,81 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Renderer/Voxel/VoxelMaterialTable.h"
+#include "Engine/Renderer/Shader/Material.h"
+#include "Engine/Renderer/Shader/Uniform.h"
+#include "Engine/Renderer/Texture/Texture2DArray.h"
+
+namespace gp1::renderer::voxel
+{
+	const VoxelMaterial VoxelMaterialTable::s_DefaultMaterial {};
+
+	VoxelMaterialTable::VoxelMaterialTable(shader::Material* material, texture::Texture2DArray* textures)
+	    : Data(this), m_Material(material)
+	{
+		SetTextures(textures);
+	}
+
+	void VoxelMaterialTable::SetMaterial(uint32_t blockID, const VoxelMaterial& material)
+	{
+		if (blockID >= this->m_Materials.size())
+			this->m_Materials.resize(static_cast<size_t>(blockID) + 1);
+		this->m_Materials[blockID] = material;
+		this->m_DirtyMaterials.Expand(blockID, 1);
+	}
+
+	const VoxelMaterial& VoxelMaterialTable::GetMaterial(uint32_t blockID) const
+	{
+		if (blockID >= this->m_Materials.size())
+			return VoxelMaterialTable::s_DefaultMaterial;
+		return this->m_Materials[blockID];
+	}
+
+	uint32_t VoxelMaterialTable::GetMaterialCount() const
+	{
+		return static_cast<uint32_t>(this->m_Materials.size());
+	}
+
+	const std::vector<VoxelMaterial>& VoxelMaterialTable::GetMaterials() const
+	{
+		return this->m_Materials;
+	}
+
+	void VoxelMaterialTable::SetTextures(texture::Texture2DArray* textures)
+	{
+		this->m_Textures = textures;
+		if (!this->m_Material)
+			return;
+
+		shader::Uniform<texture::Texture2DArray*>* tex = this->m_Material->GetUniform<texture::Texture2DArray*>("tex");
+		if (tex)
+			tex->m_Value = textures;
+	}
+
+	texture::Texture2DArray* VoxelMaterialTable::GetTextures() const
+	{
+		return this->m_Textures;
+	}
+
+	void VoxelMaterialTable::MarkDirty()
+	{
+		this->m_DirtyMaterials.Expand(0, GetMaterialCount());
+	}
+
+	void VoxelMaterialTable::ClearDirty()
+	{
+		this->m_DirtyMaterials.Clear();
+	}
+
+	bool VoxelMaterialTable::IsDirty()
+	{
+		return !this->m_DirtyMaterials.IsEmpty();
+	}
+
+	const mesh::DirtyRange& VoxelMaterialTable::GetDirtyMaterials() const
+	{
+		return this->m_DirtyMaterials;
+	}
+
+} // namespace gp1::renderer::voxel
@@ -58,6 +58,11 @@ namespace gp1::scene
 		return nullptr;
 	}
 
+	const animation::Pose* Entity::GetPose() const
+	{
+		return nullptr;
+	}
+
 	Scene* Entity::GetScene() const
 	{
 		return this->m_Scene;
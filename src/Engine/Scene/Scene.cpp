@@ -5,6 +5,8 @@
 #include "Engine/Scene/Scene.h"
 #include "Engine/Scene/Entity.h"
 
+#include <algorithm>
+
 namespace gp1::scene
 {
 	void Scene::AttachEntity(Entity* entity)
@@ -51,4 +53,42 @@ namespace gp1::scene
 		return this->m_Entities;
 	}
 
+	void Scene::AttachStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group)
+	{
+		if (std::find(this->m_StaticInstanceGroups.begin(), this->m_StaticInstanceGroups.end(), group) == this->m_StaticInstanceGroups.end())
+			this->m_StaticInstanceGroups.push_back(group);
+	}
+
+	void Scene::DetachStaticInstanceGroup(renderer::culling::StaticInstanceGroup* group)
+	{
+		auto itr = std::find(this->m_StaticInstanceGroups.begin(), this->m_StaticInstanceGroups.end(), group);
+		if (itr != this->m_StaticInstanceGroups.end())
+			this->m_StaticInstanceGroups.erase(itr);
+	}
+
+	const std::vector<renderer::culling::StaticInstanceGroup*>& Scene::GetStaticInstanceGroups()
+	{
+		return this->m_StaticInstanceGroups;
+	}
+
+	void Scene::SetVoxelMaterialTable(renderer::voxel::VoxelMaterialTable* table)
+	{
+		this->m_VoxelMaterialTable = table;
+	}
+
+	renderer::voxel::VoxelMaterialTable* Scene::GetVoxelMaterialTable()
+	{
+		return this->m_VoxelMaterialTable;
+	}
+
+	void Scene::SetWorldPartition(voxel::WorldPartition* worldPartition)
+	{
+		this->m_WorldPartition = worldPartition;
+	}
+
+	voxel::WorldPartition* Scene::GetWorldPartition()
+	{
+		return this->m_WorldPartition;
+	}
+
 } // namespace gp1::scene
@@ -0,0 +1,108 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Utility/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace gp1
+{
+	JobSystem::JobSystem(uint32_t workerCount)
+	{
+		if (workerCount == 0)
+			workerCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+
+		this->m_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+			this->m_Workers.emplace_back(&JobSystem::WorkerLoop, this);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->m_Mutex);
+			this->m_Running = false;
+		}
+		this->m_Condition.notify_all();
+
+		for (std::thread& worker : this->m_Workers)
+			worker.join();
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& job)
+	{
+		if (count == 0)
+			return;
+
+		// The state outlives this call, helpers that start after the work is done just find nothing left.
+		struct State
+		{
+			std::function<void(uint32_t)> m_Job;
+			uint32_t                      m_Count;
+			std::atomic<uint32_t>         m_Next { 0 };
+			std::atomic<uint32_t>         m_Finished { 0 };
+		};
+		auto state     = std::make_shared<State>();
+		state->m_Job   = job;
+		state->m_Count = count;
+
+		auto work = [state]() {
+			uint32_t index;
+			while ((index = state->m_Next.fetch_add(1)) < state->m_Count)
+			{
+				state->m_Job(index);
+				state->m_Finished.fetch_add(1, std::memory_order_release);
+			}
+		};
+
+		uint32_t helpers = std::min(count - 1, static_cast<uint32_t>(this->m_Workers.size()));
+		for (uint32_t i = 0; i < helpers; i++)
+			Push(work);
+		work();
+
+		// Only indices another thread already started are left.
+		while (state->m_Finished.load(std::memory_order_acquire) < count)
+			std::this_thread::yield();
+	}
+
+	uint32_t JobSystem::GetWorkerCount() const
+	{
+		return static_cast<uint32_t>(this->m_Workers.size());
+	}
+
+	JobSystem* JobSystem::GetInstance()
+	{
+		static JobSystem s_Instance;
+		return &s_Instance;
+	}
+
+	void JobSystem::Push(std::function<void()> job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->m_Mutex);
+			this->m_Jobs.push_back(std::move(job));
+		}
+		this->m_Condition.notify_one();
+	}
+
+	void JobSystem::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(this->m_Mutex);
+				this->m_Condition.wait(lock, [this]() { return !this->m_Running || !this->m_Jobs.empty(); });
+				if (!this->m_Running && this->m_Jobs.empty())
+					return;
+
+				job = std::move(this->m_Jobs.front());
+				this->m_Jobs.pop_front();
+			}
+			job();
+		}
+	}
+
+} // namespace gp1
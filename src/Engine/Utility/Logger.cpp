@@ -168,8 +168,12 @@ namespace gp1
 		auto itr = Logger::s_DisabledSeverities.find(severity);
 		if (itr != Logger::s_DisabledSeverities.end()) return;
 
-		uint32_t length = vsnprintf(nullptr, 0, format, args) + 1;
-		char*    buf    = new char[length];
+		// The size query consumes its va_list, so it gets a copy.
+		va_list sizeArgs;
+		va_copy(sizeArgs, args);
+		uint32_t length = vsnprintf(nullptr, 0, format, sizeArgs) + 1;
+		va_end(sizeArgs);
+		char* buf = new char[length];
 		vsnprintf(buf, length, format, args);
 
 		std::string message(buf);
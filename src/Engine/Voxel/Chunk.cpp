@@ -0,0 +1,298 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/Chunk.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace gp1::voxel
+{
+	// Serialized chunks start with "GPCK" followed by the format version.
+	constexpr uint32_t s_SerializedMagic   = 0x4B435047;
+	constexpr uint8_t  s_SerializedVersion = 1;
+
+	// Get the number of 64 bit words needed to pack the chunk's indices.
+	constexpr size_t GetWordCount(uint32_t bitsPerIndex)
+	{
+		if (bitsPerIndex == 0)
+			return 0;
+		uint32_t indicesPerWord = 64 / bitsPerIndex;
+		return (Chunk::s_Volume + indicesPerWord - 1) / indicesPerWord;
+	}
+
+	// Get the fewest bits that can index a palette of the given size.
+	static uint32_t GetBitsForPalette(size_t paletteSize)
+	{
+		uint32_t bits = 0;
+		while ((1ULL << bits) < paletteSize)
+			bits++;
+		return bits;
+	}
+
+	Chunk::Chunk(const glm::ivec3& position)
+	    : m_Position(position), m_Palette({ s_AirBlock }), m_PaletteCounts({ s_Volume }) {}
+
+	BlockID Chunk::GetBlock(uint32_t x, uint32_t y, uint32_t z) const
+	{
+		return this->m_Palette[GetPaletteIndex(GetIndex(x, y, z))];
+	}
+
+	void Chunk::SetBlock(uint32_t x, uint32_t y, uint32_t z, BlockID block)
+	{
+		uint32_t index        = GetIndex(x, y, z);
+		uint32_t paletteIndex = GetPaletteIndex(index);
+		if (this->m_Palette[paletteIndex] == block)
+			return;
+
+		uint32_t newPaletteIndex = FindOrAddPaletteEntry(block);
+		this->m_PaletteCounts[paletteIndex]--;
+		this->m_PaletteCounts[newPaletteIndex]++;
+
+		// Chunks that become a single block again drop their indices.
+		if (this->m_PaletteCounts[newPaletteIndex] == s_Volume)
+		{
+			Fill(block);
+			return;
+		}
+
+		SetPaletteIndex(index, newPaletteIndex);
+	}
+
+	void Chunk::Fill(BlockID block)
+	{
+		this->m_Palette       = { block };
+		this->m_PaletteCounts = { s_Volume };
+		this->m_BitsPerIndex  = 0;
+		this->m_Indices.clear();
+		this->m_Indices.shrink_to_fit();
+	}
+
+	void Chunk::Decompress(BlockID* blocks) const
+	{
+		if (this->m_BitsPerIndex == 0)
+		{
+			std::fill_n(blocks, s_Volume, this->m_Palette[0]);
+			return;
+		}
+
+		uint32_t bits           = this->m_BitsPerIndex;
+		uint32_t indicesPerWord = 64 / bits;
+		uint64_t mask           = (1ULL << bits) - 1;
+		uint32_t index          = 0;
+		for (uint64_t word : this->m_Indices)
+		{
+			for (uint32_t i = 0; i < indicesPerWord && index < s_Volume; i++, index++)
+			{
+				blocks[index] = this->m_Palette[static_cast<uint32_t>(word & mask)];
+				word >>= bits;
+			}
+		}
+	}
+
+	void Chunk::Compact()
+	{
+		std::vector<BlockID>  palette;
+		std::vector<uint32_t> counts;
+		std::vector<uint32_t> remap(this->m_Palette.size(), 0);
+		for (size_t i = 0; i < this->m_Palette.size(); i++)
+		{
+			if (this->m_PaletteCounts[i] == 0)
+				continue;
+			remap[i] = static_cast<uint32_t>(palette.size());
+			palette.push_back(this->m_Palette[i]);
+			counts.push_back(this->m_PaletteCounts[i]);
+		}
+
+		if (palette.size() == this->m_Palette.size() && GetBitsForPalette(palette.size()) == this->m_BitsPerIndex)
+			return;
+
+		if (palette.size() == 1)
+		{
+			Fill(palette[0]);
+			return;
+		}
+
+		Repack(GetBitsForPalette(palette.size()), remap);
+		this->m_Palette       = std::move(palette);
+		this->m_PaletteCounts = std::move(counts);
+	}
+
+	bool Chunk::IsUniform() const
+	{
+		return std::find(this->m_PaletteCounts.begin(), this->m_PaletteCounts.end(), s_Volume) != this->m_PaletteCounts.end();
+	}
+
+	bool Chunk::IsEmpty() const
+	{
+		for (size_t i = 0; i < this->m_Palette.size(); i++)
+			if (this->m_Palette[i] == s_AirBlock && this->m_PaletteCounts[i] == s_Volume)
+				return true;
+		return false;
+	}
+
+	uint32_t Chunk::GetBitsPerIndex() const
+	{
+		return this->m_BitsPerIndex;
+	}
+
+	const std::vector<BlockID>& Chunk::GetPalette() const
+	{
+		return this->m_Palette;
+	}
+
+	ChunkMemoryStats Chunk::GetMemoryStats() const
+	{
+		ChunkMemoryStats stats;
+		stats.m_PaletteBytes = this->m_Palette.capacity() * sizeof(BlockID) + this->m_PaletteCounts.capacity() * sizeof(uint32_t);
+		stats.m_IndexBytes   = this->m_Indices.capacity() * sizeof(uint64_t);
+		stats.m_TotalBytes   = sizeof(Chunk) + stats.m_PaletteBytes + stats.m_IndexBytes;
+		stats.m_PaletteSize  = static_cast<uint32_t>(this->m_Palette.size());
+		stats.m_BitsPerIndex = this->m_BitsPerIndex;
+		return stats;
+	}
+
+	void Chunk::Serialize(std::vector<uint8_t>& data)
+	{
+		Compact();
+
+		// Header: magic, version, bits per index, 2 bytes padding, palette size.
+		// The palette and the packed words follow in native byte order.
+		uint32_t paletteSize  = static_cast<uint32_t>(this->m_Palette.size());
+		size_t   offset       = data.size();
+		size_t   paletteBytes = paletteSize * sizeof(BlockID);
+		size_t   indexBytes   = this->m_Indices.size() * sizeof(uint64_t);
+		data.resize(offset + 12 + paletteBytes + indexBytes);
+
+		uint8_t* out = data.data() + offset;
+		std::memcpy(out, &s_SerializedMagic, 4);
+		out[4] = s_SerializedVersion;
+		out[5] = static_cast<uint8_t>(this->m_BitsPerIndex);
+		out[6] = 0;
+		out[7] = 0;
+		std::memcpy(out + 8, &paletteSize, 4);
+		std::memcpy(out + 12, this->m_Palette.data(), paletteBytes);
+		std::memcpy(out + 12 + paletteBytes, this->m_Indices.data(), indexBytes);
+	}
+
+	bool Chunk::Deserialize(const uint8_t* data, size_t size)
+	{
+		if (size < 12)
+			return false;
+
+		uint32_t magic;
+		uint32_t paletteSize;
+		std::memcpy(&magic, data, 4);
+		std::memcpy(&paletteSize, data + 8, 4);
+		uint32_t bits = data[5];
+		if (magic != s_SerializedMagic || data[4] != s_SerializedVersion || bits > 16 || paletteSize == 0 || paletteSize > (1ULL << bits))
+			return false;
+
+		size_t paletteBytes = paletteSize * sizeof(BlockID);
+		size_t wordCount    = GetWordCount(bits);
+		if (size < 12 + paletteBytes + wordCount * sizeof(uint64_t))
+			return false;
+
+		std::vector<BlockID>  palette(paletteSize);
+		std::vector<uint64_t> indices(wordCount);
+		std::memcpy(palette.data(), data + 12, paletteBytes);
+		std::memcpy(indices.data(), data + 12 + paletteBytes, wordCount * sizeof(uint64_t));
+
+		// Count the palette entries, which also validates the indices.
+		std::vector<uint32_t> counts(paletteSize, 0);
+		if (bits == 0)
+		{
+			counts[0] = s_Volume;
+		}
+		else
+		{
+			uint32_t indicesPerWord = 64 / bits;
+			uint64_t mask           = (1ULL << bits) - 1;
+			uint32_t index          = 0;
+			for (uint64_t word : indices)
+			{
+				for (uint32_t i = 0; i < indicesPerWord && index < s_Volume; i++, index++)
+				{
+					uint32_t paletteIndex = static_cast<uint32_t>(word & mask);
+					if (paletteIndex >= paletteSize)
+						return false;
+					counts[paletteIndex]++;
+					word >>= bits;
+				}
+			}
+		}
+
+		this->m_Palette       = std::move(palette);
+		this->m_PaletteCounts = std::move(counts);
+		this->m_Indices       = std::move(indices);
+		this->m_BitsPerIndex  = bits;
+		return true;
+	}
+
+	const glm::ivec3& Chunk::GetPosition() const
+	{
+		return this->m_Position;
+	}
+
+	uint32_t Chunk::GetPaletteIndex(uint32_t index) const
+	{
+		if (this->m_BitsPerIndex == 0)
+			return 0;
+
+		uint32_t indicesPerWord = 64 / this->m_BitsPerIndex;
+		uint32_t shift          = (index % indicesPerWord) * this->m_BitsPerIndex;
+		return static_cast<uint32_t>((this->m_Indices[index / indicesPerWord] >> shift) & ((1ULL << this->m_BitsPerIndex) - 1));
+	}
+
+	void Chunk::SetPaletteIndex(uint32_t index, uint32_t paletteIndex)
+	{
+		uint32_t  indicesPerWord = 64 / this->m_BitsPerIndex;
+		uint32_t  shift          = (index % indicesPerWord) * this->m_BitsPerIndex;
+		uint64_t  mask           = ((1ULL << this->m_BitsPerIndex) - 1) << shift;
+		uint64_t& word           = this->m_Indices[index / indicesPerWord];
+		word                     = (word & ~mask) | (static_cast<uint64_t>(paletteIndex) << shift);
+	}
+
+	uint32_t Chunk::FindOrAddPaletteEntry(BlockID block)
+	{
+		uint32_t freeEntry = ~0U;
+		for (uint32_t i = 0; i < this->m_Palette.size(); i++)
+		{
+			if (this->m_Palette[i] == block)
+				return i;
+			if (freeEntry == ~0U && this->m_PaletteCounts[i] == 0)
+				freeEntry = i;
+		}
+
+		// Reuse an entry no block refers to anymore before growing the palette.
+		if (freeEntry != ~0U)
+		{
+			this->m_Palette[freeEntry] = block;
+			return freeEntry;
+		}
+
+		this->m_Palette.push_back(block);
+		this->m_PaletteCounts.push_back(0);
+		if (this->m_Palette.size() > (1ULL << this->m_BitsPerIndex))
+			Repack(this->m_BitsPerIndex + 1);
+		return static_cast<uint32_t>(this->m_Palette.size() - 1);
+	}
+
+	void Chunk::Repack(uint32_t bitsPerIndex, const std::vector<uint32_t>& remap)
+	{
+		std::vector<uint64_t> indices(GetWordCount(bitsPerIndex), 0);
+		uint32_t              indicesPerWord = 64 / bitsPerIndex;
+		for (uint32_t i = 0; i < s_Volume; i++)
+		{
+			uint32_t paletteIndex = GetPaletteIndex(i);
+			if (!remap.empty())
+				paletteIndex = remap[paletteIndex];
+			indices[i / indicesPerWord] |= static_cast<uint64_t>(paletteIndex) << ((i % indicesPerWord) * bitsPerIndex);
+		}
+
+		this->m_Indices      = std::move(indices);
+		this->m_BitsPerIndex = bitsPerIndex;
+	}
+
+} // namespace gp1::voxel
@@ -0,0 +1,40 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/ChunkEntity.h"
+#include "Engine/Renderer/Voxel/VoxelMaterialTable.h"
+#include "Engine/Scene/Scene.h"
+#include "Engine/Voxel/ChunkRemesher.h"
+
+namespace gp1::voxel
+{
+	ChunkEntity::ChunkEntity(const ChunkRemesher& remesher, const glm::ivec3& position)
+	    : m_Remesher(remesher), m_ChunkPosition(position)
+	{
+		this->m_Position = glm::fvec3(position) * static_cast<float>(Chunk::s_Size);
+	}
+
+	renderer::mesh::Mesh* ChunkEntity::GetMesh() const
+	{
+		renderer::mesh::StaticVoxelMesh* mesh = this->m_Remesher.GetMesh(this->m_ChunkPosition);
+		if (!mesh || mesh->m_Indices.empty())
+			return nullptr;
+		return mesh;
+	}
+
+	renderer::shader::Material* ChunkEntity::GetMaterial() const
+	{
+		if (!this->m_Scene)
+			return nullptr;
+
+		renderer::voxel::VoxelMaterialTable* table = this->m_Scene->GetVoxelMaterialTable();
+		return table ? table->m_Material : nullptr;
+	}
+
+	const glm::ivec3& ChunkEntity::GetChunkPosition() const
+	{
+		return this->m_ChunkPosition;
+	}
+
+} // namespace gp1::voxel
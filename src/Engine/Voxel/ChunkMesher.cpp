@@ -0,0 +1,217 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/ChunkMesher.h"
+#include "Engine/Utility/JobSystem.h"
+
+#include <algorithm>
+
+namespace gp1::voxel
+{
+	constexpr int32_t s_PaddedSize = static_cast<int32_t>(s_PaddedChunkSize);
+
+	constexpr int32_t PaddedIndex(int32_t x, int32_t y, int32_t z)
+	{
+		return ((y + 1) * s_PaddedSize + (z + 1)) * s_PaddedSize + (x + 1);
+	}
+
+	void ExtractPaddedBlocks(BlockID* padded, const Chunk& chunk, const ChunkNeighbours& neighbours)
+	{
+		std::fill(padded, padded + s_PaddedChunkVolume, s_AirBlock);
+
+		// Unpacking the whole chunk at once is much cheaper than looking up every block.
+		constexpr int32_t                 size = static_cast<int32_t>(Chunk::s_Size);
+		thread_local std::vector<BlockID> blocks(Chunk::s_Volume);
+		chunk.Decompress(blocks.data());
+		for (int32_t y = 0; y < size; y++)
+			for (int32_t z = 0; z < size; z++)
+				std::copy_n(blocks.begin() + Chunk::GetIndex(0, y, z), size, padded + PaddedIndex(0, y, z));
+
+		for (uint32_t face = 0; face < 6; face++)
+		{
+			const Chunk* neighbour = neighbours.m_Chunks[face];
+			if (!neighbour)
+				continue;
+
+			// The axis and the layer of the border and the neighbour layer it's copied from.
+			uint32_t d      = face / 2;
+			bool     front  = (face & 1) == 0;
+			int32_t  border = front ? size : -1;
+			uint32_t source = front ? 0 : size - 1;
+			uint32_t u      = (d + 1) % 3;
+			uint32_t v      = (d + 2) % 3;
+			for (int32_t j = 0; j < size; j++)
+			{
+				for (int32_t i = 0; i < size; i++)
+				{
+					int32_t  dst[3];
+					uint32_t src[3];
+					dst[d] = border;
+					src[d] = source;
+					dst[u] = src[u] = i;
+					dst[v] = src[v] = j;
+					padded[PaddedIndex(dst[0], dst[1], dst[2])] = neighbour->GetBlock(src[0], src[1], src[2]);
+				}
+			}
+		}
+	}
+
+	// Add a quad facing along axis d, i, j, width and height are along the axes after d.
+	static void EmitQuad(std::vector<renderer::mesh::StaticVoxelMeshVertex>& vertices, std::vector<uint32_t>& indices, uint32_t d, bool positive, int32_t slice, int32_t i, int32_t j, int32_t width, int32_t height, BlockID block)
+	{
+		uint32_t u = (d + 1) % 3;
+		uint32_t v = (d + 2) % 3;
+
+		glm::fvec3 base { 0.0f, 0.0f, 0.0f };
+		glm::fvec3 du { 0.0f, 0.0f, 0.0f };
+		glm::fvec3 dv { 0.0f, 0.0f, 0.0f };
+		glm::fvec3 normal { 0.0f, 0.0f, 0.0f };
+		base[d]   = static_cast<float>(positive ? slice + 1 : slice);
+		base[u]   = static_cast<float>(i);
+		base[v]   = static_cast<float>(j);
+		du[u]     = static_cast<float>(width);
+		dv[v]     = static_cast<float>(height);
+		normal[d] = positive ? 1.0f : -1.0f;
+
+		float    w     = static_cast<float>(width);
+		float    h     = static_cast<float>(height);
+		uint32_t first = static_cast<uint32_t>(vertices.size());
+		vertices.push_back({ base, normal, { 0.0f, 0.0f }, block });
+		vertices.push_back({ base + du, normal, { w, 0.0f }, block });
+		vertices.push_back({ base + du + dv, normal, { w, h }, block });
+		vertices.push_back({ base + dv, normal, { 0.0f, h }, block });
+
+		// u cross v is +d, so the positive faces are counter clockwise in corner order.
+		if (positive)
+		{
+			indices.insert(indices.end(), { first, first + 1, first + 2, first, first + 2, first + 3 });
+		}
+		else
+		{
+			indices.insert(indices.end(), { first, first + 2, first + 1, first, first + 3, first + 2 });
+		}
+	}
+
+	template <bool Greedy>
+	void GenerateRegionMesh(const BlockID* padded, const glm::ivec3& min, const glm::ivec3& max, std::vector<renderer::mesh::StaticVoxelMeshVertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		// Scratch memory is kept per thread so meshing doesn't allocate once warmed up.
+		thread_local std::vector<BlockID> mask(Chunk::s_Size * Chunk::s_Size);
+
+		for (uint32_t d = 0; d < 3; d++)
+		{
+			uint32_t u      = (d + 1) % 3;
+			uint32_t v      = (d + 2) % 3;
+			int32_t  width  = max[u] - min[u];
+			int32_t  height = max[v] - min[v];
+
+			int32_t step[3] = { 0, 0, 0 };
+			for (bool positive : { true, false })
+			{
+				step[d] = positive ? 1 : -1;
+				int32_t offset = PaddedIndex(step[0], step[1], step[2]) - PaddedIndex(0, 0, 0);
+
+				for (int32_t slice = min[d]; slice < max[d]; slice++)
+				{
+					// A face is visible where a block borders air.
+					int32_t position[3];
+					position[d] = slice;
+					for (int32_t j = 0; j < height; j++)
+					{
+						position[v] = min[v] + j;
+						for (int32_t i = 0; i < width; i++)
+						{
+							position[u]   = min[u] + i;
+							int32_t index = PaddedIndex(position[0], position[1], position[2]);
+							BlockID block = padded[index];
+
+							mask[j * width + i] = (block != s_AirBlock && padded[index + offset] == s_AirBlock) ? block : s_AirBlock;
+						}
+					}
+
+					for (int32_t j = 0; j < height; j++)
+					{
+						for (int32_t i = 0; i < width;)
+						{
+							BlockID block = mask[j * width + i];
+							if (block == s_AirBlock)
+							{
+								i++;
+								continue;
+							}
+
+							int32_t quadWidth  = 1;
+							int32_t quadHeight = 1;
+							if constexpr (Greedy)
+							{
+								while (i + quadWidth < width && mask[j * width + i + quadWidth] == block)
+									quadWidth++;
+
+								bool extend = true;
+								while (extend && j + quadHeight < height)
+								{
+									for (int32_t k = 0; k < quadWidth; k++)
+									{
+										if (mask[(j + quadHeight) * width + i + k] != block)
+										{
+											extend = false;
+											break;
+										}
+									}
+									if (extend)
+										quadHeight++;
+								}
+
+								for (int32_t l = 0; l < quadHeight; l++)
+									std::fill_n(mask.begin() + (j + l) * width + i, quadWidth, s_AirBlock);
+							}
+
+							EmitQuad(vertices, indices, d, positive, slice, min[u] + i, min[v] + j, quadWidth, quadHeight, block);
+							i += quadWidth;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	template <bool Greedy>
+	void GenerateChunkMesh(renderer::mesh::StaticVoxelMesh& mesh, const Chunk& chunk, const ChunkNeighbours& neighbours)
+	{
+		thread_local std::vector<BlockID> padded(s_PaddedChunkVolume);
+		ExtractPaddedBlocks(padded.data(), chunk, neighbours);
+
+		mesh.m_Vertices.clear();
+		mesh.m_Indices.clear();
+		GenerateRegionMesh<Greedy>(padded.data(), { 0, 0, 0 }, glm::ivec3(static_cast<int32_t>(Chunk::s_Size)), mesh.m_Vertices, mesh.m_Indices);
+		mesh.MarkDirty();
+	}
+
+	void GenerateGreedyRegionMesh(const BlockID* padded, const glm::ivec3& min, const glm::ivec3& max, std::vector<renderer::mesh::StaticVoxelMeshVertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		GenerateRegionMesh<true>(padded, min, max, vertices, indices);
+	}
+
+	void GenerateGreedyChunkMesh(renderer::mesh::StaticVoxelMesh& mesh, const Chunk& chunk, const ChunkNeighbours& neighbours)
+	{
+		GenerateChunkMesh<true>(mesh, chunk, neighbours);
+	}
+
+	void GenerateNaiveChunkMesh(renderer::mesh::StaticVoxelMesh& mesh, const Chunk& chunk, const ChunkNeighbours& neighbours)
+	{
+		GenerateChunkMesh<false>(mesh, chunk, neighbours);
+	}
+
+	void GenerateChunkMeshes(const std::vector<ChunkMeshJob>& jobs, bool greedy)
+	{
+		JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(jobs.size()), [&jobs, greedy](uint32_t i) {
+			const ChunkMeshJob& job = jobs[i];
+			if (greedy)
+				GenerateGreedyChunkMesh(*job.m_Mesh, *job.m_Chunk, job.m_Neighbours);
+			else
+				GenerateNaiveChunkMesh(*job.m_Mesh, *job.m_Chunk, job.m_Neighbours);
+		});
+	}
+
+} // namespace gp1::voxel
@@ -0,0 +1,243 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/ChunkOctree.h"
+
+#include <algorithm>
+
+namespace gp1::voxel
+{
+	// Split a block position into its chunk position and the position inside the chunk.
+	static void SplitBlockPosition(const glm::ivec3& position, glm::ivec3& chunkPosition, glm::uvec3& local)
+	{
+		constexpr int32_t size = static_cast<int32_t>(Chunk::s_Size);
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			int32_t value    = position[i];
+			chunkPosition[i] = (value >= 0 ? value : value - size + 1) / size;
+			local[i]         = static_cast<uint32_t>(value - chunkPosition[i] * size);
+		}
+	}
+
+	ChunkOctree::ChunkOctree(uint32_t depth)
+	    : m_Root(std::make_unique<Node>()), m_Depth(std::clamp(depth, 1U, 30U)), m_HalfSize(1 << (m_Depth - 1)) {}
+
+	bool ChunkOctree::Contains(const glm::ivec3& position) const
+	{
+		for (uint32_t i = 0; i < 3; i++)
+			if (position[i] < -this->m_HalfSize || position[i] >= this->m_HalfSize)
+				return false;
+		return true;
+	}
+
+	Chunk* ChunkOctree::GetChunk(const glm::ivec3& position) const
+	{
+		if (!Contains(position))
+			return nullptr;
+
+		glm::uvec3  offset = ToOffset(position);
+		const Node* node   = this->m_Root.get();
+		for (uint32_t level = this->m_Depth; level-- > 0 && node;)
+			node = node->m_Children[GetChildIndex(offset, level)].get();
+		return node ? node->m_Chunk.get() : nullptr;
+	}
+
+	Chunk* ChunkOctree::GetOrCreateChunk(const glm::ivec3& position)
+	{
+		if (!Contains(position))
+			return nullptr;
+
+		Node* node = GetOrCreateLeaf(position);
+		if (!node->m_Chunk)
+			node->m_Chunk = std::make_unique<Chunk>(position);
+		return node->m_Chunk.get();
+	}
+
+	Chunk* ChunkOctree::InsertChunk(std::unique_ptr<Chunk> chunk)
+	{
+		if (!chunk || !Contains(chunk->GetPosition()))
+			return nullptr;
+
+		Node* node    = GetOrCreateLeaf(chunk->GetPosition());
+		node->m_Chunk = std::move(chunk);
+		return node->m_Chunk.get();
+	}
+
+	std::unique_ptr<Chunk> ChunkOctree::ExtractChunk(const glm::ivec3& position)
+	{
+		if (!Contains(position))
+			return nullptr;
+
+		// Remember the links down to the leaf, so the branch can be pruned without visiting the rest of the tree.
+		std::unique_ptr<Node>* path[31];
+		uint32_t               pathLength = 0;
+		glm::uvec3             offset     = ToOffset(position);
+		std::unique_ptr<Node>* link       = &this->m_Root;
+		for (uint32_t level = this->m_Depth; level-- > 0;)
+		{
+			path[pathLength++] = link;
+			link               = &(*link)->m_Children[GetChildIndex(offset, level)];
+			if (!*link)
+				return nullptr;
+		}
+
+		std::unique_ptr<Chunk> chunk = std::move((*link)->m_Chunk);
+		if (!chunk)
+			return nullptr;
+
+		link->reset();
+		// The root is kept even when the octree becomes empty.
+		while (pathLength > 1)
+		{
+			std::unique_ptr<Node>& parent = *path[--pathLength];
+			for (std::unique_ptr<Node>& child : parent->m_Children)
+				if (child)
+					return chunk;
+			parent.reset();
+		}
+		return chunk;
+	}
+
+	void ChunkOctree::RemoveChunk(const glm::ivec3& position)
+	{
+		ExtractChunk(position);
+	}
+
+	uint32_t ChunkOctree::RemoveEmptyChunks()
+	{
+		uint32_t removed = 0;
+		RemoveChunks(this->m_Root, [](Chunk& chunk) { return chunk.IsEmpty(); }, removed);
+		if (!this->m_Root)
+			this->m_Root = std::make_unique<Node>();
+		return removed;
+	}
+
+	BlockID ChunkOctree::GetBlock(const glm::ivec3& position) const
+	{
+		glm::ivec3 chunkPosition;
+		glm::uvec3 local;
+		SplitBlockPosition(position, chunkPosition, local);
+
+		Chunk* chunk = GetChunk(chunkPosition);
+		return chunk ? chunk->GetBlock(local.x, local.y, local.z) : s_AirBlock;
+	}
+
+	void ChunkOctree::SetBlock(const glm::ivec3& position, BlockID block)
+	{
+		glm::ivec3 chunkPosition;
+		glm::uvec3 local;
+		SplitBlockPosition(position, chunkPosition, local);
+
+		Chunk* chunk = block == s_AirBlock ? GetChunk(chunkPosition) : GetOrCreateChunk(chunkPosition);
+		if (chunk)
+			chunk->SetBlock(local.x, local.y, local.z, block);
+	}
+
+	void ChunkOctree::ForEachChunk(const std::function<void(Chunk&)>& function) const
+	{
+		ForEachChunkInNode(*this->m_Root, { 0, 0, 0 }, 1U << this->m_Depth, { 0, 0, 0 }, glm::uvec3(~0U), function);
+	}
+
+	void ChunkOctree::ForEachChunkInBox(const glm::ivec3& min, const glm::ivec3& max, const std::function<void(Chunk&)>& function) const
+	{
+		glm::ivec3 clampedMin = glm::max(min, glm::ivec3(-this->m_HalfSize));
+		glm::ivec3 clampedMax = glm::min(max, glm::ivec3(this->m_HalfSize - 1));
+		if (clampedMin.x > clampedMax.x || clampedMin.y > clampedMax.y || clampedMin.z > clampedMax.z)
+			return;
+
+		ForEachChunkInNode(*this->m_Root, { 0, 0, 0 }, 1U << this->m_Depth, ToOffset(clampedMin), ToOffset(clampedMax), function);
+	}
+
+	ChunkOctreeStats ChunkOctree::GetMemoryStats() const
+	{
+		ChunkOctreeStats stats;
+		AccumulateStats(*this->m_Root, stats);
+		return stats;
+	}
+
+	ChunkOctree::Node* ChunkOctree::GetOrCreateLeaf(const glm::ivec3& position)
+	{
+		glm::uvec3 offset = ToOffset(position);
+		Node*      node   = this->m_Root.get();
+		for (uint32_t level = this->m_Depth; level-- > 0;)
+		{
+			std::unique_ptr<Node>& child = node->m_Children[GetChildIndex(offset, level)];
+			if (!child)
+				child = std::make_unique<Node>();
+			node = child.get();
+		}
+		return node;
+	}
+
+	uint32_t ChunkOctree::GetChildIndex(const glm::uvec3& offset, uint32_t level)
+	{
+		return ((offset.x >> level) & 1) | (((offset.y >> level) & 1) << 1) | (((offset.z >> level) & 1) << 2);
+	}
+
+	bool ChunkOctree::RemoveChunks(std::unique_ptr<Node>& node, const std::function<bool(Chunk&)>& predicate, uint32_t& removed)
+	{
+		if (node->m_Chunk && predicate(*node->m_Chunk))
+		{
+			node->m_Chunk.reset();
+			removed++;
+		}
+
+		bool empty = !node->m_Chunk;
+		for (std::unique_ptr<Node>& child : node->m_Children)
+		{
+			if (child && RemoveChunks(child, predicate, removed))
+				child.reset();
+			empty &= !child;
+		}
+
+		if (empty)
+			node.reset();
+		return empty;
+	}
+
+	void ChunkOctree::ForEachChunkInNode(const Node& node, const glm::uvec3& nodeMin, uint32_t nodeSize, const glm::uvec3& min, const glm::uvec3& max, const std::function<void(Chunk&)>& function)
+	{
+		if (node.m_Chunk)
+			function(*node.m_Chunk);
+
+		uint32_t childSize = nodeSize / 2;
+		for (uint32_t i = 0; i < 8; i++)
+		{
+			const Node* child = node.m_Children[i].get();
+			if (!child)
+				continue;
+
+			glm::uvec3 childMin { nodeMin.x + (i & 1) * childSize, nodeMin.y + ((i >> 1) & 1) * childSize, nodeMin.z + ((i >> 2) & 1) * childSize };
+			glm::uvec3 childMax = childMin + glm::uvec3(childSize - 1);
+			if (childMax.x < min.x || childMax.y < min.y || childMax.z < min.z || childMin.x > max.x || childMin.y > max.y || childMin.z > max.z)
+				continue;
+
+			ForEachChunkInNode(*child, childMin, childSize, min, max, function);
+		}
+	}
+
+	void ChunkOctree::AccumulateStats(const Node& node, ChunkOctreeStats& stats)
+	{
+		stats.m_Nodes++;
+		stats.m_NodeBytes += sizeof(Node);
+		if (node.m_Chunk)
+		{
+			ChunkMemoryStats chunkStats = node.m_Chunk->GetMemoryStats();
+			stats.m_Chunks++;
+			stats.m_ChunkBytes += chunkStats.m_TotalBytes;
+			if (chunkStats.m_BitsPerIndex == 0)
+				stats.m_UniformChunks++;
+		}
+
+		for (const std::unique_ptr<Node>& child : node.m_Children)
+			if (child)
+				AccumulateStats(*child, stats);
+	}
+
+	glm::uvec3 ChunkOctree::ToOffset(const glm::ivec3& position) const
+	{
+		return glm::uvec3(position + glm::ivec3(this->m_HalfSize));
+	}
+
+} // namespace gp1::voxel
@@ -0,0 +1,313 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/ChunkRemesher.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Voxel/ChunkMesher.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace gp1::voxel
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr uint32_t s_AllSections = (1U << ChunkRemesher::s_SectionCount) - 1;
+
+	// The neighbour offsets in ChunkFace order.
+	const glm::ivec3 s_NeighbourOffsets[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+	// Get the slot size for the given number of elements, leaving room to grow so small edits don't move the section.
+	static uint32_t GetSlotCapacity(uint32_t count, uint32_t granularity)
+	{
+		uint32_t capacity = count + count / 2 + granularity * 4;
+		return (capacity + granularity - 1) / granularity * granularity;
+	}
+
+	static double MillisecondsSince(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	ChunkRemesher::ChunkRemesher(ChunkOctree& world, uint32_t maxJobsInFlight)
+	    : m_World(world), m_MaxJobsInFlight(std::max(maxJobsInFlight, 1U)) {}
+
+	void ChunkRemesher::MarkBlockDirty(const glm::ivec3& position)
+	{
+		constexpr int32_t size = static_cast<int32_t>(Chunk::s_Size);
+
+		glm::ivec3 chunkPosition;
+		glm::ivec3 local;
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			chunkPosition[i] = (position[i] >= 0 ? position[i] : position[i] - size + 1) / size;
+			local[i]         = position[i] - chunkPosition[i] * size;
+		}
+
+		// The block's faces and the faces of the blocks around it can change, so sections touching it are dirtied too.
+		uint32_t section  = static_cast<uint32_t>(local.y) / s_SectionHeight;
+		uint32_t sections = 1U << section;
+		if (local.y % s_SectionHeight == 0 && section > 0)
+			sections |= 1U << (section - 1);
+		if (local.y % s_SectionHeight == s_SectionHeight - 1 && section < s_SectionCount - 1)
+			sections |= 1U << (section + 1);
+
+		if (this->m_Chunks.find(chunkPosition) == this->m_Chunks.end())
+			MarkChunkDirty(chunkPosition);
+		else
+			MarkSectionsDirty(chunkPosition, sections);
+
+		if (local.x == 0)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_X)], 1U << section);
+		if (local.x == size - 1)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_X)], 1U << section);
+		if (local.z == 0)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_Z)], 1U << section);
+		if (local.z == size - 1)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_Z)], 1U << section);
+		if (local.y == 0)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_Y)], 1U << (s_SectionCount - 1));
+		if (local.y == size - 1)
+			MarkSectionsDirty(chunkPosition + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_Y)], 1U);
+	}
+
+	void ChunkRemesher::MarkChunkDirty(const glm::ivec3& position)
+	{
+		if (!this->m_World.GetChunk(position))
+			return;
+
+		ChunkMeshState& state = this->m_Chunks[position];
+		if (!state.m_Mesh)
+		{
+			state.m_Mesh = std::make_unique<renderer::mesh::StaticVoxelMesh>();
+			state.m_Mesh->SetDynamic(true);
+			state.m_Generation = this->m_NextGeneration++;
+
+			// The neighbours generated faces against this chunk while it was missing.
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_X)], s_AllSections);
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_X)], s_AllSections);
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_Z)], s_AllSections);
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_Z)], s_AllSections);
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::POSITIVE_Y)], 1U);
+			MarkSectionsDirty(position + s_NeighbourOffsets[static_cast<uint32_t>(ChunkFace::NEGATIVE_Y)], 1U << (s_SectionCount - 1));
+		}
+		state.m_DirtySections = s_AllSections;
+	}
+
+	void ChunkRemesher::RemoveChunk(const glm::ivec3& position)
+	{
+		// Running jobs only hold a snapshot, their results are dropped when the chunk is gone or has been added again since.
+		this->m_Chunks.erase(position);
+	}
+
+	renderer::mesh::StaticVoxelMesh* ChunkRemesher::GetMesh(const glm::ivec3& position) const
+	{
+		auto itr = this->m_Chunks.find(position);
+		return itr != this->m_Chunks.end() ? itr->second.m_Mesh.get() : nullptr;
+	}
+
+	void ChunkRemesher::Update(const glm::fvec3& cameraPosition, double budgetMilliseconds)
+	{
+		auto start    = Clock::now();
+		this->m_Stats = {};
+
+		// Apply finished jobs first, their meshes are the oldest.
+		auto itr = this->m_Jobs.begin();
+		while (itr != this->m_Jobs.end() && MillisecondsSince(start) < budgetMilliseconds)
+		{
+			if (itr->m_Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			{
+				itr++;
+				continue;
+			}
+
+			std::unique_ptr<RemeshResult> result = itr->m_Result.get();
+			auto                          state  = this->m_Chunks.find(itr->m_Position);
+			if (state != this->m_Chunks.end() && state->second.m_Generation == itr->m_Generation)
+			{
+				state->second.m_JobInFlight = false;
+				Apply(state->second, *result);
+			}
+			itr = this->m_Jobs.erase(itr);
+		}
+
+		// Start jobs for the dirty chunks closest to the camera.
+		std::vector<std::pair<float, glm::ivec3>> queue;
+		for (auto& [position, state] : this->m_Chunks)
+		{
+			if (!state.m_DirtySections)
+				continue;
+
+			for (uint32_t i = 0; i < s_SectionCount; i++)
+				if (state.m_DirtySections & (1U << i))
+					this->m_Stats.m_DirtySections++;
+
+			if (!state.m_JobInFlight)
+			{
+				glm::fvec3 offset = (glm::fvec3(position) + 0.5f) * static_cast<float>(Chunk::s_Size) - cameraPosition;
+				queue.push_back({ glm::dot(offset, offset), position });
+			}
+		}
+		std::sort(queue.begin(), queue.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+		for (auto& entry : queue)
+		{
+			if (this->m_Jobs.size() >= this->m_MaxJobsInFlight || MillisecondsSince(start) >= budgetMilliseconds)
+				break;
+			Dispatch(entry.second, this->m_Chunks[entry.second]);
+		}
+
+		this->m_Stats.m_JobsInFlight = static_cast<uint32_t>(this->m_Jobs.size());
+		this->m_Stats.m_Milliseconds = MillisecondsSince(start);
+	}
+
+	const ChunkRemeshStats& ChunkRemesher::GetStats() const
+	{
+		return this->m_Stats;
+	}
+
+	void ChunkRemesher::Dispatch(const glm::ivec3& position, ChunkMeshState& state)
+	{
+		Chunk* chunk = this->m_World.GetChunk(position);
+		if (!chunk)
+		{
+			state.m_DirtySections = 0;
+			return;
+		}
+
+		// The job works on a copy so the chunks can keep being edited while it runs.
+		ChunkNeighbours neighbours;
+		for (uint32_t i = 0; i < 6; i++)
+			neighbours.m_Chunks[i] = this->m_World.GetChunk(position + s_NeighbourOffsets[i]);
+		auto padded = std::make_shared<std::vector<BlockID>>(s_PaddedChunkVolume);
+		ExtractPaddedBlocks(padded->data(), *chunk, neighbours);
+
+		uint32_t sections     = state.m_DirtySections;
+		state.m_DirtySections = 0;
+		state.m_JobInFlight   = true;
+
+		auto result = JobSystem::GetInstance()->Submit([padded, sections]() {
+			auto result        = std::make_unique<RemeshResult>();
+			result->m_Sections = sections;
+			for (uint32_t i = 0; i < s_SectionCount; i++)
+			{
+				if (!(sections & (1U << i)))
+					continue;
+
+				int32_t bottom = static_cast<int32_t>(i * s_SectionHeight);
+				int32_t size   = static_cast<int32_t>(Chunk::s_Size);
+				GenerateGreedyRegionMesh(padded->data(), { 0, bottom, 0 }, { size, bottom + static_cast<int32_t>(s_SectionHeight), size }, result->m_Meshes[i].m_Vertices, result->m_Meshes[i].m_Indices);
+			}
+			return result;
+		});
+		this->m_Jobs.push_back({ position, state.m_Generation, std::move(result) });
+	}
+
+	void ChunkRemesher::Apply(ChunkMeshState& state, RemeshResult& result)
+	{
+		if (!state.m_HasLayout)
+		{
+			RebuildLayout(state, result);
+			return;
+		}
+
+		for (uint32_t i = 0; i < s_SectionCount; i++)
+		{
+			if ((result.m_Sections & (1U << i)) && (result.m_Meshes[i].m_Vertices.size() > state.m_Sections[i].m_VertexCapacity || result.m_Meshes[i].m_Indices.size() > state.m_Sections[i].m_IndexCapacity))
+			{
+				RebuildLayout(state, result);
+				return;
+			}
+		}
+
+		renderer::mesh::StaticVoxelMesh& mesh = *state.m_Mesh;
+		for (uint32_t i = 0; i < s_SectionCount; i++)
+		{
+			if (!(result.m_Sections & (1U << i)))
+				continue;
+
+			Section&           section     = state.m_Sections[i];
+			const SectionMesh& sectionMesh = result.m_Meshes[i];
+			uint32_t           vertexCount = static_cast<uint32_t>(sectionMesh.m_Vertices.size());
+			uint32_t           indexCount  = static_cast<uint32_t>(sectionMesh.m_Indices.size());
+
+			std::copy(sectionMesh.m_Vertices.begin(), sectionMesh.m_Vertices.end(), mesh.m_Vertices.begin() + section.m_FirstVertex);
+			for (uint32_t j = 0; j < indexCount; j++)
+				mesh.m_Indices[section.m_FirstIndex + j] = section.m_FirstVertex + sectionMesh.m_Indices[j];
+
+			// Indices the section no longer uses become degenerate triangles.
+			uint32_t dirtyIndices = std::max(indexCount, section.m_IndexCount);
+			std::fill(mesh.m_Indices.begin() + section.m_FirstIndex + indexCount, mesh.m_Indices.begin() + section.m_FirstIndex + dirtyIndices, 0U);
+
+			if (vertexCount > 0)
+				mesh.MarkVerticesDirty(section.m_FirstVertex, vertexCount);
+			if (dirtyIndices > 0)
+				mesh.MarkIndicesDirty(section.m_FirstIndex, dirtyIndices);
+
+			section.m_VertexCount = vertexCount;
+			section.m_IndexCount  = indexCount;
+			this->m_Stats.m_SectionsApplied++;
+			this->m_Stats.m_UploadedVertices += vertexCount;
+			this->m_Stats.m_UploadedIndices += dirtyIndices;
+		}
+	}
+
+	void ChunkRemesher::RebuildLayout(ChunkMeshState& state, RemeshResult& result)
+	{
+		renderer::mesh::StaticVoxelMesh& mesh = *state.m_Mesh;
+
+		std::vector<renderer::mesh::StaticVoxelMeshVertex> vertices;
+		std::vector<uint32_t>                              indices;
+		for (uint32_t i = 0; i < s_SectionCount; i++)
+		{
+			Section& section  = state.m_Sections[i];
+			bool     remeshed = (result.m_Sections & (1U << i)) != 0;
+
+			// Sections that weren't remeshed keep their current geometry.
+			const renderer::mesh::StaticVoxelMeshVertex* sourceVertices = remeshed ? result.m_Meshes[i].m_Vertices.data() : mesh.m_Vertices.data() + section.m_FirstVertex;
+			const uint32_t*                              sourceIndices  = remeshed ? result.m_Meshes[i].m_Indices.data() : mesh.m_Indices.data() + section.m_FirstIndex;
+			uint32_t                                     vertexCount    = remeshed ? static_cast<uint32_t>(result.m_Meshes[i].m_Vertices.size()) : section.m_VertexCount;
+			uint32_t                                     indexCount     = remeshed ? static_cast<uint32_t>(result.m_Meshes[i].m_Indices.size()) : section.m_IndexCount;
+			uint32_t                                     oldFirstVertex = remeshed ? 0 : section.m_FirstVertex;
+			if (!state.m_HasLayout && !remeshed)
+				vertexCount = indexCount = 0;
+
+			Section newSection;
+			newSection.m_FirstVertex    = static_cast<uint32_t>(vertices.size());
+			newSection.m_VertexCapacity = GetSlotCapacity(vertexCount, 4);
+			newSection.m_VertexCount    = vertexCount;
+			newSection.m_FirstIndex     = static_cast<uint32_t>(indices.size());
+			newSection.m_IndexCapacity  = GetSlotCapacity(indexCount, 6);
+			newSection.m_IndexCount     = indexCount;
+
+			vertices.insert(vertices.end(), sourceVertices, sourceVertices + vertexCount);
+			vertices.resize(newSection.m_FirstVertex + newSection.m_VertexCapacity);
+			for (uint32_t j = 0; j < indexCount; j++)
+				indices.push_back(sourceIndices[j] - oldFirstVertex + newSection.m_FirstVertex);
+			indices.resize(newSection.m_FirstIndex + newSection.m_IndexCapacity, 0U);
+
+			section = newSection;
+		}
+
+		mesh.m_Vertices.swap(vertices);
+		mesh.m_Indices.swap(indices);
+		mesh.MarkDirty();
+		state.m_HasLayout = true;
+
+		this->m_Stats.m_LayoutRebuilds++;
+		this->m_Stats.m_UploadedVertices += static_cast<uint32_t>(mesh.m_Vertices.size());
+		this->m_Stats.m_UploadedIndices += static_cast<uint32_t>(mesh.m_Indices.size());
+		for (uint32_t i = 0; i < s_SectionCount; i++)
+			if (result.m_Sections & (1U << i))
+				this->m_Stats.m_SectionsApplied++;
+	}
+
+	void ChunkRemesher::MarkSectionsDirty(const glm::ivec3& position, uint32_t sections)
+	{
+		auto itr = this->m_Chunks.find(position);
+		if (itr != this->m_Chunks.end())
+			itr->second.m_DirtySections |= sections;
+	}
+
+} // namespace gp1::voxel
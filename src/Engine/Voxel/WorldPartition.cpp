@@ -0,0 +1,531 @@
+//
+//	Created by agent on 19. Oct. 2026.
+//
+
+#include "Engine/Voxel/WorldPartition.h"
+#include "Engine/Scene/Camera.h"
+#include "Engine/Scene/Scene.h"
+#include "Engine/Utility/JobSystem.h"
+#include "Engine/Utility/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdio.h>
+
+namespace gp1::voxel
+{
+	static Logger s_WorldPartitionLogger("World Partition");
+
+	// Header: magic, version, 3 bytes padding, chunk count.
+	// Every chunk follows as its position, the size of its serialized data and the data.
+	constexpr uint32_t s_CellMagic   = 0x43575047; // "GPWC"
+	constexpr uint8_t  s_CellVersion = 1;
+
+	// The offsets of the six face neighbours of a chunk.
+	const glm::ivec3 s_FaceNeighbours[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+	// Append the non empty chunks to the buffer in the cell file format.
+	static void SerializeCell(const std::vector<Chunk*>& chunks, std::vector<uint8_t>& data)
+	{
+		data.resize(12);
+		std::memcpy(data.data(), &s_CellMagic, 4);
+		data[4] = s_CellVersion;
+		data[5] = 0;
+		data[6] = 0;
+		data[7] = 0;
+
+		uint32_t chunkCount = 0;
+		for (Chunk* chunk : chunks)
+		{
+			if (chunk->IsEmpty())
+				continue;
+
+			size_t offset = data.size();
+			data.resize(offset + 16);
+			chunk->Serialize(data);
+
+			uint32_t size = static_cast<uint32_t>(data.size() - offset - 16);
+			std::memcpy(data.data() + offset, &chunk->GetPosition(), 12);
+			std::memcpy(data.data() + offset + 12, &size, 4);
+			chunkCount++;
+		}
+		std::memcpy(data.data() + 8, &chunkCount, 4);
+	}
+
+	WorldPartition::WorldPartition(ChunkOctree& world, ChunkRemesher& remesher, const std::filesystem::path& directory, uint32_t cellSize)
+	    : m_World(world), m_Remesher(remesher), m_Directory(directory), m_CellSize(static_cast<int32_t>(std::max(cellSize, 1U)))
+	{
+		std::error_code error;
+		std::filesystem::create_directories(this->m_Directory, error);
+		if (error)
+			s_WorldPartitionLogger.LogError("Failed to create the directory '%s'", this->m_Directory.string().c_str());
+	}
+
+	WorldPartition::~WorldPartition()
+	{
+		for (auto& [position, cell] : this->m_Cells)
+		{
+			if (cell.m_State == CellState::LOADING)
+				cell.m_Load.wait();
+			else
+				Unload(position, cell);
+		}
+		this->m_Cells.clear();
+
+		for (auto& [position, save] : this->m_Saves)
+			save.wait();
+	}
+
+	void WorldPartition::SetGenerator(CellGenerator generator)
+	{
+		this->m_Generator = std::move(generator);
+	}
+
+	void WorldPartition::SetRadii(float loadRadius, float unloadRadius)
+	{
+		this->m_LoadRadius   = std::max(loadRadius, 0.0f);
+		this->m_UnloadRadius = std::max(unloadRadius, this->m_LoadRadius);
+	}
+
+	BlockID WorldPartition::GetBlock(const glm::ivec3& position) const
+	{
+		return this->m_World.GetBlock(position);
+	}
+
+	bool WorldPartition::SetBlock(const glm::ivec3& position, BlockID block)
+	{
+		auto itr = this->m_Cells.find(GetCellPosition(position));
+		if (itr == this->m_Cells.end() || itr->second.m_State != CellState::RESIDENT)
+			return false;
+
+		constexpr int32_t size = static_cast<int32_t>(Chunk::s_Size);
+		glm::ivec3        chunkPosition;
+		for (uint32_t i = 0; i < 3; i++)
+			chunkPosition[i] = (position[i] >= 0 ? position[i] : position[i] - size + 1) / size;
+
+		bool existed = this->m_World.GetChunk(chunkPosition);
+		this->m_World.SetBlock(position, block);
+		if (!existed && this->m_World.GetChunk(chunkPosition))
+		{
+			// The first block placed in an empty chunk creates it, so the cell takes it over like a loaded one.
+			itr->second.m_Chunks.push_back(chunkPosition);
+			this->m_Remesher.MarkChunkDirty(chunkPosition);
+			auto entity = std::make_unique<ChunkEntity>(this->m_Remesher, chunkPosition);
+			if (this->m_Scene)
+				this->m_Scene->AttachEntity(entity.get());
+			this->m_Entities[chunkPosition] = std::move(entity);
+		}
+		else
+		{
+			this->m_Remesher.MarkBlockDirty(position);
+		}
+		itr->second.m_Modified = true;
+		return true;
+	}
+
+	void WorldPartition::Update(scene::Scene* scene, double budgetMilliseconds)
+	{
+		auto start   = std::chrono::steady_clock::now();
+		auto elapsed = [start]() { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+
+		this->m_Stats.m_CellsLoaded    = 0;
+		this->m_Stats.m_CellsUnloaded  = 0;
+		this->m_Stats.m_ChunksUploaded = 0;
+
+		if (scene != this->m_Scene)
+		{
+			// Attaching an entity detaches it from its previous scene.
+			for (auto& [position, entity] : this->m_Entities)
+			{
+				if (scene)
+					scene->AttachEntity(entity.get());
+				else if (this->m_Scene)
+					this->m_Scene->DetachEntity(entity.get());
+			}
+			this->m_Scene = scene;
+		}
+
+		scene::Camera* camera = scene ? scene->GetMainCamera() : nullptr;
+		if (!camera)
+			return;
+
+		glm::fvec3 cameraPosition = camera->m_Position;
+		glm::ivec3 cameraCell     = GetCellPosition(glm::ivec3(glm::floor(cameraPosition)));
+
+		CollectSaves();
+
+		// Unload the cells beyond the unload radius and pick up finished loads.
+		auto itr = this->m_Cells.begin();
+		while (itr != this->m_Cells.end())
+		{
+			Cell& cell    = itr->second;
+			bool  outside = glm::length(GetCellCenter(itr->first) - cameraPosition) > this->m_UnloadRadius && itr->first != cameraCell;
+			if (cell.m_State == CellState::LOADING)
+			{
+				// A load can't be cancelled, so a cell left while loading is dropped once the load finishes unless the camera came back.
+				cell.m_Unload = outside;
+				if (cell.m_Load.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+				{
+					if (cell.m_Unload)
+					{
+						itr = this->m_Cells.erase(itr);
+						continue;
+					}
+					cell.m_Data  = cell.m_Load.get();
+					cell.m_State = CellState::UPLOADING;
+				}
+			}
+			else if (outside)
+			{
+				Unload(itr->first, cell);
+				itr = this->m_Cells.erase(itr);
+				this->m_Stats.m_CellsUnloaded++;
+				continue;
+			}
+			++itr;
+		}
+
+		// Start loading the closest missing cells within the load radius.
+		uint32_t pendingLoads = 0;
+		for (auto& [position, cell] : this->m_Cells)
+			if (cell.m_State == CellState::LOADING)
+				pendingLoads++;
+
+		if (pendingLoads < this->m_MaxPendingLoads)
+		{
+			int32_t reach = static_cast<int32_t>(std::ceil(this->m_LoadRadius / static_cast<float>(this->m_CellSize * static_cast<int32_t>(Chunk::s_Size)))) + 1;
+
+			std::vector<std::pair<float, glm::ivec3>> candidates;
+			for (int32_t z = -reach; z <= reach; z++)
+			{
+				for (int32_t y = -reach; y <= reach; y++)
+				{
+					for (int32_t x = -reach; x <= reach; x++)
+					{
+						glm::ivec3 position = cameraCell + glm::ivec3 { x, y, z };
+						if (this->m_Cells.find(position) != this->m_Cells.end())
+							continue;
+
+						float distance = glm::length(GetCellCenter(position) - cameraPosition);
+						if (distance <= this->m_LoadRadius || position == cameraCell)
+							candidates.emplace_back(distance, position);
+					}
+				}
+			}
+			std::sort(candidates.begin(), candidates.end(), [](const std::pair<float, glm::ivec3>& a, const std::pair<float, glm::ivec3>& b) { return a.first < b.first; });
+
+			for (auto& [distance, position] : candidates)
+			{
+				if (pendingLoads >= this->m_MaxPendingLoads)
+					break;
+				RequestLoad(position);
+				pendingLoads++;
+			}
+		}
+
+		// Hand the chunks of loaded cells to the world, closest cells first.
+		std::vector<std::pair<float, glm::ivec3>> uploads;
+		for (auto& [position, cell] : this->m_Cells)
+			if (cell.m_State == CellState::UPLOADING)
+				uploads.emplace_back(glm::length(GetCellCenter(position) - cameraPosition), position);
+		std::sort(uploads.begin(), uploads.end(), [](const std::pair<float, glm::ivec3>& a, const std::pair<float, glm::ivec3>& b) { return a.first < b.first; });
+
+		for (auto& [distance, position] : uploads)
+		{
+			Cell& cell = this->m_Cells[position];
+			while (this->m_Stats.m_ChunksUploaded < this->m_MaxChunkUploads && elapsed() < budgetMilliseconds)
+			{
+				if (!UploadChunk(cell, scene))
+				{
+					cell.m_State = CellState::RESIDENT;
+					cell.m_Data.reset();
+					this->m_Stats.m_CellsLoaded++;
+					break;
+				}
+			}
+			if (cell.m_State != CellState::RESIDENT)
+				break;
+		}
+
+		this->m_Remesher.Update(cameraPosition, std::max(budgetMilliseconds - elapsed(), 0.0));
+
+		this->m_Stats.m_ResidentCells  = 0;
+		this->m_Stats.m_PendingLoads   = 0;
+		this->m_Stats.m_PendingUploads = 0;
+		for (auto& [position, cell] : this->m_Cells)
+		{
+			switch (cell.m_State)
+			{
+			case CellState::LOADING:
+				this->m_Stats.m_PendingLoads++;
+				break;
+			case CellState::UPLOADING:
+				this->m_Stats.m_PendingUploads++;
+				break;
+			case CellState::RESIDENT:
+				this->m_Stats.m_ResidentCells++;
+				break;
+			}
+		}
+		this->m_Stats.m_PendingSaves = static_cast<uint32_t>(this->m_Saves.size());
+		this->m_Stats.m_Stalled      = !IsCellResident(cameraCell);
+		if (this->m_Stats.m_Stalled)
+			this->m_Stats.m_Stalls++;
+		this->m_Stats.m_Milliseconds = elapsed();
+	}
+
+	void WorldPartition::SaveAll()
+	{
+		for (auto& [position, cell] : this->m_Cells)
+		{
+			if (!cell.m_Modified)
+				continue;
+
+			// The chunks stay in the world, so they are serialized here and only the write happens on a worker.
+			std::vector<Chunk*> chunks;
+			for (const glm::ivec3& chunkPosition : cell.m_Chunks)
+			{
+				Chunk* chunk = this->m_World.GetChunk(chunkPosition);
+				if (chunk)
+					chunks.push_back(chunk);
+			}
+
+			auto data = std::make_shared<std::vector<uint8_t>>();
+			SerializeCell(chunks, *data);
+			RequestWrite(position, data);
+			cell.m_Modified = false;
+		}
+
+		for (auto& [position, save] : this->m_Saves)
+			save.wait();
+		this->m_Saves.clear();
+	}
+
+	glm::ivec3 WorldPartition::GetCellPosition(const glm::ivec3& blockPosition) const
+	{
+		int32_t    size = this->m_CellSize * static_cast<int32_t>(Chunk::s_Size);
+		glm::ivec3 cellPosition;
+		for (uint32_t i = 0; i < 3; i++)
+			cellPosition[i] = (blockPosition[i] >= 0 ? blockPosition[i] : blockPosition[i] - size + 1) / size;
+		return cellPosition;
+	}
+
+	bool WorldPartition::IsCellResident(const glm::ivec3& cellPosition) const
+	{
+		auto itr = this->m_Cells.find(cellPosition);
+		return itr != this->m_Cells.end() && itr->second.m_State == CellState::RESIDENT;
+	}
+
+	const WorldPartitionStats& WorldPartition::GetStats() const
+	{
+		return this->m_Stats;
+	}
+
+	glm::fvec3 WorldPartition::GetCellCenter(const glm::ivec3& cellPosition) const
+	{
+		return (glm::fvec3(cellPosition) + 0.5f) * static_cast<float>(this->m_CellSize * static_cast<int32_t>(Chunk::s_Size));
+	}
+
+	std::filesystem::path WorldPartition::GetCellPath(const glm::ivec3& cellPosition) const
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "cell_%d_%d_%d.bin", cellPosition.x, cellPosition.y, cellPosition.z);
+		return this->m_Directory / name;
+	}
+
+	void WorldPartition::RequestLoad(const glm::ivec3& cellPosition)
+	{
+		// A load of a cell still being saved has to wait for the save, or it would read the old file.
+		std::shared_future<void> save;
+		auto                     saveItr = this->m_Saves.find(cellPosition);
+		if (saveItr != this->m_Saves.end())
+			save = saveItr->second;
+
+		Cell& cell  = this->m_Cells[cellPosition];
+		cell.m_Load = JobSystem::GetInstance()->Submit([save, path = GetCellPath(cellPosition), generator = this->m_Generator, cellPosition, cellSize = this->m_CellSize]() {
+			if (save.valid())
+				save.wait();
+
+			auto data = std::make_unique<CellData>();
+			if (!ReadCell(path, cellPosition, cellSize, *data))
+			{
+				data->m_Chunks.clear();
+				if (generator)
+					generator(cellPosition, data->m_Chunks);
+			}
+			return data;
+		});
+	}
+
+	bool WorldPartition::UploadChunk(Cell& cell, scene::Scene* scene)
+	{
+		if (!cell.m_Data || cell.m_NextUpload >= cell.m_Data->m_Chunks.size())
+			return false;
+
+		std::unique_ptr<Chunk>& chunk    = cell.m_Data->m_Chunks[cell.m_NextUpload++];
+		glm::ivec3              position = chunk->GetPosition();
+		if (!this->m_World.InsertChunk(std::move(chunk)))
+			return true;
+
+		cell.m_Chunks.push_back(position);
+		this->m_Remesher.MarkChunkDirty(position);
+		auto entity = std::make_unique<ChunkEntity>(this->m_Remesher, position);
+		if (scene)
+			scene->AttachEntity(entity.get());
+		this->m_Entities[position] = std::move(entity);
+		this->m_Stats.m_ChunksUploaded++;
+		return true;
+	}
+
+	void WorldPartition::Unload(const glm::ivec3& cellPosition, Cell& cell)
+	{
+		std::vector<std::unique_ptr<Chunk>> chunks;
+		for (const glm::ivec3& position : cell.m_Chunks)
+		{
+			this->m_Entities.erase(position);
+			this->m_Remesher.RemoveChunk(position);
+			std::unique_ptr<Chunk> chunk = this->m_World.ExtractChunk(position);
+			if (chunk && cell.m_Modified)
+				chunks.push_back(std::move(chunk));
+		}
+
+		if (cell.m_Modified)
+		{
+			// Chunks that weren't handed to the world yet are still part of the cell's file.
+			if (cell.m_Data)
+				for (uint32_t i = cell.m_NextUpload; i < cell.m_Data->m_Chunks.size(); i++)
+					chunks.push_back(std::move(cell.m_Data->m_Chunks[i]));
+			RequestSave(cellPosition, std::move(chunks));
+		}
+
+		// The neighbouring chunks have to show the faces the unloaded chunks were hiding.
+		for (const glm::ivec3& position : cell.m_Chunks)
+			for (const glm::ivec3& offset : s_FaceNeighbours)
+				if (this->m_Remesher.GetMesh(position + offset))
+					this->m_Remesher.MarkChunkDirty(position + offset);
+		cell.m_Chunks.clear();
+	}
+
+	void WorldPartition::RequestSave(const glm::ivec3& cellPosition, std::vector<std::unique_ptr<Chunk>> chunks)
+	{
+		// The chunks left the world, so serializing them on a worker is safe.
+		auto owned = std::make_shared<std::vector<std::unique_ptr<Chunk>>>(std::move(chunks));
+		auto data  = std::make_shared<std::vector<uint8_t>>();
+		RequestWrite(cellPosition, data, [owned, data]() {
+			std::vector<Chunk*> pointers;
+			for (auto& chunk : *owned)
+				pointers.push_back(chunk.get());
+			SerializeCell(pointers, *data);
+		});
+	}
+
+	void WorldPartition::RequestWrite(const glm::ivec3& cellPosition, std::shared_ptr<std::vector<uint8_t>> data, std::function<void()> serialize)
+	{
+		// Saves of the same cell are chained, so an older save can't overwrite a newer one.
+		std::shared_future<void> previous;
+		auto                     itr = this->m_Saves.find(cellPosition);
+		if (itr != this->m_Saves.end())
+			previous = itr->second;
+
+		this->m_Saves[cellPosition] = JobSystem::GetInstance()->Submit([previous, data, serialize, path = GetCellPath(cellPosition)]() {
+			if (previous.valid())
+				previous.wait();
+			if (serialize)
+				serialize();
+			WriteCell(path, *data);
+		});
+	}
+
+	void WorldPartition::CollectSaves()
+	{
+		auto itr = this->m_Saves.begin();
+		while (itr != this->m_Saves.end())
+		{
+			if (itr->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+				itr = this->m_Saves.erase(itr);
+			else
+				++itr;
+		}
+	}
+
+	bool WorldPartition::ReadCell(const std::filesystem::path& path, const glm::ivec3& cellPosition, int32_t cellSize, CellData& data)
+	{
+		FILE* file = fopen(path.string().c_str(), "rb");
+		if (!file)
+			return false;
+
+		std::vector<uint8_t> bytes;
+		fseek(file, 0, SEEK_END);
+		long length = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		if (length > 0)
+		{
+			bytes.resize(static_cast<size_t>(length));
+			bytes.resize(fread(bytes.data(), 1, bytes.size(), file));
+		}
+		fclose(file);
+
+		uint32_t magic;
+		uint32_t chunkCount;
+		if (bytes.size() < 12)
+			return false;
+		std::memcpy(&magic, bytes.data(), 4);
+		std::memcpy(&chunkCount, bytes.data() + 8, 4);
+		if (magic != s_CellMagic || bytes[4] != s_CellVersion)
+			return false;
+
+		size_t offset = 12;
+		for (uint32_t i = 0; i < chunkCount; i++)
+		{
+			if (bytes.size() - offset < 16)
+				return false;
+
+			glm::ivec3 position;
+			uint32_t   size;
+			std::memcpy(&position, bytes.data() + offset, 12);
+			std::memcpy(&size, bytes.data() + offset + 12, 4);
+			offset += 16;
+			if (bytes.size() - offset < size)
+				return false;
+
+			bool inside = true;
+			for (uint32_t j = 0; j < 3; j++)
+				inside &= position[j] >= cellPosition[j] * cellSize && position[j] < (cellPosition[j] + 1) * cellSize;
+			if (!inside)
+			{
+				s_WorldPartitionLogger.LogWarning("Skipped chunk (%d, %d, %d) in '%s' as it lies outside the cell", position.x, position.y, position.z, path.string().c_str());
+				offset += size;
+				continue;
+			}
+
+			auto chunk = std::make_unique<Chunk>(position);
+			if (!chunk->Deserialize(bytes.data() + offset, size))
+				return false;
+			data.m_Chunks.push_back(std::move(chunk));
+			offset += size;
+		}
+		return true;
+	}
+
+	bool WorldPartition::WriteCell(const std::filesystem::path& path, const std::vector<uint8_t>& data)
+	{
+		// Written to a temporary file first, so a crash while saving leaves the old file intact.
+		std::filesystem::path temporary = path;
+		temporary += ".tmp";
+
+		FILE* file = fopen(temporary.string().c_str(), "wb");
+		if (!file)
+			return false;
+		bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+		written &= fclose(file) == 0;
+		if (!written)
+			return false;
+
+		std::error_code error;
+		std::filesystem::rename(temporary, path, error);
+		return !error;
+	}
+
+} // namespace gp1::voxel
@@ -9,9 +9,22 @@ out vec2 passUV;
 
 uniform mat4 transformationMatrix;
 uniform mat4 projectionViewMatrix;
+uniform mat4 dequantizationMatrix;
+uniform int packedNormals;
+
+vec3 decodeNormal(vec3 normal) {
+	if (packedNormals == 0)
+		return normal;
+
+	vec3 n = vec3(normal.xy, 1.0 - abs(normal.x) - abs(normal.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
 
 void main(void) {
-	gl_Position = projectionViewMatrix * transformationMatrix * vec4(inPosition, 1.0);
-	passNormal = (transformationMatrix * vec4(inNormal, 0.0)).xyz;
+	gl_Position = projectionViewMatrix * transformationMatrix * dequantizationMatrix * vec4(inPosition, 1.0);
+	passNormal = (transformationMatrix * vec4(decodeNormal(inNormal), 0.0)).xyz;
 	passUV = inUV;
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+#version 430
+
+in vec3 inPosition;
+in vec3 inNormal;
+in vec2 inUV;
+
+out vec3 passNormal;
+out vec2 passUV;
+
+layout(std430, binding = 2) readonly buffer VisibleInstances {
+	mat4 visibleTransforms[];
+};
+
+uniform mat4 projectionViewMatrix;
+uniform mat4 dequantizationMatrix;
+uniform int packedNormals;
+
+vec3 decodeNormal(vec3 normal) {
+	if (packedNormals == 0)
+		return normal;
+
+	vec3 n = vec3(normal.xy, 1.0 - abs(normal.x) - abs(normal.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
+
+void main(void) {
+	mat4 transformationMatrix = visibleTransforms[gl_InstanceID];
+	gl_Position = projectionViewMatrix * transformationMatrix * dequantizationMatrix * vec4(inPosition, 1.0);
+	passNormal = (transformationMatrix * vec4(decodeNormal(inNormal), 0.0)).xyz;
+	passUV = inUV;
+}
@@ -0,0 +1,28 @@
+#version 430
+
+in vec3 inPosition;
+in vec3 inNormal;
+in vec2 inUV;
+in uvec3 inJointIndices;
+in vec3 inJointWeights;
+
+out vec3 passNormal;
+out vec2 passUV;
+
+layout(std430, binding = 4) readonly buffer JointPalettes {
+	mat4 jointMatrices[];
+};
+
+uniform mat4 transformationMatrix;
+uniform mat4 projectionViewMatrix;
+uniform uint jointOffset;
+
+void main(void) {
+	mat4 skinMatrix = jointMatrices[jointOffset + inJointIndices.x] * inJointWeights.x
+	                + jointMatrices[jointOffset + inJointIndices.y] * inJointWeights.y
+	                + jointMatrices[jointOffset + inJointIndices.z] * inJointWeights.z;
+
+	gl_Position = projectionViewMatrix * transformationMatrix * skinMatrix * vec4(inPosition, 1.0);
+	passNormal = (transformationMatrix * skinMatrix * vec4(inNormal, 0.0)).xyz;
+	passUV = inUV;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#version 150
+
+const vec2 lightBias = vec2(0.7, 0.6);
+
+const uint ALPHA_TESTED = 1u;
+const uint UNLIT = 2u;
+
+in vec3 passNormal;
+in vec2 passUV;
+flat in vec4 passTint;
+flat in vec3 passEmissive;
+flat in uint passTextureLayer;
+flat in uint passFlags;
+
+out vec4 outColor;
+
+uniform vec3 lightDirection;
+
+uniform sampler2DArray tex;
+
+void main(void) {
+	// The uvs are in blocks, so the repeat wrapping tiles the layer once per block across merged faces.
+	vec4 diffuseColor = texture(tex, vec3(passUV, float(passTextureLayer))) * passTint;
+	if ((passFlags & ALPHA_TESTED) != 0u && diffuseColor.w < 0.5)
+		discard;
+
+	float diffuseLight = 1.0;
+	if ((passFlags & UNLIT) == 0u) {
+		vec3 unitNormal = normalize(passNormal);
+		diffuseLight = max(dot(-lightDirection, unitNormal), 0.0) * lightBias.x + lightBias.y;
+	}
+	outColor = vec4(diffuseColor.xyz * diffuseLight + passEmissive, diffuseColor.w);
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#version 430
+
+in vec3 inPosition;
+in vec3 inNormal;
+in vec2 inUV;
+in uint inSSBOIndex;
+
+out vec3 passNormal;
+out vec2 passUV;
+flat out vec4 passTint;
+flat out vec3 passEmissive;
+flat out uint passTextureLayer;
+flat out uint passFlags;
+
+struct VoxelMaterial {
+	vec4 tint;
+	vec4 emissive;
+	uint textureLayer;
+	uint flags;
+};
+
+layout(std430, binding = 3) readonly buffer VoxelMaterials {
+	VoxelMaterial materials[];
+};
+
+uniform mat4 transformationMatrix;
+uniform mat4 projectionViewMatrix;
+uniform mat4 dequantizationMatrix;
+uniform int packedNormals;
+
+vec3 decodeNormal(vec3 normal) {
+	if (packedNormals == 0)
+		return normal;
+
+	vec3 n = vec3(normal.xy, 1.0 - abs(normal.x) - abs(normal.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
+
+void main(void) {
+	gl_Position = projectionViewMatrix * transformationMatrix * dequantizationMatrix * vec4(inPosition, 1.0);
+	passNormal = (transformationMatrix * vec4(decodeNormal(inNormal), 0.0)).xyz;
+	passUV = inUV;
+
+	uint index = min(inSSBOIndex, uint(materials.length() - 1));
+	VoxelMaterial material = materials[index];
+	passTint = material.tint;
+	passEmissive = material.emissive.xyz;
+	passTextureLayer = material.textureLayer;
+	passFlags = material.flags;
+}
\ No newline at end of file